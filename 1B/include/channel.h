@@ -0,0 +1,94 @@
+/**
+ * @file channel.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-25
+ *
+ * @brief Shared memory transport for OSUE exercise 1B `Battleship'.
+ * @details A channel connects a single client to the server on the same host
+ * through a named POSIX shared memory object holding two single producer
+ * single consumer rings, one for requests and one for responses. Receivers
+ * spin for a bounded time before they sleep on a futex, so a message usually
+ * crosses without any system call. Both ends record their process id, so a
+ * peer that crashed without detaching is treated as detached.
+ */
+#ifndef CHANNEL_H
+#define CHANNEL_H
+
+#include <stdint.h>
+
+#include "msg.h"
+
+/**
+ * @brief a process' handle of a channel
+ */
+typedef struct channel channel_t;
+
+/**
+ * @brief create a channel for the server
+ * @param name the name of the shared memory object, starting with a slash
+ * @return the new channel, NULL on failure with errno set
+ */
+channel_t *create_channel(const char *name);
+
+/**
+ * @brief attach a client to a channel created by the server
+ * @param name the name of the shared memory object
+ * @return the attached channel, NULL on failure with errno set. EBUSY if
+ * another client is attached.
+ */
+channel_t *open_channel(const char *name);
+
+/**
+ * @brief detach from a channel and unmap it, the server also removes the
+ * shared memory object
+ * @param channel the channel to close, may be NULL
+ */
+void close_channel(channel_t *channel);
+
+/**
+ * @brief make a channel available to the next client after the previous one
+ * detached, only called by the server
+ * @details a client still attached is detached, its next use of the channel
+ * fails.
+ * @param channel the channel to reset
+ */
+void reset_channel(channel_t *channel);
+
+/**
+ * @brief send a request to the server
+ * @param channel the channel to send on
+ * @param msg the request
+ * @return 0 on success, -1 with errno set to EPIPE if the server detached,
+ * died or detached this client
+ */
+int send_request(channel_t *channel, client_msg_t msg);
+
+/**
+ * @brief wait for the next request of the client
+ * @param channel the channel to receive from
+ * @param msg the request is stored into this parameter
+ * @param timeout the maximum time to wait in milliseconds, -1 for no limit
+ * @return 0 on success, -1 with errno set to EPIPE if the client detached or
+ * died, or to ETIMEDOUT if the timeout expired
+ */
+int recv_request(channel_t *channel, client_msg_t *msg, int timeout);
+
+/**
+ * @brief send a response to the client
+ * @param channel the channel to send on
+ * @param msg the response
+ * @return 0 on success, -1 with errno set to EPIPE if the client detached or
+ * died
+ */
+int send_response(channel_t *channel, server_msg_t msg);
+
+/**
+ * @brief wait for the next response of the server
+ * @param channel the channel to receive from
+ * @param msg the response is stored into this parameter
+ * @return 0 on success, -1 with errno set to EPIPE if the server detached,
+ * died or detached this client
+ */
+int recv_response(channel_t *channel, server_msg_t *msg);
+
+#endif  // CHANNEL_H
@@ -0,0 +1,69 @@
+/**
+ * @file codec.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Batch message codec of OSUE exercise 1B `Battleship'.
+ * @details Converts arrays of messages from and to their wire format in a
+ * single call. Client messages travel in little endian byte order, server
+ * messages are a single byte. A whole buffer of received client messages can
+ * be checked for parity errors at once, without decoding it first.
+ */
+#ifndef CODEC_H
+#define CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "msg.h"
+
+// length of an encoded client and server message in bytes
+#define REQUEST_LEN sizeof(client_msg_t)
+#define RESPONSE_LEN sizeof(server_msg_t)
+
+/**
+ * @brief encode client messages into their wire format
+ * @param msgs the messages to encode
+ * @param n the number of messages
+ * @param buf a buffer of at least n * REQUEST_LEN bytes
+ * @return the number of bytes written to buf
+ */
+size_t encode_requests(const client_msg_t *msgs, size_t n, uint8_t *buf);
+
+/**
+ * @brief decode client messages from their wire format
+ * @param buf the encoded messages
+ * @param n the number of messages to decode
+ * @param msgs an array of at least n messages
+ */
+void decode_requests(const uint8_t *buf, size_t n, client_msg_t *msgs);
+
+/**
+ * @brief check the parity bits of encoded client messages
+ * @details the parity of a message does not depend on its byte order, so
+ * the buffer is checked four messages per word without decoding it.
+ * @param buf the encoded messages
+ * @param n the number of messages to check
+ * @return the index of the first message with a wrong parity bit, n if the
+ * parity bits of all messages are correct
+ */
+size_t check_requests(const uint8_t *buf, size_t n);
+
+/**
+ * @brief encode server messages into their wire format
+ * @param msgs the messages to encode
+ * @param n the number of messages
+ * @param buf a buffer of at least n * RESPONSE_LEN bytes
+ * @return the number of bytes written to buf
+ */
+size_t encode_responses(const server_msg_t *msgs, size_t n, uint8_t *buf);
+
+/**
+ * @brief decode server messages from their wire format
+ * @param buf the encoded messages
+ * @param n the number of messages to decode
+ * @param msgs an array of at least n messages
+ */
+void decode_responses(const uint8_t *buf, size_t n, server_msg_t *msgs);
+
+#endif  // CODEC_H
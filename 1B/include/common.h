@@ -10,7 +10,10 @@
 #ifndef COMMON_H
 #define COMMON_H
 
-#define DEBUG 1
+// debug output is built in with make DEBUG=1
+#ifndef DEBUG
+#define DEBUG 0
+#endif
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -19,32 +22,22 @@
 #define DEFAULT_HOST "localhost"
 #define DEFAULT_PORT "1280"
 
-// Length of each side of the map:
-#define MAP_SIZE 10
+// Largest length of each side of the map, limited by the 6 bits of each
+// coordinate in a message. The actual size is part of the rules, see rules.h
+#define MAX_MAP_SIZE 64
 
-// Minimum and maximum length of the ships:
+// Minimum length of the ships:
 #define MIN_SHIP_LEN 2
-#define MAX_SHIP_LEN 4
-
-// Number of ships of each length:
-#define SHIP_CNT_LEN2 2  // 2 ships of length 2
-#define SHIP_CNT_LEN3 3  // 3 ships of length 3
-#define SHIP_CNT_LEN4 1  // 1 ship of length 4
-// Number of ships in total
-#define SHIP_CNT_TOTAL SHIP_CNT_LEN2 + SHIP_CNT_LEN3 + SHIP_CNT_LEN4
 
 // error exit codes
 #define EXIT_PARITY_ERR 2
 #define EXIT_COORDINATE_ERR 3
 
 // coordinate format paramters
-#define COORDINATE_LEN 4
+#define COORDINATE_LEN 4  // longest formatted coordinate, e.g. `BL63'
 #define COORDINATE_BITS 0x3F
 #define X_COORDINATE_OFFSET 6
 
-// Maximum number of rounds after which the client loses the game:
-#define MAX_ROUNDS 80
-
 // Suggested values to save information about the squares of the map:
 typedef enum
 {
@@ -83,9 +76,16 @@ extern const coordinate_t invalid_coordinate;
 /**
  * @brief checks whether or not the given coordinates lay within the map
  * @param c the coordinate to be checked
+ * @param map_size the length of each side of the map
  * @return true if c is a valid coordinate, false otherwise
  */
-bool check_coordinate(coordinate_t c);
+bool check_coordinate(coordinate_t c, uint8_t map_size);
+
+/**
+ * @brief get the current time of the monotonic clock
+ * @return the time in nanoseconds
+ */
+uint64_t get_time_ns(void);
 
 #define debug_print(fmt, ...)       \
 	do {                            \
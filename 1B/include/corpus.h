@@ -0,0 +1,65 @@
+/**
+ * @file corpus.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief A fixed set of fleets for the server of OSUE exercise 1B
+ * `Battleship'.
+ * @details A corpus is loaded from a text file of one fleet per line, as
+ * written by the fleets tool, or from the fleets of the games of a game log.
+ * The file is mapped into memory and every fleet is parsed and checked on
+ * bitboards exactly once while loading, afterwards its ships are only copied.
+ */
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common.h"
+#include "ship.h"
+#include "fleet.h"
+#include "rules.h"
+
+/**
+ * @brief the fleets of a corpus
+ */
+typedef struct
+{
+	uint16_t ship_cnt;   // number of ships of every fleet
+	size_t fleet_cnt;	// number of fleets
+	size_t capacity;	 // number of fleets the storage holds
+	ship_t *ships;		 // the ships of all fleets, one fleet after another
+} corpus_t;
+
+/**
+ * @brief load all fleets of a file
+ * @param corpus the corpus to initialize
+ * @param path the path of a text file or a game log
+ * @param rules the rules every fleet has to follow
+ * @param bad the number of the first illegal fleet is stored into this
+ * parameter, its line in a text file or its game in a log, 0 if there is
+ * none
+ * @return 0 on success, -1 on failure with errno set, to EINVAL if a fleet is
+ * illegal or the file holds none
+ */
+int load_corpus(corpus_t *corpus,
+				const char *path,
+				const rules_t *rules,
+				unsigned long *bad);
+
+/**
+ * @brief free the fleets of a corpus
+ * @param corpus the corpus to free, may be loaded or zeroed
+ */
+void free_corpus(corpus_t *corpus);
+
+/**
+ * @brief copy a fleet of the corpus
+ * @param corpus the corpus
+ * @param i the index of the fleet, below corpus->fleet_cnt
+ * @param fleet a fleet of corpus->ship_cnt ships the ships are copied into
+ */
+void get_corpus_fleet(const corpus_t *corpus, size_t i, fleet_t *fleet);
+
+#endif  // CORPUS_H
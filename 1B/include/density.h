@@ -0,0 +1,133 @@
+/**
+ * @file density.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Estimation of the ship density of the squares of a game in progress
+ * for OSUE exercise 1B `Battleship'.
+ * @details The density of a square is the number of fleets consistent with
+ * the shots so far that cover it: the remaining ships avoid every miss and
+ * every sunk ship, do not touch each other and together cover every hit of
+ * the ships not sunk yet. If few combinations of the remaining ships are left
+ * all of them are counted exactly, otherwise consistent fleets are sampled
+ * at random by several threads for as long as the time budget lasts.
+ */
+#ifndef DENSITY_H
+#define DENSITY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common.h"
+#include "rules.h"
+#include "rng.h"
+#include "fleet.h"
+
+// combinations of placements of the remaining ships up to which all fleets
+// are counted instead of sampled
+#define EXACT_FLEETS (1 << 16)
+// maximum number of threads sampling fleets
+#define MAX_SAMPLERS 64
+
+/**
+ * @brief the fleets counted by one sampling thread
+ * @details every thread counts into its own arrays, which are only merged
+ * once the budget is used up, so the threads share nothing but the
+ * placements they read.
+ */
+typedef struct
+{
+	rng_t rng;			// the thread's own random generator
+	uint32_t *weights;	// fleets counted holding each placement
+	uint32_t *chosen;	// placement of each ship of the current fleet
+	uint32_t fleets;	// number of fleets counted
+	uint32_t ticks;		// fleets tried so far
+	bool expired;		// true once the budget is used up
+	bitboard_t taken;	// squares blocked by the ships of the current fleet
+} sampler_t;
+
+/**
+ * @brief the workspace and the result of a density estimation
+ * @details the arrays are sized to the rules at initialization, so an
+ * estimation allocates nothing.
+ */
+typedef struct
+{
+	uint8_t map_size;		  // length of each side of the map
+	uint16_t ship_cnt;		  // ships left in the current estimation
+	uint16_t hit_total;		  // hits every fleet has to cover
+	uint64_t deadline;		  // end of the budget in nanoseconds
+	placement_t *placements;  // placements of the remaining ships that avoid
+							  // the blocked squares, grouped by length
+	uint32_t placement_cnt;   // number of placements
+	size_t capacity;		  // maximum number of placements
+	uint16_t *hit_cnts;		  // hits covered by each placement
+	uint32_t first[MAX_MAP_SIZE + 1];  // first placement of each length
+	uint32_t count[MAX_MAP_SIZE + 1];  // placements of each length
+	uint8_t *lengths;		  // the remaining ships, longest first
+	bitboard_t *taken;		  // squares blocked by the first n ships of the
+							  // fleet being counted exactly, by n
+	uint16_t sampler_cnt;	  // number of sampling threads
+	sampler_t *samplers;	  // the counts of each thread, the first one
+							  // samples on the calling thread, counts exactly
+							  // and holds the merged counts
+	struct sampler_pool *pool;  // the threads sampling next to the calling
+								// one, NULL if it samples alone
+	uint32_t *counts;		  // fleets counted covering each square, by
+							  // index row * map size + col
+	uint32_t fleets;		  // number of fleets counted
+	bool exact;				  // true if all consistent fleets were counted
+} density_t;
+
+/**
+ * @brief allocate the workspace of estimations for the games of a rule set
+ * @details starts the threads sampling next to the calling one, they sleep
+ * until an estimation samples. The workspace must not be moved afterwards.
+ * Workspaces sharing their threads must not estimate at the same time, e.g.
+ * because they are only used by one thread.
+ * @param density the workspace to initialize
+ * @param rules the rules of the games
+ * @param threads the number of threads sampling fleets, between 1 and
+ * MAX_SAMPLERS, ignored if shared is given
+ * @param shared a workspace whose threads sample for this one as well,
+ * which are stopped once the last of them is freed, NULL to start its own
+ * @return 0 on success, -1 if allocating failed
+ */
+int init_density(density_t *density,
+				 const rules_t *rules,
+				 uint16_t threads,
+				 density_t *shared);
+
+/**
+ * @brief stop the sampling threads of a workspace, unless other workspaces
+ * still share them, and free its arrays
+ * @param density the workspace to free, may be initialized or zeroed
+ */
+void free_density(density_t *density);
+
+/**
+ * @brief estimate how likely each square holds a ship
+ * @details counts exactly if the remaining ships have at most EXACT_FLEETS
+ * combinations of placements, otherwise samples fleets on all threads of the
+ * workspace. The calling thread is one of them, the others are woken for the
+ * estimation and waited for when the budget is used up, so the whole
+ * estimation takes the budget however many threads sample. An exact count
+ * that did not finish in time leaves exact false and is biased towards the
+ * placements it visited first.
+ * @param density a workspace initialized for the rules, the counts are stored
+ * into it
+ * @param blocked the squares no remaining ship covers: misses, including the
+ * squares around sunk ships, and the sunk ships themselves
+ * @param hits the hits on ships that are not sunk yet
+ * @param ship_counts the number of remaining ships of each length
+ * @param rng the random number generator seeding the samplers
+ * @param budget the time to spend in microseconds
+ */
+void estimate_density(density_t *density,
+					  const bitboard_t *blocked,
+					  const bitboard_t *hits,
+					  const uint16_t *ship_counts,
+					  rng_t *rng,
+					  uint32_t budget);
+
+#endif  // DENSITY_H
@@ -3,8 +3,11 @@
  * @author Matthias Pichler, 01634256
  * @date 2018-04-13
  *
- * @brief A simple deque data structure for coordinates based on a singly linked
- * list.
+ * @brief A simple deque data structure for coordinates based on a fixed
+ * capacity circular array.
+ * @details The capacity is chosen once when the deque is initialized, so no
+ * other operation ever allocates memory and all of them except contains() run
+ * in constant time.
  */
 #ifndef DEQUE_H
 #define DEQUE_H
@@ -13,35 +16,41 @@
 #include <stdlib.h>
 #include "../include/common.h"
 
-/**
- * @brief an entry within the deque, keeping track of the data and the next
- * element
- */
-typedef struct node
-{
-	struct node *next;
-	coordinate_t data;
-} node_t;
-
 /**
  * @brief type for a simple deque
  */
 typedef struct
 {
-	size_t size;
-	node_t *head;
-	node_t *tail;
+	size_t size;		 // number of stored elements
+	size_t head;		 // index of the front element
+	size_t capacity;	 // maximum number of stored elements
+	coordinate_t *data;  // the circular storage
 } deque_t;
 
 /**
  * @brief create a new deque, with size 0
- * @return a pointer to a new deque
+ * @param capacity the maximum number of coordinates in the deque
+ * @return a pointer to a new deque, NULL if allocating failed
+ */
+deque_t *get_deque(size_t capacity);
+
+/**
+ * @brief initialize a deque in place, setting its size to 0
+ * @param deque the deque to initialize
+ * @param capacity the maximum number of coordinates in the deque
+ * @return 0 on success, -1 if allocating the storage failed
+ */
+int init_deque(deque_t *deque, size_t capacity);
+
+/**
+ * @brief free the storage of a deque initialized by init_deque()
+ * @param deque the deque to free
  */
-deque_t *get_deque(void);
+void free_deque(deque_t *deque);
 
 /**
  * @brief push the provided coordinate on the given deque, incrementing the size
- * @return 0 if the push was successful, -1 otherwise
+ * @return 0 if the push was successful, -1 if the deque is full
  */
 int8_t push_front(deque_t *deque, coordinate_t c);
 
@@ -61,7 +70,7 @@ coordinate_t peek_front(deque_t *deque);
 /**
  * @brief push the provided coordinate on the back of the given deque,
  * incrementing the size
- * @return 0 if the push was successful, -1 otherwise
+ * @return 0 if the push was successful, -1 if the deque is full
  */
 int8_t push_back(deque_t *deque, coordinate_t c);
 
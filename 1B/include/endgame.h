@@ -0,0 +1,80 @@
+/**
+ * @file endgame.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Precomputed moves for sinking the last ships of OSUE exercise 1B
+ * `Battleship'.
+ * @details Once at most ENDGAME_SHIPS ships of at most ENDGAME_MAX_LEN
+ * squares are left and a ship was hit, the best next shot only depends on
+ * the lengths of the remaining ships, the number of hits in a line and the
+ * unknown squares next to them in each direction. The endgames tool
+ * evaluates every such state at build time: it fires at the neighbor of the
+ * hits covered by the most placements of the remaining ships. The generated
+ * table is an open addressing hash table of entries key << 2 | move, empty
+ * slots are 0.
+ */
+#ifndef ENDGAME_H
+#define ENDGAME_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common.h"
+
+// maximum number of remaining ships of an endgame
+#define ENDGAME_SHIPS 2
+// maximum length of the remaining ships of an endgame
+#define ENDGAME_MAX_LEN 5
+// number of directions of an endgame move: up, down, left and right of a
+// single hit, before and after a line of hits
+#define ENDGAME_DIRS 4
+
+// the generated table and the number of bits of its slot indices
+extern const uint32_t endgame_table[];
+extern const uint8_t endgame_bits;
+
+/**
+ * @brief check if the remaining ships form an endgame
+ * @details cheap enough to be checked after every sunk ship, before the
+ * hits around a ship are looked at.
+ * @param ship_counts the number of remaining ships of each length
+ * @return true if at most ENDGAME_SHIPS ships of at most ENDGAME_MAX_LEN
+ * squares are left, and at least one
+ */
+bool is_endgame(const uint16_t *ship_counts);
+
+/**
+ * @brief compute the key of an endgame state
+ * @details the unknown squares in each direction are only distinguished up
+ * to the longest distance a remaining ship reaches beyond the hits.
+ * @param ship_counts the number of remaining ships of each length
+ * @param hits the number of hits on the ship being sunk, in a line
+ * @param runs the number of unknown squares next to the hits in each
+ * direction: up, down, left and right of a single hit, before and after a
+ * line of hits followed by two zeros
+ * @return the key, 0 if the state is no endgame
+ */
+uint32_t get_endgame_key(const uint16_t *ship_counts,
+						 uint8_t hits,
+						 const uint8_t *runs);
+
+/**
+ * @brief get the slot of the table a key is looked up at first
+ * @param key the key of the state
+ * @param bits the number of bits of the slot indices
+ * @return the slot
+ */
+uint32_t get_endgame_slot(uint32_t key, uint8_t bits);
+
+/**
+ * @brief look up the move of an endgame state
+ * @param table a table of 1 << bits slots
+ * @param bits the number of bits of the slot indices
+ * @param key the key of the state, not 0
+ * @return the direction to fire at, see runs of get_endgame_key(), -1 if the
+ * state is not in the table
+ */
+int lookup_endgame(const uint32_t *table, uint8_t bits, uint32_t key);
+
+#endif  // ENDGAME_H
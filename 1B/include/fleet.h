@@ -0,0 +1,205 @@
+/**
+ * @file fleet.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-22
+ *
+ * @brief Generation and validation of complete fleets for OSUE exercise 1B
+ * `Battleship'.
+ * @details Fleets are checked on bitboards holding one word per row of the
+ * map. A placement of a ship carries the mask of the squares it occupies and
+ * the mask of its halo, the squares no other ship may occupy.
+ */
+#ifndef FLEET_H
+#define FLEET_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common.h"
+#include "ship.h"
+#include "map.h"
+#include "rng.h"
+#include "rules.h"
+
+// length of a formatted fleet of n ships, including the terminating null byte
+#define FLEET_LINE_LEN(n) ((n) * (SHIP_STR_LEN + 1))
+
+// restarts of random_fleet() before a rule set is considered unplayable
+#define FLEET_ATTEMPTS (1 << 20)
+
+/**
+ * @brief a board with one bit per square, one word per row, of which only
+ * the rows of the map are used
+ */
+typedef struct
+{
+	uint64_t rows[MAX_MAP_SIZE];
+} bitboard_t;
+
+/**
+ * @brief a possible position of a ship on the map
+ */
+typedef struct
+{
+	ship_t ship;		 // the ship at this position
+	uint8_t rows;		 // number of rows covered by the ship
+	uint8_t halo_row;	// first row of the halo
+	uint8_t halo_rows;   // number of rows covered by the halo
+	uint64_t mask;		 // the ship's squares within each of its rows
+	uint64_t halo;		 // the halo's squares within each of its rows
+} placement_t;
+
+/**
+ * @brief all placements of the ship lengths of a rule set
+ */
+typedef struct
+{
+	uint32_t counts[MAX_MAP_SIZE + 1];  // number of placements of each length,
+										// 0 for lengths without ships
+	placement_t *by_length[MAX_MAP_SIZE + 1];  // placements of each length
+	placement_t *placements;  // storage of the placements of all lengths
+} placements_t;
+
+/**
+ * @brief a complete set of ships
+ */
+typedef struct
+{
+	uint16_t ship_cnt;  // number of ships
+	ship_t *ships;		// the ships
+} fleet_t;
+
+/**
+ * @brief allocate an empty fleet for the ships of a rule set
+ * @param fleet the fleet to initialize
+ * @param rules the rules the fleet is played by
+ * @return 0 on success, -1 if allocating failed
+ */
+int init_fleet(fleet_t *fleet, const rules_t *rules);
+
+/**
+ * @brief free the ships of a fleet
+ * @param fleet the fleet to free, may be empty
+ */
+void free_fleet(fleet_t *fleet);
+
+/**
+ * @brief copy the ships of a fleet into one of the same size
+ * @param dst the fleet to copy into
+ * @param src the fleet to copy
+ */
+void copy_fleet(fleet_t *dst, const fleet_t *src);
+
+/**
+ * @brief compute the placements of every ship length of a rule set
+ * @details a length has 2 * map_size * (map_size - length + 1) placements,
+ * half of them horizontal, so the table is built once for the rules and all
+ * random fleets by them draw from it.
+ * @param placements the table to initialize
+ * @param rules the rules to compute the placements of
+ * @return 0 on success, -1 if allocating failed
+ */
+int init_placements(placements_t *placements, const rules_t *rules);
+
+/**
+ * @brief free the placements of a table
+ * @param placements the table to free, may be initialized or zeroed
+ */
+void free_placements(placements_t *placements);
+
+/**
+ * @brief generate a uniformly distributed random legal fleet
+ * @details ships are drawn uniformly from all placements of their length and
+ * the whole fleet is started over as soon as a ship conflicts with the ones
+ * already placed, which is rejection sampling and therefore exact.
+ * @param fleet a fleet initialized for the rules, the generated ships are
+ * stored into it
+ * @param rules the rules to generate a fleet for
+ * @param placements the placements of the rules, see init_placements()
+ * @param attempts the number of times the fleet is started over before
+ * giving up, FLEET_ATTEMPTS unless the caller has to bound its work
+ * @param rng the random number generator to use
+ * @return 0 on success, -1 if no fleet was found in the given attempts
+ */
+int random_fleet(fleet_t *fleet,
+				 const rules_t *rules,
+				 const placements_t *placements,
+				 unsigned long attempts,
+				 rng_t *rng);
+
+/**
+ * @brief check that the fleet follows the rules: the right number of ships
+ * of each length and no two ships touching
+ * @param fleet the fleet to check
+ * @param rules the rules to check against
+ * @return true if the fleet is legal, false otherwise
+ */
+bool check_fleet(const fleet_t *fleet, const rules_t *rules);
+
+/**
+ * @brief parse a fleet from a line of whitespace separated ships, as accepted
+ * by parse_ship()
+ * @param line the line to parse
+ * @param fleet a fleet initialized for the rules, the parsed ships are stored
+ * into it
+ * @param rules the rules the fleet has to follow
+ * @return 0 if the line denotes a legal fleet, -1 otherwise
+ */
+int parse_fleet(const char *line, fleet_t *fleet, const rules_t *rules);
+
+/**
+ * @brief format a fleet in the form accepted by parse_fleet(), without a
+ * trailing newline
+ * @param fleet the fleet to format
+ * @param buf a buffer of at least FLEET_LINE_LEN(fleet->ship_cnt) characters
+ */
+void format_fleet(const fleet_t *fleet, char *buf);
+
+/**
+ * @brief check every line of a stream for a legal fleet
+ * @param in the stream to read the fleets from
+ * @param report if not NULL, the line numbers of illegal fleets are printed to
+ * this stream
+ * @param total the number of checked fleets is stored into this parameter
+ * @param rules the rules the fleets have to follow
+ * @return the number of illegal fleets, -1 if reading or allocating failed
+ */
+long validate_fleets(FILE *in,
+					 FILE *report,
+					 unsigned long *total,
+					 const rules_t *rules);
+
+/**
+ * @brief add all ships of the fleet to an empty map
+ * @param map the map to add the ships to
+ * @param fleet the fleet to add, has to outlive the map
+ */
+void place_fleet(map_t *map, const fleet_t *fleet);
+
+/**
+ * @brief compute the masks of a ship
+ * @param ship the ship, has to lie within the map
+ * @param map_size the length of each side of the map
+ * @param placement the masks are stored into this parameter
+ */
+void make_placement(const ship_t *ship,
+					uint8_t map_size,
+					placement_t *placement);
+
+/**
+ * @brief check if a placement occupies any blocked square
+ * @param blocked the board of blocked squares
+ * @param placement the placement to check
+ * @return true if the placement collides, false otherwise
+ */
+bool collides(const bitboard_t *blocked, const placement_t *placement);
+
+/**
+ * @brief block the squares of a placement and its halo
+ * @param blocked the board of blocked squares to update
+ * @param placement the placement to block
+ */
+void block_placement(bitboard_t *blocked, const placement_t *placement);
+
+#endif  // FLEET_H
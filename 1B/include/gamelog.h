@@ -0,0 +1,148 @@
+/**
+ * @file gamelog.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-27
+ *
+ * @brief Compact binary log of finished games for OSUE exercise 1B
+ * `Battleship'.
+ * @details A log starts with a gamelog_header_t, followed by one record per
+ * game without any padding:
+ * 	- 1 byte, or 2 if the round limit exceeds 255: the number of shots n
+ * 	- per ship: the cell index (row * map size + col) of its begin, then its
+ * 	  length with bit 7 set for vertical ships
+ * 	- per shot: the cell index, then the server's response
+ * Cell indices take 1 byte on maps of up to 16x16 squares and 2 bytes on
+ * larger ones, multi-byte numbers are stored little endian. All games of a
+ * log are played on the same map with the same number of ships. Records are
+ * appended by the server and read back through a memory mapping without
+ * copying the shots.
+ */
+#ifndef GAMELOG_H
+#define GAMELOG_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "common.h"
+#include "fleet.h"
+#include "rules.h"
+
+// magic number at the start of a log
+#define GAMELOG_MAGIC "BSGLOG02"
+// bit of the length byte of a ship marking it vertical
+#define GAMELOG_VERTICAL 0x80
+
+/**
+ * @brief the header of a log
+ */
+typedef struct
+{
+	char magic[8];		   // GAMELOG_MAGIC
+	uint8_t map_size;	  // length of each side of the map of the games
+	uint8_t reserved;
+	uint16_t ship_cnt;	 // number of ships of the games
+	uint16_t max_rounds;   // round limit of the games
+	uint8_t reserved2[2];
+} gamelog_header_t;
+
+/**
+ * @brief a shot of a game and the server's response to it
+ */
+typedef struct
+{
+	uint16_t cell;  // row * map size + col
+	uint8_t msg;	// the server's response
+} shot_t;
+
+/**
+ * @brief a game read from a log
+ */
+typedef struct
+{
+	fleet_t fleet;		   // the fleet the game was played on, valid until the
+						   // next game is read
+	uint16_t shot_cnt;	 // number of shots
+	uint8_t cell_bytes;	// bytes of each cell index
+	const uint8_t *shots;  // the encoded shots, points into the mapped log
+} game_t;
+
+/**
+ * @brief a log opened for reading
+ */
+typedef struct
+{
+	gamelog_header_t header;  // the header of the log
+	const uint8_t *data;	  // the mapped log
+	size_t size;			  // size of the mapping
+	size_t pos;				  // offset of the next record
+	ship_t *ships;			  // the ships of the last game read
+} gamelog_t;
+
+/**
+ * @brief open a log for appending, creating it with a header if it is empty
+ * @param path the path of the log
+ * @param rules the rules of the games to append
+ * @return the opened log, NULL on failure. errno is EINVAL if the file is no
+ * log of games by these rules.
+ */
+FILE *create_gamelog(const char *path, const rules_t *rules);
+
+/**
+ * @brief append a finished game to a log
+ * @param log a log opened by create_gamelog()
+ * @param rules the rules the log was opened with
+ * @param fleet the fleet the game was played on
+ * @param shots the shots of the game
+ * @param shot_cnt the number of shots, at most rules->max_rounds
+ * @return 0 on success, -1 on failure
+ */
+int append_game(FILE *log,
+				const rules_t *rules,
+				const fleet_t *fleet,
+				const shot_t *shots,
+				uint16_t shot_cnt);
+
+/**
+ * @brief map a log for reading
+ * @param path the path of the log
+ * @return the opened log, NULL on failure. errno is EINVAL if the file is no
+ * log of games.
+ */
+gamelog_t *open_gamelog(const char *path);
+
+/**
+ * @brief decode a shot of a game
+ * @param game the game read by next_game()
+ * @param i the index of the shot, below game->shot_cnt
+ * @return the shot
+ */
+shot_t get_shot(const game_t *game, uint16_t i);
+
+/**
+ * @brief read the next game of a log
+ * @details every ship of the game is checked to lie within the map, with a
+ * length of at least MIN_SHIP_LEN, and every shot to hit a cell of the map,
+ * so readers can use the game without checking it again. Whether the fleet
+ * follows any rules is not checked, see check_fleet().
+ * @param log the log to read from
+ * @param game the game is stored into this parameter, its shots stay valid
+ * until the log is closed
+ * @return 1 if a game was read, 0 at the end of the log, -1 if the next
+ * record is truncated or holds a ship or shot off the map
+ */
+int next_game(gamelog_t *log, game_t *game);
+
+/**
+ * @brief start reading a log from its first game again
+ * @param log the log to rewind
+ */
+void rewind_gamelog(gamelog_t *log);
+
+/**
+ * @brief unmap a log
+ * @param log the log to close, may be NULL
+ */
+void close_gamelog(gamelog_t *log);
+
+#endif  // GAMELOG_H
@@ -0,0 +1,79 @@
+/**
+ * @file heatmap.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Persistent heatmap of the fleets of an opponent for OSUE exercise 1B
+ * `Battleship'.
+ * @details A heatmap counts for every square of the map in how many games a
+ * ship covered it. It is built from the game logs of finished games and
+ * memory mapped by the solvers as a prior for their scan mode. The file holds
+ * a heatmap_header_t followed by one 32 bit count per square, by index
+ * row * map size + col, in host byte order.
+ */
+#ifndef HEATMAP_H
+#define HEATMAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "fleet.h"
+
+// magic number at the start of a heatmap
+#define HEATMAP_MAGIC "BSHEAT01"
+
+/**
+ * @brief the header of a heatmap file
+ */
+typedef struct
+{
+	char magic[8];		 // HEATMAP_MAGIC
+	uint8_t map_size;	// length of each side of the map
+	uint8_t reserved[3];
+	uint32_t games;		 // number of games counted
+} heatmap_header_t;
+
+/**
+ * @brief a mapped heatmap
+ */
+typedef struct
+{
+	heatmap_header_t *header;  // the header, points into the mapping
+	uint32_t *counts;		   // games in which a ship covered each square
+	size_t size;			   // size of the mapping
+} heatmap_t;
+
+/**
+ * @brief map a heatmap for reading
+ * @param path the path of the heatmap
+ * @return the mapped heatmap, NULL on failure. errno is EINVAL if the file is
+ * no heatmap.
+ */
+heatmap_t *open_heatmap(const char *path);
+
+/**
+ * @brief map a heatmap for counting further games, creating it if it is
+ * empty
+ * @param path the path of the heatmap
+ * @param map_size the length of each side of the map of the games
+ * @return the mapped heatmap, NULL on failure. errno is EINVAL if the file is
+ * no heatmap of this map size.
+ */
+heatmap_t *create_heatmap(const char *path, uint8_t map_size);
+
+/**
+ * @brief count the squares covered by the fleet of a game
+ * @param heatmap a heatmap mapped by create_heatmap()
+ * @param fleet the fleet of the game, on a map of the heatmap's size
+ * @return 0 on success, -1 if a ship lies off the map, nothing is counted
+ * then
+ */
+int count_fleet(heatmap_t *heatmap, const fleet_t *fleet);
+
+/**
+ * @brief unmap a heatmap, changes are written back to its file
+ * @param heatmap the heatmap to close, may be NULL
+ */
+void close_heatmap(heatmap_t *heatmap);
+
+#endif  // HEATMAP_H
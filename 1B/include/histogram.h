@@ -0,0 +1,61 @@
+/**
+ * @file histogram.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-24
+ *
+ * @brief A fixed size log-linear histogram for latency measurements.
+ * @details Values are grouped into buckets with a relative width of at most
+ * 1/HISTOGRAM_SUB_BUCKETS, so percentiles are accurate to about 6% without any
+ * allocation when recording.
+ */
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <stdint.h>
+
+// number of linear buckets per power of two
+#define HISTOGRAM_SUB_BUCKETS 16
+// total number of buckets, covering the whole range of uint64_t
+#define HISTOGRAM_BUCKETS (HISTOGRAM_SUB_BUCKETS * 61)
+
+/**
+ * @brief a histogram of 64 bit values
+ */
+typedef struct
+{
+	uint64_t count;
+	uint64_t sum;
+	uint64_t max;
+	uint64_t buckets[HISTOGRAM_BUCKETS];
+} histogram_t;
+
+/**
+ * @brief reset the histogram to hold no values
+ * @param histogram the histogram to reset
+ */
+void clear_histogram(histogram_t *histogram);
+
+/**
+ * @brief record a single value
+ * @param histogram the histogram to record into
+ * @param value the value to record
+ */
+void record_value(histogram_t *histogram, uint64_t value);
+
+/**
+ * @brief add all values of one histogram to another
+ * @param to the histogram to add to
+ * @param from the histogram to add
+ */
+void merge_histogram(histogram_t *to, const histogram_t *from);
+
+/**
+ * @brief get the value below which the given share of recorded values lies
+ * @param histogram the histogram to query
+ * @param p the share, between 0 and 1
+ * @return the upper bound of the bucket holding the percentile, 0 if the
+ * histogram is empty
+ */
+uint64_t get_percentile_value(const histogram_t *histogram, double p);
+
+#endif  // HISTOGRAM_H
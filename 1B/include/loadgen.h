@@ -0,0 +1,59 @@
+/**
+ * @file loadgen.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-24
+ *
+ * @brief Load generator for the server of OSUE exercise 1B `Battleship'.
+ * @details Plays many games over concurrent non-blocking connections from a
+ * single thread and measures the latency of every round and every game. The
+ * connections may be spread over several servers, e.g. for a tournament of
+ * bots against many server instances.
+ */
+#ifndef LOADGEN_H
+#define LOADGEN_H
+
+#include <stdint.h>
+
+#include "rules.h"
+#include "heatmap.h"
+
+/**
+ * @brief the parameters of a load run
+ */
+typedef struct
+{
+	const char *host;		   // the server's address
+	const char *port;		   // the server's port
+	const char *unix_path;	   // the server's Unix domain socket, if not NULL
+							   // it is used instead of host and port
+	const char *shm_name;	   // the server's shared memory channel, if not
+							   // NULL it is used instead of host and port
+	char *const *servers;	   // servers to spread the connections over,
+							   // `HOST:PORT', `HOST' or the path of a Unix
+							   // domain socket. If given, they are used
+							   // instead of host, port and unix_path
+	unsigned long server_cnt;   // number of servers
+	unsigned long connections;  // number of concurrent connections
+	unsigned long games;		// total number of games to play
+	const rules_t *rules;	   // the rules every connection proposes at
+							   // connect, NULL to play the classic rules
+							   // without proposing
+	uint64_t seed;			   // seed of the solvers
+	const heatmap_t *prior;	   // prior of the solvers' scan mode, NULL for
+							   // none
+	uint32_t budget;		   // time per move of the solvers in
+							   // microseconds, 0 for none
+	uint16_t samplers;		   // threads sampling fleets per move, shared
+							   // by the solvers of all connections
+} load_config_t;
+
+/**
+ * @brief play the configured number of games against the server and print the
+ * latency percentiles and the throughput to stdout
+ * @param config the parameters of the run
+ * @param program_name the name to prefix error messages with
+ * @return EXIT_SUCCESS if all games were played, EXIT_FAILURE otherwise
+ */
+int run_load(const load_config_t *config, const char *program_name);
+
+#endif  // LOADGEN_H
@@ -10,6 +10,7 @@
 
 #include "ship.h"
 #include "common.h"
+#include "rules.h"
 
 // a struct of a ship together with its remaining parts
 typedef struct
@@ -18,13 +19,16 @@ typedef struct
 	uint8_t ship_remainder;
 } ship_entry_t;
 
-// a struct representing the map.
+// a struct representing the map, its arrays are sized to the rules it was
+// created for and share its allocation
 typedef struct
 {
-	uint8_t ship_count;					 // count of intact ships on the map
-	int8_t field[MAP_SIZE * MAP_SIZE];   // an array of all positions of ships
-	hit_t hits[MAP_SIZE * MAP_SIZE];	 // an array of all hit states
-	ship_entry_t ships[SHIP_CNT_TOTAL];  // an array of all ships
+	uint8_t map_size;	 // length of each side of the map
+	uint16_t ship_count;  // count of intact ships on the map
+	uint16_t ship_total;  // count of all ships on the map
+	int16_t* field;		  // an array of all positions of ships
+	uint8_t* hits;		  // an array of all hit states, see hit_t
+	ship_entry_t* ships;  // an array of all ships
 
 } map_t;
 
@@ -40,9 +44,10 @@ void add_ship(map_t* map, const ship_t* ship);
 /**
  * @brief check if the number of ships per type, corresponds to the rules
  * @param map the map to check
+ * @param rules the rules to check against
  * @return true if all ships are present according to the rules, false otherwise
  */
-bool check_ship_count(const map_t* map);
+bool check_ship_count(const map_t* map, const rules_t* rules);
 
 /**
  * @brief check if any two ships on the map touch each other
@@ -83,10 +88,30 @@ hit_t get_hit(const map_t* map, coordinate_t coordinate);
  */
 void put_hit(map_t* map, hit_t value, coordinate_t coordinate);
 
+/**
+ * @brief remove all ships and hits from a map
+ * @param map the map to clear
+ */
+void clear_map(map_t* map);
+
+/**
+ * @brief restore a map to the start of a game, keeping its ships but removing
+ * all hits
+ * @param map the map to reset
+ */
+void reset_map(map_t* map);
+
 /**
  * @brief create a new map with all arrays initialized with their default values
- * @return a fully initialized map
+ * @param rules the rules giving the size of the map and the number of ships
+ * @return a fully initialized map, NULL if allocating failed
+ */
+map_t* get_map(const rules_t* rules);
+
+/**
+ * @brief free a map created by get_map()
+ * @param map the map to free, may be NULL
  */
-map_t* get_map(void);
+void free_map(map_t* map);
 
 #endif  // MAP_H
\ No newline at end of file
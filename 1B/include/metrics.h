@@ -0,0 +1,52 @@
+/**
+ * @file metrics.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Live metrics of the server of OSUE exercise 1B `Battleship'.
+ * @details The server counts into a metrics_t while serving and periodically
+ * rewrites a text file of one `name value' line per metric from it. The file
+ * is written next to its final path and renamed over it, so a reader always
+ * sees a complete set of metrics. Counters count since the server started,
+ * rates and latencies cover the interval since the previous write.
+ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+
+#include "histogram.h"
+
+/**
+ * @brief the metrics of a server
+ */
+typedef struct
+{
+	uint64_t connections;		 // open connections
+	uint64_t active_games;		 // games in progress
+	uint64_t games_started;		 // games ever started
+	uint64_t games_finished;	 // games ever finished, by any status
+	uint64_t shots;				 // shots ever handled
+	uint64_t parity_errors;		 // requests with a wrong parity bit
+	uint64_t coordinate_errors;  // shots at invalid coordinates
+	uint64_t timeouts;			 // connections closed on a timeout
+	histogram_t rounds;			 // time in ns from a response until the
+								 // next shot arrived, of this interval
+	histogram_t service;		 // time in ns from reading a shot until its
+								 // response was sent, of this interval
+} metrics_t;
+
+/**
+ * @brief replace the metrics file by the current metrics
+ * @param path the path of the metrics file
+ * @param metrics the current metrics
+ * @param interval_shots the shots handled since the previous write
+ * @param interval_ns the time since the previous write in ns
+ * @return 0 on success, -1 on failure with errno set
+ */
+int write_metrics(const char *path,
+				  const metrics_t *metrics,
+				  uint64_t interval_shots,
+				  uint64_t interval_ns);
+
+#endif  // METRICS_H
@@ -16,15 +16,39 @@
 typedef uint16_t client_msg_t;
 typedef uint8_t server_msg_t;
 
-#define PARITY_BIT 0x800  // bitmask of the parity bit
-#define PARITY_POS 15	 // position of the parity bit
+#define PARITY_BIT 0x8000  // bitmask of the parity bit
+#define PARITY_POS 15	  // position of the parity bit
+
+#define OPCODE_OFFSET 12  // position of the opcode
+#define OPCODE_BITS 0x7   // bitmask of the opcode after shifting
+
+/**
+ * @brief the kind of a client message
+ * @details a shot is answered with a single server message. A new game is not
+ * answered, so the first shot of the game may be sent right after it. It
+ * abandons the game in progress, if any, and starts over on the same fleet.
+ *
+ * A rules message proposes the rules of the following games, usually right
+ * after connecting. Its parameters are the map size and the number of ships
+ * messages following it, each of which adds ships of one length. The last
+ * ships message is answered with game_ongoing if the server starts a new game
+ * with these rules, or with game_over if it cannot play them, in which case
+ * the previous rules stay in effect.
+ */
+typedef enum
+{
+	op_shot = 0,	  // shoot at the coordinates of the message
+	op_new_game = 1,  // start a new game on the same connection
+	op_rules = 2,	  // propose rules: map size and number of ships messages
+	op_ships = 3	  // ships of proposed rules: length and number of ships
+} opcode_t;
 
 /**
  * @brief calculate the parity bit for the given message
- * @details counts the number of 1 bits in the message and returns 1 if it was
- * odd and 0 if it was even. Therefore the return value can be used to set the
- * parity of the message. If a parity bit is already set for the message it is
- * ignored.
+ * @details folds the message onto its lowest 4 bits and looks their parity
+ * up, which is 1 if the number of 1 bits was odd and 0 if it was even.
+ * Therefore the return value can be used to set the parity of the message.
+ * If a parity bit is already set for the message it is ignored.
  */
 uint8_t calc_parity_bit(client_msg_t msg);
 
@@ -61,6 +85,46 @@ client_msg_t set_parity_bit(client_msg_t msg, client_msg_t parity_bit);
  */
 coordinate_t get_coordinates(client_msg_t msg);
 
+/**
+ * @brief get the opcode of a message
+ * @param msg the message to be parsed
+ * @return the opcode of the message
+ */
+opcode_t get_opcode(client_msg_t msg);
+
+/**
+ * @brief create a shot message with the correct parity bit
+ * @param c the coordinate to shoot at
+ * @return the message to send
+ */
+client_msg_t get_shot_msg(coordinate_t c);
+
+/**
+ * @brief create a message without coordinates with the correct parity bit
+ * @param opcode the opcode of the message
+ * @return the message to send
+ */
+client_msg_t get_control_msg(opcode_t opcode);
+
+/**
+ * @brief create a message with two parameters with the correct parity bit
+ * @details the parameters take the places of the row and the column of a
+ * shot, each holding a value from 1 to 64.
+ * @param opcode the opcode of the message
+ * @param first the first parameter
+ * @param second the second parameter
+ * @return the message to send
+ */
+client_msg_t get_param_msg(opcode_t opcode, uint8_t first, uint8_t second);
+
+/**
+ * @brief get the parameters of a message created by get_param_msg()
+ * @param msg the message to be parsed
+ * @param first the first parameter is stored into this parameter
+ * @param second the second parameter is stored into this parameter
+ */
+void get_params(client_msg_t msg, uint8_t *first, uint8_t *second);
+
 /**
  * @brief get the hit report from the servers response
  * @param msg the response message from the server
@@ -0,0 +1,47 @@
+/**
+ * @file rng.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-21
+ *
+ * @brief A small seedable pseudo random number generator (xoshiro256**).
+ * @details Each user keeps its own state, so threads never share a generator
+ * and runs with the same seed are reproducible.
+ */
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+/**
+ * @brief the state of a random number generator
+ */
+typedef struct
+{
+	uint64_t s[4];
+} rng_t;
+
+/**
+ * @brief seed the given generator
+ * @details the seed is expanded with splitmix64, so any value, including 0,
+ * yields a valid state
+ * @param rng the generator to seed
+ * @param seed the seed
+ */
+void seed_rng(rng_t *rng, uint64_t seed);
+
+/**
+ * @brief get the next 64 random bits of the generator
+ * @param rng the generator to advance
+ * @return a uniformly distributed 64 bit value
+ */
+uint64_t next_random(rng_t *rng);
+
+/**
+ * @brief get a random number below the given bound
+ * @param rng the generator to advance
+ * @param bound the exclusive upper bound, has to be greater than 0
+ * @return a number in [0, bound)
+ */
+uint32_t random_below(rng_t *rng, uint32_t bound);
+
+#endif  // RNG_H
@@ -0,0 +1,107 @@
+/**
+ * @file rules.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Rule sets of OSUE exercise 1B `Battleship'.
+ * @details A rule set fixes the size of the map and the number of ships of
+ * each length. Rule sets are written as `SIZE:COUNTxLENGTH,...', the classic
+ * rules are `10:2x2,3x3,1x4'. A client may propose a rule set to the server
+ * at connect, see op_rules.
+ */
+#ifndef RULES_H
+#define RULES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common.h"
+#include "msg.h"
+
+// the classic rules, played if no others were negotiated
+#define CLASSIC_RULES "10:2x2,3x3,1x4"
+
+// maximum number of ships messages of a rule set, limited by the 6 bits
+// holding their number in the rules message
+#define MAX_SHIP_CLASSES 64
+// maximum number of ships of one length per ships message
+#define MAX_CLASS_SHIPS 64
+// maximum number of messages needed to propose a rule set
+#define MAX_RULES_MSGS (1 + MAX_SHIP_CLASSES)
+// length of a formatted rule set, including the terminating null byte
+#define RULES_LINE_LEN 512
+
+/**
+ * @brief the rules of a game
+ */
+typedef struct
+{
+	uint8_t map_size;		// length of each side of the map
+	uint8_t min_ship_len;   // length of the shortest ship
+	uint8_t max_ship_len;   // length of the longest ship
+	uint16_t ship_cnt;		// number of ships in total
+	uint16_t max_rounds;	// rounds after which the client loses the game
+	uint16_t ship_counts[MAX_MAP_SIZE + 1];  // number of ships of each length
+} rules_t;
+
+extern const rules_t classic_rules;
+
+/**
+ * @brief start a rule set without any ships
+ * @param rules the rule set to initialize
+ * @param map_size the length of each side of the map, at most MAX_MAP_SIZE
+ */
+void clear_rules(rules_t *rules, uint8_t map_size);
+
+/**
+ * @brief add ships of one length to a rule set
+ * @param rules the rule set to extend
+ * @param length the length of the ships, between MIN_SHIP_LEN and the map size
+ * @param count the number of ships
+ * @return 0 on success, -1 if the length does not fit the map
+ */
+int add_ships(rules_t *rules, uint8_t length, uint16_t count);
+
+/**
+ * @brief complete a rule set after all ships were added
+ * @details computes the totals and the round limit, which is 4/5 of the
+ * squares of the map as in the classic rules, or all of them if the ships
+ * cover more.
+ * @param rules the rule set to complete
+ * @return 0 if the rule set is playable, -1 if it holds no ships, more ship
+ * squares than the map or cannot be proposed in MAX_RULES_MSGS messages
+ */
+int finish_rules(rules_t *rules);
+
+/**
+ * @brief parse a rule set of the form `SIZE:COUNTxLENGTH,...'
+ * @param str the string to parse
+ * @param rules the parsed rule set is stored into this parameter
+ * @return 0 if the string denotes a playable rule set, -1 otherwise
+ */
+int parse_rules(const char *str, rules_t *rules);
+
+/**
+ * @brief format a rule set in the form accepted by parse_rules()
+ * @param rules the rule set to format
+ * @param buf a buffer of at least RULES_LINE_LEN characters
+ */
+void format_rules(const rules_t *rules, char *buf);
+
+/**
+ * @brief check whether two rule sets are equal
+ * @return true if the map size and the ships of each length are equal
+ */
+bool same_rules(const rules_t *a, const rules_t *b);
+
+/**
+ * @brief encode the messages proposing a rule set to the server
+ * @details a rules message followed by one ships message per length, lengths
+ * with more than MAX_CLASS_SHIPS ships take several.
+ * @param rules a completed rule set
+ * @param msgs a buffer of at least MAX_RULES_MSGS messages
+ * @return the number of messages
+ */
+int encode_rules(const rules_t *rules, client_msg_t *msgs);
+
+#endif  // RULES_H
@@ -0,0 +1,52 @@
+/**
+ * @file server_uring.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief The io_uring event loop of the server of OSUE exercise 1B
+ * `Battleship'.
+ * @details A multishot accept and a multishot receive per connection keep
+ * delivering completions without being submitted again, and the receives
+ * pick their buffers from the provided ones of the ring. The responses to
+ * the requests of each completion are sent by a single send, so a round
+ * costs no system call of its own: all operations are submitted and their
+ * completions reaped by one io_uring_enter() per iteration of the loop.
+ * These sends are not linked to anything, only the last send of a closing
+ * connection is hard linked to its close. Connections the accept delivers
+ * while the pool is exhausted wait for a released session.
+ */
+#ifndef SERVER_URING_H
+#define SERVER_URING_H
+
+#include "session.h"
+
+/**
+ * @brief the operations of the io_uring loop, valid once it is set up
+ */
+extern const event_loop_t uring_loop;
+
+/**
+ * @brief set up the ring of the loop and its provided buffers
+ * @param sock_fd the listening socket
+ * @param callbacks the functions of the server the loop reports to, they
+ * must stay valid until the loop is freed
+ * @return 0 on success, -1 on failure with errno set, to EOPNOTSUPP if the
+ * kernel lacks a feature the loop relies on
+ */
+int init_uring_loop(int sock_fd, const session_callbacks_t *callbacks);
+
+/**
+ * @brief serve connections through the ring until the server exits
+ * @details the session timeouts and the metrics are expected to be set up
+ * already.
+ * @return -1 with errno set, if accepting or waiting for completions failed
+ */
+int run_uring_loop(void);
+
+/**
+ * @brief tear down the ring, cancelling all operations in progress
+ * @details may be called if the loop was never set up.
+ */
+void free_uring_loop(void);
+
+#endif  // SERVER_URING_H
@@ -0,0 +1,114 @@
+/**
+ * @file session.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief The sessions of the server of OSUE exercise 1B `Battleship' and
+ * the interface between the server and its event loops.
+ * @details The server plays the games of the sessions regardless of how
+ * their requests arrived. An event loop moves the bytes between the
+ * connections and the buffers of the sessions: it reports to the server
+ * through the session callbacks, and the server sends and closes through
+ * the operations of the loop.
+ */
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "common.h"
+#include "fleet.h"
+#include "map.h"
+#include "rules.h"
+#include "sockbuf.h"
+#include "channel.h"
+#include "gamelog.h"
+#include "timerwheel.h"
+
+/**
+ * @brief the state of a single connection and the game played on it
+ */
+typedef struct session
+{
+	uint32_t id;						 // the connection's id in traces
+	int fd;								 // the connection's file descriptor
+	channel_t *channel;					 // the shared memory channel, if the
+										 // session does not use a socket
+	bool playing;						 // true while a game is in progress
+	uint16_t round;						 // number of shots taken so far
+	sockbuf_t io;						 // buffers of the socket
+	bool writing;						 // responses wait for the socket to
+										 // become writable, reading pauses
+	rules_t rules;						 // the rules of the session's games
+	rules_t proposal;					 // rules proposed by the client
+	uint8_t classes_left;				 // ships messages of the proposal
+										 // still expected, 0 if none
+	bool proposal_ok;					 // all ships of the proposal fit
+	shot_t *shots;						 // every shot of the game and its
+										 // response, for the game log
+	fleet_t fleet;						 // the ships of the map
+	map_t *map;							 // the map of this game
+	timeout_t timeout;					 // closes the connection if the
+										 // client stalls
+	uint64_t responded;					 // time the last responses were
+										 // sent in ns, 0 if none yet
+	uint16_t sending;					 // bytes of the write buffer being
+										 // sent by io_uring
+	uint8_t pending;					 // io_uring operations in progress
+	bool receiving;						 // a multishot receive is armed
+	bool closing;						 // the connection is being closed
+										 // by io_uring
+	bool close_queued;					 // the close was submitted
+	struct session *prev, *next;		 // list of all open sessions, or of
+										 // the unused ones in the pool
+} session_t;
+
+/**
+ * @brief the functions of the server an event loop reports to
+ */
+typedef struct
+{
+	// start a game on an accepted connection, NULL if the session's storage
+	// could not be restored
+	session_t *(*open)(int fd);
+	// true if the pool has a session for another connection
+	bool (*can_open)(void);
+	// handle the complete requests in the read buffer, -1 to close
+	int (*handle_buffered)(session_t *session);
+	// handle the end of the stream of a connection, -1 to close
+	int (*handle_eof)(session_t *session);
+	// close the connection of a session through the loop
+	void (*close)(session_t *session);
+	// return a session whose connection was closed to the pool
+	void (*release)(session_t *session);
+	// expire the timeouts and write the metrics, whichever is due
+	void (*tick)(void);
+	// the time the loop may wait for events in ms, -1 for no limit
+	int (*get_wait_time)(void);
+	// count a finished game, may exit
+	void (*finish_game)(int status);
+	// print an error and the message of errno
+	void (*print_err)(char *msg);
+	unsigned long long *syscalls;  // counts the system calls of the loop
+} session_callbacks_t;
+
+/**
+ * @brief the operations of an event loop the server sends and closes through
+ */
+typedef struct
+{
+	// send the buffered responses of a session, 0 if they were sent or
+	// stay buffered, -1 if sending failed
+	int (*flush)(session_t *session);
+	// close the connection of a session, which was already removed from
+	// the open ones, and release it once done
+	void (*close)(session_t *session);
+	// accept connections again after a session was released
+	void (*resume)(void);
+	// send the responses still buffered by the sessions before exiting,
+	// giving up after timeout ms
+	void (*drain)(session_t *sessions, int timeout);
+} event_loop_t;
+
+#endif  // SESSION_H
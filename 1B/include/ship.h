@@ -10,6 +10,9 @@
 
 #include "common.h"
 
+// longest formatted ship, e.g. `BJ61BL61'
+#define SHIP_STR_LEN (2 * COORDINATE_LEN)
+
 typedef enum
 {
 	horizontal = 0,
@@ -18,12 +21,39 @@ typedef enum
 
 typedef struct
 {
-	const coordinate_t begin;
-	const coordinate_t end;
-	const uint8_t length;
-	const alignment_t alignment;
+	coordinate_t begin;
+	coordinate_t end;
+	uint8_t length;
+	alignment_t alignment;
 } ship_t;
 
-ship_t* parse_coordinates(const char* coordinate_str);
+/**
+ * @brief parse a ship from a string of the form `C2E2', denoting the column
+ * and row of its begin and end
+ * @details columns are letters counted like in spreadsheets, A to Z followed
+ * by AA to AZ and so on, rows are decimal numbers starting at 0. On the
+ * classic map every coordinate is a single letter and digit.
+ * @param coordinate_str the string to parse
+ * @param ship the parsed ship is stored into this parameter
+ * @param map_size the length of each side of the map
+ * @return 0 if the string denotes a valid ship, -1 otherwise
+ */
+int parse_ship(const char* coordinate_str, ship_t* ship, uint8_t map_size);
+
+/**
+ * @brief format a ship in the form accepted by parse_ship()
+ * @param ship the ship to format
+ * @param buf a buffer of at least SHIP_STR_LEN + 1 characters
+ * @return the number of characters written, without the terminating null byte
+ */
+int format_ship(const ship_t* ship, char* buf);
+
+/**
+ * @brief format a coordinate in the form used by parse_ship()
+ * @param c the coordinate to format
+ * @param buf a buffer of at least COORDINATE_LEN + 1 characters
+ * @return the number of characters written, without the terminating null byte
+ */
+int format_coordinate(coordinate_t c, char* buf);
 
 #endif  // SHIP_H
\ No newline at end of file
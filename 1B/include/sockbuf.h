@@ -0,0 +1,148 @@
+/**
+ * @file sockbuf.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Buffered socket I/O for OSUE exercise 1B `Battleship'.
+ * @details A socket buffer reads ahead as much as the socket holds and
+ * collects outgoing messages until they are flushed explicitly, so a batch of
+ * messages costs a single system call in each direction. Flushing is up to
+ * the user: before waiting for a response and after handling all requests
+ * read at once. Works on blocking and non-blocking sockets.
+ */
+#ifndef SOCKBUF_H
+#define SOCKBUF_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+// capacity of the read and of the write buffer in bytes
+#define SOCKBUF_LEN 512
+
+/**
+ * @brief a socket with a read and a write buffer
+ */
+typedef struct
+{
+	int fd;						// the socket
+	uint16_t rpos;				// first unread byte of rbuf
+	uint16_t rlen;				// end of the data in rbuf
+	uint16_t wlen;				// bytes in wbuf waiting to be flushed
+	unsigned long syscalls;		// system calls made on the socket
+	uint8_t rbuf[SOCKBUF_LEN];  // data read but not consumed yet
+	uint8_t wbuf[SOCKBUF_LEN];  // data written but not flushed yet
+} sockbuf_t;
+
+/**
+ * @brief attach empty buffers to a socket
+ * @param sb the socket buffer to initialize
+ * @param fd the socket
+ */
+void init_sockbuf(sockbuf_t *sb, int fd);
+
+/**
+ * @brief enable or disable Nagle's algorithm of a TCP socket
+ * @details a buffered socket flushes whole batches, so Nagle's algorithm
+ * only delays them. Other sockets are left alone.
+ * @param fd the socket
+ * @param enable true to send every segment right away
+ * @return 0 on success, -1 on failure with errno set
+ */
+int set_nodelay(int fd, bool enable);
+
+/**
+ * @brief cork or uncork a TCP socket
+ * @details a corked socket only sends full segments, so data flushed in
+ * several parts leaves the host in as few segments as possible once the
+ * socket is uncorked. Other sockets are left alone.
+ * @param fd the socket
+ * @param enable true to cork the socket, false to send what is held back
+ * @return 0 on success, -1 on failure with errno set
+ */
+int set_cork(int fd, bool enable);
+
+/**
+ * @brief read as much as fits into the read buffer with a single call
+ * @details unread data is moved to the front of the buffer first.
+ * @param sb the socket buffer
+ * @return the number of bytes read, 0 at the end of the stream, -1 on failure
+ * with errno set, e.g. to EAGAIN or to ENOBUFS if the buffer is full
+ */
+ssize_t fill_sockbuf(sockbuf_t *sb);
+
+/**
+ * @brief read exactly len bytes, blocking until they arrived
+ * @details pending output is flushed first, as the peer may wait for it.
+ * @param sb the socket buffer of a blocking socket
+ * @param buf the bytes are stored into this buffer
+ * @param len the number of bytes to read, at most SOCKBUF_LEN
+ * @return 0 on success, -1 on failure or at the end of the stream
+ */
+int read_sockbuf(sockbuf_t *sb, void *buf, size_t len);
+
+/**
+ * @brief append data received without the socket buffer, e.g. by io_uring,
+ * to the read buffer
+ * @details unread data is moved to the front of the buffer first.
+ * @param sb the socket buffer
+ * @param buf the received data
+ * @param len the number of bytes received
+ * @return 0 on success, -1 with errno set to ENOBUFS if they do not fit
+ */
+int append_sockbuf(sockbuf_t *sb, const void *buf, size_t len);
+
+/**
+ * @brief get the unread data of the read buffer
+ * @param sb the socket buffer
+ * @param len the number of unread bytes is stored into this parameter
+ * @return the first unread byte
+ */
+const uint8_t *peek_sockbuf(const sockbuf_t *sb, size_t *len);
+
+/**
+ * @brief mark data returned by peek_sockbuf() as read
+ * @param sb the socket buffer
+ * @param len the number of bytes consumed
+ */
+void consume_sockbuf(sockbuf_t *sb, size_t len);
+
+/**
+ * @brief get the free space of the write buffer
+ * @param sb the socket buffer
+ * @return the number of bytes that can be written without a system call
+ */
+size_t get_sockbuf_space(const sockbuf_t *sb);
+
+/**
+ * @brief append data to the write buffer
+ * @details data that does not fit is sent together with the buffered data in
+ * a single gathering call, sendmsg() with two I/O vectors like writev(). On a
+ * non-blocking socket whatever could not be sent stays in the buffer, if it
+ * fits, otherwise the call fails with EAGAIN.
+ * @param sb the socket buffer
+ * @param buf the data to write
+ * @param len the number of bytes to write
+ * @return 0 on success, -1 on failure with errno set
+ */
+int write_sockbuf(sockbuf_t *sb, const void *buf, size_t len);
+
+/**
+ * @brief remove data sent without the socket buffer, e.g. by io_uring, from
+ * the front of the write buffer
+ * @param sb the socket buffer
+ * @param len the number of bytes sent, at most the buffered ones
+ */
+void drop_sockbuf(sockbuf_t *sb, size_t len);
+
+/**
+ * @brief send the data of the write buffer
+ * @details a blocking socket sends all of it, a non-blocking socket as much as
+ * it accepts right now.
+ * @param sb the socket buffer
+ * @return the number of bytes still buffered, -1 on failure with errno set
+ */
+ssize_t flush_sockbuf(sockbuf_t *sb);
+
+#endif  // SOCKBUF_H
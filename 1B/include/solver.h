@@ -12,6 +12,15 @@
 
 #include "../include/map.h"
 #include "../include/ship.h"
+#include "../include/deque.h"
+#include "../include/rng.h"
+#include "../include/rules.h"
+#include "../include/heatmap.h"
+#include "../include/density.h"
+
+// number of density levels of a prior, squares of the same level are
+// considered equally likely
+#define PRIOR_LEVELS 16
 
 /**
  * @brief a type to describe a direction on the map, by steps in row and column
@@ -30,17 +39,126 @@ extern const direction_t left;
 extern const direction_t right;
 
 /**
- * @brief initialize the solver with an empty map and set all internal state
+ * @brief the squares of the map that were not targeted yet, partitioned into
+ * the classes (row + col) % modulus
+ * @details each class occupies a contiguous range of cells, squares are
+ * removed by swapping them with the last square of their class, so removing
+ * and drawing a random square of a class both take constant time. The arrays
+ * are sized to the map and point into the solver's storage.
+ */
+typedef struct
+{
+	uint8_t modulus;  // number of classes
+	coordinate_t *cells;  // the squares, grouped by class
+	uint16_t *pos;		  // position of each square in cells, by index
+						  // row * map size + col
+	uint16_t *start;  // first position of each class
+	uint16_t *size;   // unknown squares left in each class
+} candidate_set_t;
+
+/**
+ * @brief the state of a single game as seen by the solver
+ * @details every game is tracked by its own solver, so one process can drive
+ * any number of games at once, as long as each solver is only used by one
+ * thread at a time.
+ */
+typedef struct
+{
+	rules_t rules;				 // the rules of the games played
+	map_t *map;					 // the hit states recorded so far
+	deque_t target_queue;		 // coordinates to try while sinking a ship
+	deque_t hit_queue;			 // hits on the ship currently being sunk
+	uint16_t ship_counts[MAX_MAP_SIZE + 1];  // remaining ships per length
+	bool endgame;				 // the remaining ships are few enough for
+								 // the endgame table, see endgame.h
+	bool scan_mode;				 // true if no ship is currently being sunk
+	rng_t rng;					 // the solver's own random generator
+	// the unknown squares, partitioned for the length of each ship class as
+	// parity modulus
+	uint8_t set_cnt;
+	uint8_t set_index[MAX_MAP_SIZE + 1];  // set of each ship length
+	candidate_set_t *candidates;
+	uint16_t *storage;	// the arrays of all candidate sets, followed by a
+						// copy of them holding every square
+	size_t storage_words;  // number of words of the arrays
+	uint8_t *prior;		   // density level of each square by index
+						   // row * map size + col, NULL without a prior
+	uint32_t budget;	   // time per move in microseconds, 0 to fire by
+						   // the scan and target modes alone
+	density_t *density;	   // the workspace of the budgeted moves
+	bitboard_t sunk;	   // the squares of the ships sunk so far
+} solver_t;
+
+/**
+ * @brief create a new solver with an empty map and set all internal state
  * ready for use
- * @details sets the current hit count to 0, initializes the random number
- * generator, creates an empty map and stack
+ * @details sets the current hit count to 0, seeds the solver's own random
+ * number generator, creates an empty map and stack sized to the rules
+ * @param rules the rules of the games the solver plays
+ * @param seed the seed for the random number generator of the solver
+ * @return a pointer to the new solver, NULL on failure
+ */
+solver_t *get_solver(const rules_t *rules, uint64_t seed);
+
+/**
+ * @brief reset the solver for a new game, keeping its random number generator
+ * state
+ * @param solver the solver to reset
+ */
+void reset_solver(solver_t *solver);
+
+/**
+ * @brief let the scan mode of the solver prefer the squares a heatmap marks
+ * as dense
+ * @details the counts of the heatmap are quantized into PRIOR_LEVELS levels
+ * relative to the densest square. Scan mode fires at a square of the highest
+ * level left in its parity class, picked at random among those. Without a
+ * prior it picks any square of the class at random.
+ * @param solver the solver to configure
+ * @param heatmap the heatmap, which may be closed afterwards. NULL removes the
+ * prior.
+ * @return 0 on success, -1 if the heatmap is of another map size or
+ * allocating failed
+ */
+int set_prior(solver_t *solver, const heatmap_t *heatmap);
+
+/**
+ * @brief let the solver spend a time budget on every move to fire at the
+ * square most likely holding a ship
+ * @details each move estimates the density of the unknown squares, see
+ * estimate_density(), counting all fleets consistent with the shots so far
+ * when few ships remain and sampling them otherwise, and fires at the densest
+ * square found when the budget is used up. If no consistent fleet was found
+ * in time the move falls back to the scan and target modes. A larger budget
+ * needs fewer rounds per game at a higher latency per round.
+ * @param solver the solver to configure
+ * @param budget the time per move in microseconds, 0 to fire by the scan and
+ * target modes alone
+ * @param threads the number of threads sampling fleets within the budget,
+ * between 1 and MAX_SAMPLERS. The budget is the same however many there are,
+ * more threads sample more fleets in it.
+ * @return 0 on success, -1 if allocating failed
+ */
+int set_budget(solver_t *solver, uint32_t budget, uint16_t threads);
+
+/**
+ * @brief let the solver spend the budget of another one on every move,
+ * sampling fleets on the threads of the other one
+ * @details the threads are only stopped once both solvers are freed, or
+ * their budgets changed. The solvers must not move at the same time, e.g.
+ * because they play their games from the same thread.
+ * @param solver the solver to configure
+ * @param other a solver configured by set_budget(), a budget of 0 turns the
+ * solver's budget off as well
+ * @return 0 on success, -1 if allocating failed
  */
-void init_solver(void);
+int share_budget(solver_t *solver, solver_t *other);
 
 /**
  * @brief free all resources of the solver
+ * @param solver the solver to free, may be NULL
  */
-void free_solver(void);
+void free_solver(solver_t *solver);
 
 /**
  * @brief based on the internal state and the provided information calculate the
@@ -48,10 +166,14 @@ void free_solver(void);
  * @details first record the given hit information on the internal map and then
  * go either in target(trying to sink a ship) or scan mode(firing randomly with
  * a checkerboard pattern).
+ * @param solver the solver tracking the game
  * @param coordinate the coordinate of the last shot taken
  * @param hit_report the server feedback of the last shot
  */
-coordinate_t next_move(coordinate_t coordinate, hit_report_t hit_report);
+coordinate_t next_move(
+	solver_t *solver,
+	coordinate_t coordinate,
+	hit_report_t hit_report);
 
 
 #endif
\ No newline at end of file
@@ -0,0 +1,94 @@
+/**
+ * @file timerwheel.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief A hashed timer wheel for the timeouts of many connections of OSUE
+ * exercise 1B `Battleship'.
+ * @details Time is counted in ticks of a length chosen by the user. Each
+ * timeout is linked into the slot of the tick it expires at, modulo the
+ * number of slots, so arming, re-arming and disarming take constant time
+ * and no memory is allocated. Timeouts further away than one revolution of
+ * the wheel share a slot with nearer ones and are skipped until they are due.
+ */
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// number of slots of a wheel, a power of two
+#define WHEEL_SLOTS 512
+
+/**
+ * @brief a timeout, embedded into what it times out
+ */
+typedef struct timeout
+{
+	uint64_t expiry;			  // tick the timeout expires at
+	void *owner;				  // what times out, set by the user
+	struct timeout *prev, *next;  // the other timeouts of the slot, NULL if
+								  // the timeout is not armed
+} timeout_t;
+
+/**
+ * @brief the armed timeouts, by the slot of their expiry
+ */
+typedef struct
+{
+	uint64_t tick;					// the tick being expired, the slots of the
+									// earlier ones hold no expired timeouts
+	size_t armed;					// number of armed timeouts
+	timeout_t slots[WHEEL_SLOTS];	// list heads of the slots
+} timerwheel_t;
+
+/**
+ * @brief initialize an empty wheel
+ * @param wheel the wheel to initialize
+ * @param now the current tick
+ */
+void init_wheel(timerwheel_t *wheel, uint64_t now);
+
+/**
+ * @brief initialize a timeout that is not armed
+ * @param timeout the timeout to initialize
+ * @param owner what times out
+ */
+void init_timeout(timeout_t *timeout, void *owner);
+
+/**
+ * @brief check if a timeout is armed
+ * @param timeout an initialized timeout
+ * @return true if it is linked into a wheel
+ */
+bool is_armed(const timeout_t *timeout);
+
+/**
+ * @brief arm a timeout, or move it to a new expiry if it is armed already
+ * @details a timeout expiring before the current tick of the wheel expires
+ * with the current tick.
+ * @param wheel the wheel to arm the timeout on
+ * @param timeout an initialized timeout
+ * @param expiry the tick the timeout expires at
+ */
+void arm_timeout(timerwheel_t *wheel, timeout_t *timeout, uint64_t expiry);
+
+/**
+ * @brief disarm a timeout, does nothing if it is not armed
+ * @param wheel the wheel the timeout is armed on
+ * @param timeout an initialized timeout
+ */
+void disarm_timeout(timerwheel_t *wheel, timeout_t *timeout);
+
+/**
+ * @brief advance the wheel and disarm the next expired timeout
+ * @details call repeatedly until it returns NULL. Each slot is visited at
+ * most once per call however long the wheel was not advanced.
+ * @param wheel the wheel to advance
+ * @param now the current tick
+ * @return a timeout expiring at or before now, NULL if there is none
+ */
+timeout_t *pop_expired(timerwheel_t *wheel, uint64_t now);
+
+#endif  // TIMERWHEEL_H
@@ -0,0 +1,101 @@
+/**
+ * @file trace.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-26
+ *
+ * @brief Binary event tracing for OSUE exercise 1B `Battleship'.
+ * @details Events have a fixed size and are written without any formatting
+ * into a ring per thread. The rings live in a memory mapped trace file, so the
+ * last TRACE_RING_EVENTS events of every thread survive even a crash. The file
+ * is decoded offline by the tracedump program.
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+#include "common.h"
+
+// magic number at the start of a trace file
+#define TRACE_MAGIC "BSTRACE1"
+// number of events of a ring, has to be a power of two
+#define TRACE_RING_EVENTS 65536
+// maximum number of tracing threads
+#define TRACE_MAX_RINGS 16
+
+/**
+ * @brief the kinds of events
+ */
+typedef enum
+{
+	trace_connect = 1,   // a client connected
+	trace_new_game = 2,  // a client started a new game on its connection
+	trace_shot = 3,		 // a request was answered, msg holds the response
+	trace_close = 4		 // a connection was closed
+} trace_type_t;
+
+/**
+ * @brief a single event
+ */
+typedef struct
+{
+	uint64_t time;	// CLOCK_MONOTONIC timestamp in ns
+	uint32_t conn;	// id of the connection
+	uint16_t round;   // round of the game on the connection
+	uint8_t type;	 // a trace_type_t
+	uint8_t msg;	  // the server's response of a shot
+	uint8_t row;	  // coordinate of a shot
+	uint8_t col;
+	uint8_t reserved[6];
+} trace_event_t;
+
+/**
+ * @brief the header of a trace file
+ */
+typedef struct
+{
+	char magic[8];		  // TRACE_MAGIC
+	uint32_t ring_cnt;	  // number of rings following the header
+	uint32_t ring_events;   // number of events of each ring
+	uint32_t event_size;	// sizeof(trace_event_t)
+	uint32_t reserved[11];  // pads the header to 64 bytes
+} trace_header_t;
+
+/**
+ * @brief the ring of a single thread as stored in the trace file
+ */
+typedef struct
+{
+	uint64_t head;		   // number of events ever written to the ring
+	uint64_t reserved[7];  // pads the ring header to 64 bytes
+	trace_event_t events[TRACE_RING_EVENTS];
+} trace_ring_t;
+
+/**
+ * @brief create the trace file and enable tracing
+ * @details has to be called before any thread records an event. Without it
+ * trace_record() does nothing.
+ * @param path the path of the trace file, it is truncated if it exists
+ * @return 0 on success, -1 on failure with errno set
+ */
+int open_trace(const char *path);
+
+/**
+ * @brief disable tracing and unmap the trace file
+ */
+void close_trace(void);
+
+/**
+ * @brief record an event into the ring of the calling thread
+ * @details the first event of a thread claims a ring, threads beyond
+ * TRACE_MAX_RINGS are not traced.
+ * @param type the kind of event
+ * @param conn the id of the connection
+ * @param round the round of the game
+ * @param c the coordinate of a shot, ignored for other events
+ * @param msg the response to a shot, ignored for other events
+ */
+void trace_record(
+	trace_type_t type, uint32_t conn, uint16_t round, coordinate_t c, uint8_t msg);
+
+#endif  // TRACE_H
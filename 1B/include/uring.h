@@ -0,0 +1,178 @@
+/**
+ * @file uring.h
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief A minimal io_uring instance for the server of OSUE exercise 1B
+ * `Battleship'.
+ * @details The ring is set up with plain system calls, liburing is not
+ * needed: both queues are mapped into memory, operations are prepared in
+ * the submission queue and submitted together with waiting for completions
+ * in a single io_uring_enter() call. Receives pick their buffer from a ring
+ * of provided buffers registered with the kernel, so a multishot receive
+ * keeps delivering data without being submitted again. Requires Linux 6.0,
+ * init_uring() fails with EOPNOTSUPP on older kernels.
+ */
+#ifndef URING_H
+#define URING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <linux/io_uring.h>
+
+// buffer group of the provided buffers
+#define URING_BUF_GROUP 0
+
+/**
+ * @brief an io_uring instance and its provided buffers
+ */
+typedef struct
+{
+	int fd;							 // the ring, -1 if not set up
+	unsigned long syscalls;			 // system calls made on the ring
+	void *sq_ring;					 // mapping of the submission queue
+	size_t sq_ring_size;
+	void *cq_ring;					 // mapping of the completion queue, the
+									 // same as sq_ring with a single mapping
+	size_t cq_ring_size;
+	struct io_uring_sqe *sqes;		 // the submission queue entries
+	size_t sqes_size;
+	unsigned *sq_tail;				 // shared with the kernel
+	unsigned *sq_head;
+	unsigned *sq_array;
+	unsigned sq_mask;
+	unsigned sq_entries;
+	unsigned sqe_tail;				 // end of the prepared entries
+	unsigned sqe_submitted;			 // end of the submitted entries
+	unsigned *cq_head;				 // shared with the kernel
+	unsigned *cq_tail;
+	unsigned cq_mask;
+	struct io_uring_cqe *cqes;
+	struct io_uring_buf_ring *buf_ring;  // the provided buffers, NULL if
+										 // none are registered
+	size_t buf_ring_size;
+	uint8_t *bufs;					 // storage of the provided buffers
+	unsigned buf_cnt;				 // number of provided buffers
+	unsigned buf_len;				 // length of each of them
+	uint16_t buf_tail;				 // end of the buffers given to the kernel
+} uring_t;
+
+/**
+ * @brief set up a ring
+ * @param ring the ring to initialize
+ * @param entries the number of submission queue entries, a power of two, the
+ * completion queue holds four times as many
+ * @return 0 on success, -1 on failure with errno set, to EOPNOTSUPP if the
+ * kernel lacks a feature the server relies on
+ */
+int init_uring(uring_t *ring, unsigned entries);
+
+/**
+ * @brief register the provided buffers of a ring
+ * @param ring a ring without provided buffers
+ * @param cnt the number of buffers, a power of two of at most 32768
+ * @param len the length of each buffer
+ * @return 0 on success, -1 on failure with errno set
+ */
+int add_buffers(uring_t *ring, unsigned cnt, unsigned len);
+
+/**
+ * @brief tear down a ring, cancelling all operations in progress
+ * @param ring the ring to free, may be set up or zeroed with fd -1
+ */
+void free_uring(uring_t *ring);
+
+/**
+ * @brief get an empty submission queue entry
+ * @details submits the prepared entries first if the queue is full.
+ * @param ring the ring
+ * @return the zeroed entry, NULL on failure with errno set
+ */
+struct io_uring_sqe *get_sqe(uring_t *ring);
+
+/**
+ * @brief submit the prepared entries and wait for completions
+ * @param ring the ring
+ * @param wait the number of completions to wait for, 0 to return right away
+ * @param timeout the maximum time to wait in milliseconds, -1 for no limit
+ * @return 0 on success, -1 on failure with errno set, to ETIME if the timeout
+ * expired or EINTR if a signal arrived first
+ */
+int submit_uring(uring_t *ring, unsigned wait, int timeout);
+
+/**
+ * @brief get the oldest completion not marked as seen
+ * @param ring the ring
+ * @return the completion, NULL if there is none
+ */
+struct io_uring_cqe *peek_cqe(uring_t *ring);
+
+/**
+ * @brief mark the completion returned by peek_cqe() as seen
+ * @details the kernel may overwrite it afterwards.
+ * @param ring the ring
+ */
+void seen_cqe(uring_t *ring);
+
+/**
+ * @brief get the data of a provided buffer picked by a receive
+ * @param ring the ring
+ * @param bid the buffer id of the completion
+ * @return the start of the buffer
+ */
+const uint8_t *get_buffer(const uring_t *ring, uint16_t bid);
+
+/**
+ * @brief give a provided buffer back to the kernel
+ * @param ring the ring
+ * @param bid the buffer id of the completion it was picked by
+ */
+void return_buffer(uring_t *ring, uint16_t bid);
+
+/**
+ * @brief prepare accepting connections until cancelled
+ * @param sqe the entry to prepare
+ * @param fd the listening socket
+ * @param user_data identifies the completions, one per connection
+ */
+void prep_multishot_accept(struct io_uring_sqe *sqe, int fd, uint64_t user_data);
+
+/**
+ * @brief prepare receiving into provided buffers until cancelled
+ * @param sqe the entry to prepare
+ * @param fd the socket
+ * @param user_data identifies the completions, one per buffer filled
+ */
+void prep_multishot_recv(struct io_uring_sqe *sqe, int fd, uint64_t user_data);
+
+/**
+ * @brief prepare sending data
+ * @param sqe the entry to prepare
+ * @param fd the socket
+ * @param buf the data, it must stay unchanged until the send completed
+ * @param len the number of bytes to send
+ * @param user_data identifies the completion
+ */
+void prep_send(struct io_uring_sqe *sqe,
+			   int fd,
+			   const void *buf,
+			   size_t len,
+			   uint64_t user_data);
+
+/**
+ * @brief prepare closing a file descriptor
+ * @param sqe the entry to prepare
+ * @param fd the file descriptor
+ * @param user_data identifies the completion
+ */
+void prep_close(struct io_uring_sqe *sqe, int fd, uint64_t user_data);
+
+/**
+ * @brief prepare cancelling an operation
+ * @param sqe the entry to prepare
+ * @param target the user data of the operation to cancel
+ * @param user_data identifies the completion
+ */
+void prep_cancel(struct io_uring_sqe *sqe, uint64_t target, uint64_t user_data);
+
+#endif  // URING_H
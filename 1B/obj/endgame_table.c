@@ -0,0 +1,2739 @@
+/* Generated by endgames, do not edit. */
+#include "../include/endgame.h"
+
+// 4227 states
+const uint8_t endgame_bits = 14;
+
+const uint32_t endgame_table[] = {
+	0x00000000, 0x00000000, 0x00000000, 0x00181305, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175892, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015480c, 0x00000000,
+	0x00174924, 0x00000000, 0x00156100, 0x00000000, 0x00000000, 0x00000000,
+	0x00196330, 0x00000000, 0x0016d004, 0x00151040, 0x001b6448, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154229,
+	0x00000000, 0x00190305, 0x00174341, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0014c908, 0x00000000, 0x0016ca21, 0x00000000,
+	0x00000000, 0x001a2148, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00160042, 0x00000000, 0x00000000, 0x00000000, 0x001a0273, 0x001b5882,
+	0x00181a4c, 0x00000000, 0x001a1b64, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00260900, 0x00000000, 0x001b6208,
+	0x00000000, 0x00000000, 0x00000000, 0x0017506e, 0x00195186, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b4333, 0x00000000, 0x00195b0c, 0x00000000,
+	0x001b5c25, 0x00000000, 0x00154973, 0x00000000, 0x00190a4f, 0x00174a8a,
+	0x00000000, 0x00156264, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175411, 0x00000000,
+	0x00000000, 0x001a0033, 0x00000000, 0x0018180c, 0x0015438e, 0x001a1924,
+	0x00151b2c, 0x00000000, 0x00155c81, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00181228,
+	0x00000000, 0x001a1340, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0019080f, 0x0017484a, 0x00156024, 0x00194962, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b636c, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5401,
+	0x0015414e, 0x00000000, 0x0019022a, 0x00174266, 0x00000000, 0x00171a04,
+	0x00155a40, 0x00000000, 0x00000000, 0x00195c71, 0x00000000, 0x0016c946,
+	0x00000000, 0x00000000, 0x001a206e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00151309,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0014c24a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a1a8a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00180a04, 0x00000000, 0x00000000,
+	0x001b612c, 0x00000000, 0x00000000, 0x001a2410, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174026,
+	0x00000000, 0x00000000, 0x00155800, 0x00000000, 0x00000000, 0x00000000,
+	0x00195a30, 0x00000000, 0x001b5b48, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0015618a, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00251000,
+	0x00000000, 0x0014c00b, 0x0019544d, 0x00000000, 0x00000000, 0x00000000,
+	0x001a184a, 0x00000000, 0x00000000, 0x00171b68, 0x00274301, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0018114f, 0x00000000, 0x001a1264, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5908,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194886, 0x00000000,
+	0x00000000, 0x00180b6a, 0x00176060, 0x001a0c81, 0x00000000, 0x001b6292,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019520c, 0x00000000,
+	0x001b5324, 0x00000000, 0x00154073, 0x0017418a, 0x0019014f, 0x00000000,
+	0x00171928, 0x00155964, 0x00191a40, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00174b11, 0x00000000, 0x00194c29,
+	0x00000000, 0x00000000, 0x00176404, 0x00000000, 0x00000000, 0x00000000,
+	0x0015122c, 0x00000000, 0x00171345, 0x00155380, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0018092a, 0x00000000,
+	0x00000000, 0x001b6053, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00194062, 0x00000000, 0x002a1301, 0x00191800,
+	0x00180345, 0x00000000, 0x00000000, 0x001b5a6e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b4b00, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155140, 0x00171104,
+	0x00000000, 0x00000000, 0x00195373, 0x00000000, 0x0016c046, 0x001b5489,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194405, 0x00000000,
+	0x00000000, 0x00000000, 0x00255a00, 0x00000000, 0x00150a08, 0x00000000,
+	0x00170b21, 0x00000000, 0x00000000, 0x00000000, 0x00156450, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a118a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b582e, 0x00000000, 0x00000000, 0x001a1b10, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00195133,
+	0x00000000, 0x001b5248, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0015588a, 0x0017184f, 0x00191964, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00156210, 0x00194b4f, 0x00176328, 0x001b4c65, 0x00196440,
+	0x00000000, 0x00000000, 0x00000000, 0x0017126a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00174453, 0x00000000, 0x00000000, 0x00155c2d, 0x00000000, 0x0018084f,
+	0x00000000, 0x001a0966, 0x00150b6e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0018026a, 0x00000000, 0x001a0382, 0x001b5992, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019490f, 0x00000000,
+	0x00000000, 0x00000000, 0x00196200, 0x00000000, 0x00000000, 0x00000000,
+	0x0017102b, 0x00155066, 0x00191140, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00174213, 0x00000000, 0x00194329,
+	0x00000000, 0x001b4441, 0x00175b04, 0x00000000, 0x00000000, 0x0015092f,
+	0x00000000, 0x00170a45, 0x00154a82, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0017648c, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00155409, 0x00000000, 0x00000000, 0x0018002a, 0x00000000,
+	0x00000000, 0x0015034a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x002a0a00, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00161220, 0x001b516e, 0x00000000, 0x00000000,
+	0x001a1451, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154840, 0x00000000,
+	0x00000000, 0x00000000, 0x00194a73, 0x00000000, 0x0017624c, 0x001b4b8a,
+	0x00196364, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00255100, 0x00000000, 0x00150109, 0x00000000,
+	0x00170221, 0x00000000, 0x00000000, 0x0019448e, 0x00155b50, 0x00000000,
+	0x00175c69, 0x00000000, 0x00000000, 0x001a088a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00350900,
+	0x00000000, 0x00000000, 0x00000000, 0x001a1210, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194833,
+	0x00000000, 0x0017600c, 0x001b494a, 0x00196124, 0x001a0c2d, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00191066, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019424f, 0x00155910, 0x001b4366, 0x00175a28, 0x00000000, 0x00195b40,
+	0x00000000, 0x00000000, 0x0017096a, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0015532c, 0x00000000, 0x00175445, 0x00000000,
+	0x00000000, 0x001a0066, 0x0015026e, 0x00181840, 0x00000000, 0x00000000,
+	0x00000000, 0x00151b60, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00161144, 0x001b5092, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0019400f, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a0409, 0x00195900, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00176173, 0x00000000, 0x00196288, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00175204, 0x00000000, 0x00000000, 0x00000000, 0x0015002f,
+	0x00291100, 0x00170146, 0x00154182, 0x00151920, 0x00000000, 0x00000000,
+	0x00000000, 0x00175b8e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154b08, 0x00000000, 0x00174c21, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00155492, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00160920, 0x001b486e, 0x00000000, 0x00000000, 0x001a0b53,
+	0x0019604a, 0x001b6160, 0x00000000, 0x00000000, 0x001a2444, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00194173, 0x00000000, 0x001b428a, 0x0017594e, 0x00000000,
+	0x00195a64, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b4c11, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155253, 0x00175368,
+	0x0019132d, 0x00195481, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a0913, 0x00000000, 0x00000000, 0x00154c6e,
+	0x00000000, 0x001a2204, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b404a, 0x00000000, 0x00000000, 0x00195824, 0x001a032e, 0x00000000,
+	0x00181b08, 0x00000000, 0x001a1c21, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00155013, 0x00000000, 0x00175128, 0x00000000, 0x00195240, 0x00000000,
+	0x00000000, 0x00000000, 0x0017006a, 0x00000000, 0x00000000, 0x00151844,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154a2e, 0x00295b00, 0x00190b09, 0x00174b45,
+	0x00156320, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0016d224, 0x00151260, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154449, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00160846, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b6086, 0x00000000, 0x00000000, 0x001a2368,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175873,
+	0x00000000, 0x0019598a, 0x001a0492, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00174904, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00196310, 0x00000000, 0x00151020, 0x001b6428, 0x00000000,
+	0x00000000, 0x0017528e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154209, 0x00000000, 0x00174321, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016ca01,
+	0x00154b92, 0x00000000, 0x001a2128, 0x00000000, 0x00000000, 0x00156484,
+	0x00000000, 0x00354a01, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a0253,
+	0x00000000, 0x00181a2c, 0x00000000, 0x001a1b44, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017504e, 0x00000000,
+	0x00195166, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b4313, 0x00000000, 0x00000000,
+	0x00000000, 0x001b5c05, 0x00000000, 0x00154953, 0x00000000, 0x00190a2f,
+	0x00174a6a, 0x00194b81, 0x00156244, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0016d148, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a0013, 0x00000000, 0x0015436e, 0x00000000,
+	0x001a1904, 0x00151b0c, 0x00174486, 0x00155c61, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a228e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00181208, 0x00000000, 0x001a1320, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0017482b, 0x00000000, 0x00000000, 0x00156004,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b634c, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x004b4800, 0x00000000,
+	0x00000000, 0x0015412e, 0x00295200, 0x00174246, 0x00000000, 0x00000000,
+	0x00155a20, 0x00000000, 0x00000000, 0x00000000, 0x00195c51, 0x00000000,
+	0x0016c924, 0x00150962, 0x00000000, 0x001a204e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0014c22b,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a1a68,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b610c, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0019508a, 0x00000000, 0x00000000, 0x0018136d, 0x00000000,
+	0x001a1485, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00195a10, 0x00000000, 0x001b5b28, 0x00000000, 0x00000000,
+	0x0017498e, 0x00000000, 0x00000000, 0x00156168, 0x00000000, 0x00176280,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0019542d, 0x00000000, 0x00000000, 0x00000000,
+	0x00154292, 0x00000000, 0x0019036e, 0x00000000, 0x00171b48, 0x00155b84,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0018112f, 0x00000000, 0x001a1244, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194866,
+	0x00000000, 0x00000000, 0x00180b49, 0x00176040, 0x001a0c61, 0x00000000,
+	0x001b6273, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b5304, 0x00000000, 0x00154053, 0x00000000, 0x0019012f,
+	0x0017416a, 0x00171908, 0x00155944, 0x00191a20, 0x00194282, 0x00000000,
+	0x00000000, 0x0016c84a, 0x001b5c8d, 0x00000000, 0x00000000, 0x00000000,
+	0x00194c09, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0015120c, 0x00000000, 0x00171325, 0x00155360, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a198e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b6033, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00180325, 0x00000000, 0x00000000, 0x001b5a4c, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015608e, 0x00000000,
+	0x00000000, 0x00294900, 0x00000000, 0x00000000, 0x00000000, 0x00155120,
+	0x00000000, 0x00000000, 0x00000000, 0x00195353, 0x00000000, 0x0016c026,
+	0x00150062, 0x001b5469, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00171a6c, 0x00000000, 0x00000000, 0x00000000, 0x00390101, 0x00000000,
+	0x00000000, 0x00170b01, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00156430, 0x00000000, 0x00000000, 0x00000000, 0x001a116a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00180a6e, 0x001a0b86,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00195113, 0x00000000, 0x001b5228, 0x00000000, 0x00000000, 0x00000000,
+	0x0017408e, 0x00000000, 0x0015586a, 0x0017182f, 0x00175980, 0x00191944,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00194b2d, 0x00000000, 0x00176308, 0x001b4c45,
+	0x00196420, 0x00000000, 0x00000000, 0x00000000, 0x00171248, 0x00155286,
+	0x00191361, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00174433, 0x00000000, 0x00000000, 0x00155c0d, 0x00000000,
+	0x0018082f, 0x00000000, 0x00000000, 0x00000000, 0x00150b4f, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0018024a, 0x00000000, 0x00000000, 0x001b5973,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00171008, 0x00155044, 0x00191120, 0x00000000, 0x00000000,
+	0x00000000, 0x001b538e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00194309, 0x00000000, 0x001b4421, 0x00000000, 0x00000000, 0x00000000,
+	0x0015090f, 0x00000000, 0x00170a25, 0x00154a60, 0x00000000, 0x00000000,
+	0x00194c92, 0x00000000, 0x00000000, 0x0017646c, 0x00000000, 0x0014d140,
+	0x001a108e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00150329, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00380800, 0x00000000, 0x00000000, 0x00161200, 0x001b514e, 0x00000000,
+	0x00000000, 0x001a1431, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019186a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154820,
+	0x00000000, 0x00000000, 0x00000000, 0x00194a53, 0x00000000, 0x001b4b6a,
+	0x0017622c, 0x00196344, 0x00000000, 0x00000000, 0x00000000, 0x0017116e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00170201, 0x00000000, 0x00000000, 0x0019446e, 0x00155b30,
+	0x00000000, 0x00175c49, 0x00000000, 0x00000000, 0x001a086a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0018016e, 0x00000000, 0x001a0286,
+	0x00000000, 0x00000000, 0x00181a60, 0x00000000, 0x00000000, 0x00000000,
+	0x00194813, 0x00000000, 0x00000000, 0x00000000, 0x00196104, 0x001a0c0d,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00191046, 0x00175082,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0019422f, 0x00000000, 0x00000000, 0x00175a08, 0x00000000,
+	0x00195b20, 0x00000000, 0x00000000, 0x00154986, 0x0017094a, 0x00190a60,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00176390, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0015530c, 0x00000000, 0x00175425,
+	0x00000000, 0x00000000, 0x00000000, 0x0015024f, 0x00000000, 0x00181820,
+	0x00170366, 0x00000000, 0x00151b40, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00161124, 0x001b5073,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b4a8e, 0x00176153, 0x00000000, 0x00196268, 0x00000000, 0x001b6380,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0015000f, 0x00000000, 0x00170126, 0x00154161, 0x00000000, 0x00151900,
+	0x00194392, 0x00000000, 0x00175b6c, 0x00000000, 0x0014c842, 0x00195c85,
+	0x00000000, 0x00394201, 0x00000000, 0x001a2080, 0x00174c01, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155473, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00160900, 0x001b484e, 0x00000000, 0x00000000,
+	0x001a0b33, 0x00196028, 0x001b6140, 0x00000000, 0x00000000, 0x001a2424,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00194153, 0x00000000, 0x001b426a, 0x0017592c,
+	0x00000000, 0x00195a44, 0x00000000, 0x00000000, 0x00000000, 0x0017086e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155233,
+	0x00000000, 0x0019130d, 0x00175348, 0x00195461, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00151a64, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154c4d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016104a,
+	0x00000000, 0x00181160, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00195804, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a1c01, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019618e, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00175108, 0x00000000, 0x00195220,
+	0x00000000, 0x00000000, 0x00000000, 0x0017004a, 0x00154086, 0x00190162,
+	0x00151824, 0x00000000, 0x00000000, 0x00175a92, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154a0c, 0x00000000, 0x00174b25,
+	0x00000000, 0x00156300, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0016d204, 0x00151240, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154429, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00160826, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b6064, 0x00000000, 0x00000000,
+	0x001a2348, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00160241,
+	0x00175853, 0x001b418e, 0x0019596a, 0x001a0473, 0x001b5a80, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00151000, 0x001b6408,
+	0x00000000, 0x00000000, 0x0017526e, 0x00000000, 0x00195385, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00174301, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0024c800, 0x00154b73, 0x001a2108, 0x00174c8a, 0x00000000,
+	0x00156464, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a0233, 0x00000000, 0x00181a0c, 0x00000000, 0x001a1b24, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017502f,
+	0x00000000, 0x00195144, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00171860, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154933, 0x00000000,
+	0x00190a0c, 0x00174a4a, 0x00194b61, 0x00156224, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00151166, 0x0016d128, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0015434e, 0x00174466, 0x00000000, 0x00000000, 0x00155c41, 0x00000000,
+	0x00000000, 0x00180862, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a226c, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a1300, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0019588e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a1c89, 0x0017480b, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b632c,
+	0x00000000, 0x00000000, 0x00000000, 0x00175192, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0015410d, 0x00000000, 0x00174225, 0x00375000,
+	0x00000000, 0x00155a00, 0x00000000, 0x00000000, 0x00000000, 0x00195c31,
+	0x00000000, 0x0016c904, 0x00150940, 0x00000000, 0x001a202c, 0x00000000,
+	0x00000000, 0x00156388, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00251200, 0x00000000,
+	0x0014c209, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a1a48, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0019506a, 0x00000000, 0x001b5182, 0x0018134d,
+	0x00000000, 0x001a1465, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5b08, 0x00000000,
+	0x00000000, 0x0017496e, 0x00000000, 0x00194a86, 0x00156148, 0x00000000,
+	0x00176260, 0x00000000, 0x00000000, 0x00000000, 0x001b6490, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0019540d, 0x00000000, 0x00000000,
+	0x00000000, 0x00154273, 0x00000000, 0x0019034f, 0x0017438a, 0x00155b64,
+	0x00171b28, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a2192, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0018110c, 0x00000000, 0x001a1224, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x002b5800, 0x00000000,
+	0x00194846, 0x00000000, 0x00000000, 0x00180b29, 0x00176020, 0x001a0c41,
+	0x00000000, 0x001b6250, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154033, 0x00000000,
+	0x0019010f, 0x0017414a, 0x00155924, 0x00194262, 0x00191a00, 0x00000000,
+	0x00000000, 0x00000000, 0x0016c82b, 0x00150866, 0x001b5c6d, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00171305, 0x00155340,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016c246, 0x00000000,
+	0x00000000, 0x001a196e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b6010, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a138a, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00180305, 0x00000000, 0x00000000, 0x001b5a2c,
+	0x00000000, 0x00000000, 0x00174892, 0x00000000, 0x00000000, 0x0015606e,
+	0x00000000, 0x00176184, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00155100, 0x00000000, 0x00000000, 0x00195331, 0x00000000,
+	0x00150042, 0x001b5449, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00171a4c, 0x00155a8a, 0x00191b64, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00250900, 0x00000000,
+	0x00000000, 0x00156410, 0x00000000, 0x00000000, 0x00000000, 0x001a114a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b4882, 0x00000000, 0x00180a4f,
+	0x00000000, 0x001a0b64, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b5208, 0x00000000, 0x00000000,
+	0x00000000, 0x0017406e, 0x00000000, 0x0015584a, 0x0017180c, 0x00175960,
+	0x00191924, 0x00194186, 0x00000000, 0x001b5b92, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00194b0d, 0x00000000, 0x001b4c25,
+	0x00000000, 0x00196400, 0x00000000, 0x00000000, 0x00000000, 0x00171228,
+	0x00155264, 0x00191341, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a1892, 0x00174411, 0x00000000, 0x00000000,
+	0x00000000, 0x0018080f, 0x00000000, 0x00000000, 0x00000000, 0x00150b2d,
+	0x00154c81, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0018022a, 0x00000000, 0x00000000,
+	0x001b5953, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155024, 0x00000000, 0x00191100, 0x00000000,
+	0x00000000, 0x00000000, 0x001b536e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b4401, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00170a05, 0x00154a40, 0x00000000,
+	0x00000000, 0x00194c73, 0x00000000, 0x00000000, 0x0017644c, 0x00000000,
+	0x0014d120, 0x001a106e, 0x00000000, 0x00000000, 0x00474900, 0x00000000,
+	0x00000000, 0x00255301, 0x00000000, 0x00150309, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a0a8a, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b512e, 0x00000000,
+	0x00000000, 0x00000000, 0x001a1411, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0019184a, 0x00175886, 0x00000000, 0x00000000, 0x00000000,
+	0x00154800, 0x00000000, 0x00000000, 0x00000000, 0x00194a33, 0x00000000,
+	0x001b4b48, 0x0017620c, 0x00000000, 0x00196324, 0x00000000, 0x00000000,
+	0x0017114f, 0x0015518a, 0x00191264, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019444f,
+	0x00155b10, 0x00000000, 0x00175c29, 0x00000000, 0x00000000, 0x001a084a,
+	0x00000000, 0x00000000, 0x00170b6a, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0018014f, 0x00000000,
+	0x001a0266, 0x00000000, 0x00000000, 0x00181a40, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175060,
+	0x00000000, 0x00000000, 0x00000000, 0x001b5292, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0019420f, 0x00000000, 0x003b5100, 0x00000000,
+	0x00000000, 0x00195b00, 0x00000000, 0x00000000, 0x00154966, 0x0017092b,
+	0x00000000, 0x00190a40, 0x00000000, 0x00000000, 0x00000000, 0x00176370,
+	0x00000000, 0x0014d046, 0x00196488, 0x00000000, 0x00000000, 0x00000000,
+	0x00175405, 0x00000000, 0x00000000, 0x00000000, 0x0015022f, 0x00000000,
+	0x00181800, 0x00170346, 0x00154382, 0x00151b20, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00161104,
+	0x001b5053, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x002a0301, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b4a6e, 0x00176130, 0x00000000, 0x00196248, 0x00000000,
+	0x001b6360, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154141, 0x00000000, 0x00000000,
+	0x00000000, 0x00194373, 0x00000000, 0x00175b4c, 0x001b448a, 0x0014c820,
+	0x00195c65, 0x00000000, 0x00000000, 0x00000000, 0x001a2060, 0x00000000,
+	0x00254a00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00155451, 0x00000000, 0x00000000,
+	0x00000000, 0x001a018a, 0x00000000, 0x00000000, 0x00181964, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b482e, 0x00000000,
+	0x00000000, 0x001a0b10, 0x00196008, 0x001b6120, 0x00000000, 0x00000000,
+	0x001a2404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00194133, 0x00000000, 0x001b424a,
+	0x0017590c, 0x00000000, 0x00195a24, 0x00000000, 0x00000000, 0x00000000,
+	0x0017084f, 0x0015488a, 0x00190966, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00155210, 0x00000000, 0x00175328, 0x00000000, 0x00195441, 0x00000000,
+	0x00000000, 0x0017026a, 0x00000000, 0x00000000, 0x00151a44, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154c2d, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0016102b, 0x00000000, 0x00181140, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00160a45, 0x001b4992, 0x00000000, 0x0019616e,
+	0x00000000, 0x001b6284, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00195200, 0x00000000, 0x00000000, 0x00000000, 0x0017002b, 0x00154066,
+	0x00000000, 0x00151804, 0x00000000, 0x00000000, 0x00175a73, 0x00000000,
+	0x00195b88, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00174b05, 0x00000000, 0x00000000, 0x00000000, 0x00290a01, 0x00000000,
+	0x00000000, 0x00000000, 0x00151220, 0x00000000, 0x00000000, 0x00000000,
+	0x0017548e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154409,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b6044, 0x00000000,
+	0x00000000, 0x001a2328, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00160221, 0x00175833, 0x001b416e, 0x00195948, 0x001a0453, 0x001b5a60,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0017524e, 0x00000000, 0x00195365,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015196a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154b53, 0x00000000, 0x00174c69, 0x00000000,
+	0x00000000, 0x00156444, 0x00000000, 0x00181066, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a0213, 0x00000000, 0x00000000, 0x00000000, 0x001a1b04,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00196092, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a248c,
+	0x0017500c, 0x00000000, 0x00195124, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00190066, 0x00000000, 0x00000000, 0x00171840, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154913,
+	0x00000000, 0x00174a29, 0x00000000, 0x00194b41, 0x00156204, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00151144, 0x0016d108, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0015432e, 0x00000000, 0x00174445, 0x00000000, 0x00155c21,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150b61,
+	0x00000000, 0x00000000, 0x001a224c, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00281100,
+	0x00000000, 0x00160146, 0x001b4092, 0x00000000, 0x0019586e, 0x00000000,
+	0x001b5986, 0x00000000, 0x00000000, 0x00000000, 0x001a1c69, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b630c, 0x00000000, 0x00000000, 0x00000000, 0x00175173, 0x00000000,
+	0x0019528a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174205,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00195c11, 0x00000000, 0x00150920, 0x00000000, 0x00000000, 0x001a200c,
+	0x00174b8e, 0x00000000, 0x00156368, 0x00000000, 0x00176480, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154492,
+	0x00000000, 0x001a1a28, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0019504a, 0x00000000, 0x00000000,
+	0x0018132d, 0x00000000, 0x001a1445, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0017494e, 0x00000000, 0x00194a66, 0x00156128,
+	0x00000000, 0x00176240, 0x00000000, 0x00000000, 0x00000000, 0x0015106a,
+	0x001b6470, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154253, 0x00000000, 0x0019032f, 0x0017436a,
+	0x00155b44, 0x00171b08, 0x00194481, 0x00000000, 0x00000000, 0x00000000,
+	0x0016ca49, 0x00000000, 0x00000000, 0x00000000, 0x001a2173, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a1204,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a1b8e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00180b09, 0x00176000,
+	0x001a0c21, 0x00000000, 0x001b6230, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154013,
+	0x00000000, 0x0017412b, 0x00000000, 0x00155904, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0016c80b, 0x00150846, 0x001b5c4d,
+	0x00000000, 0x00000000, 0x00000000, 0x0015628e, 0x004b4101, 0x00000000,
+	0x00294b01, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155320,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150262, 0x0016c225,
+	0x00000000, 0x00000000, 0x001a194e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b5086, 0x00000000, 0x00000000, 0x001a1368, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b5a0c, 0x00000000, 0x00000000, 0x00000000, 0x00174873, 0x0019498a,
+	0x0015604e, 0x00000000, 0x00176164, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00195311,
+	0x00000000, 0x00150022, 0x001b5429, 0x00000000, 0x00000000, 0x0017428e,
+	0x00000000, 0x00000000, 0x00171a2c, 0x00155a68, 0x00191b44, 0x00175b80,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00155485, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00180a2f, 0x00000000, 0x001a0b44, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0017404e, 0x00000000, 0x00155828, 0x00194166,
+	0x00175940, 0x00191904, 0x00000000, 0x00000000, 0x001b5b73, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b4c05, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00171208, 0x00155244, 0x00191321, 0x00000000, 0x00000000, 0x00000000,
+	0x0016c14a, 0x00000000, 0x00000000, 0x001a1873, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00150b0d, 0x00154c61, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a128e, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b5933, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0017608a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00155004, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b534c, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0015598e, 0x00000000, 0x00191a68,
+	0x00294201, 0x00000000, 0x00000000, 0x00000000, 0x00154a20, 0x00000000,
+	0x00000000, 0x00000000, 0x00194c53, 0x00000000, 0x00000000, 0x0017642c,
+	0x00000000, 0x0014d100, 0x001a104e, 0x00000000, 0x0017136d, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a0a6a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019408a,
+	0x00000000, 0x00000000, 0x0018036e, 0x00191828, 0x001a0486, 0x00175866,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194a13,
+	0x00000000, 0x001b4b28, 0x00000000, 0x00000000, 0x00196304, 0x00000000,
+	0x00000000, 0x0017112f, 0x0015516a, 0x00191244, 0x00175280, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019442f, 0x00000000, 0x00000000, 0x00175c09, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00170b49, 0x00154b86, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0018012f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00181a20, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00175040, 0x00000000, 0x00000000, 0x00000000, 0x001b5273, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00275900, 0x00154944,
+	0x00170908, 0x00000000, 0x00190a20, 0x00000000, 0x00000000, 0x001b4c8e,
+	0x00176350, 0x00000000, 0x0014d024, 0x00196468, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015020f,
+	0x00000000, 0x00170325, 0x00154361, 0x00000000, 0x00151b00, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0014ca41, 0x001a098e, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a2280, 0x00000000, 0x00000000,
+	0x00000000, 0x001b5033, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00380101,
+	0x00000000, 0x00000000, 0x001b4a4e, 0x00176110, 0x00000000, 0x00196228,
+	0x00000000, 0x001b6340, 0x0015508e, 0x00000000, 0x0019116a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154121, 0x00000000,
+	0x00000000, 0x00000000, 0x00194353, 0x00000000, 0x00175b2c, 0x001b446a,
+	0x0014c800, 0x00195c45, 0x00000000, 0x00000000, 0x00170a6e, 0x001a2040,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155431, 0x00000000,
+	0x00000000, 0x00000000, 0x001a016a, 0x00000000, 0x00000000, 0x00181944,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b6100, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00161248, 0x00000000,
+	0x00181361, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194113,
+	0x00000000, 0x00000000, 0x00000000, 0x00195a04, 0x00000000, 0x00000000,
+	0x00000000, 0x0017082f, 0x0015486a, 0x00190946, 0x00174982, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0019638c, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00175308, 0x00000000, 0x00195421,
+	0x00000000, 0x00000000, 0x0017024a, 0x00154286, 0x00190361, 0x00151a24,
+	0x00000000, 0x00000000, 0x00000000, 0x00175c91, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154c0d, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00161008, 0x00000000, 0x00181120, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00160a25, 0x001b4973, 0x00000000,
+	0x0019614f, 0x00000000, 0x001b6264, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00275000, 0x00000000, 0x0017000b,
+	0x00154046, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b438e,
+	0x00175a53, 0x00195b68, 0x00000000, 0x001b5c81, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00370800, 0x00000000, 0x00000000, 0x00151200, 0x00000000, 0x00000000,
+	0x00000000, 0x0017546d, 0x00000000, 0x0014c142, 0x001a008e, 0x00000000,
+	0x0018186a, 0x00000000, 0x001a1980, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b6024,
+	0x00000000, 0x00000000, 0x001a2308, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00160201, 0x00175813, 0x001b414e, 0x00195928, 0x001a0433,
+	0x001b5a40, 0x00000000, 0x00000000, 0x00000000, 0x0019086a, 0x00000000,
+	0x00156080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017522c, 0x00000000,
+	0x00195345, 0x00000000, 0x00000000, 0x00000000, 0x0017016e, 0x00000000,
+	0x00151948, 0x00000000, 0x00171a60, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154b33, 0x00000000, 0x00174c49,
+	0x00000000, 0x00000000, 0x00156424, 0x00000000, 0x00181046, 0x00000000,
+	0x00000000, 0x00000000, 0x00151365, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016094a, 0x00000000,
+	0x00180a60, 0x00196073, 0x00000000, 0x001b618a, 0x00000000, 0x00000000,
+	0x001a246c, 0x00000000, 0x00000000, 0x00195104, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00190046, 0x00174082, 0x00000000, 0x00171820,
+	0x00000000, 0x00000000, 0x00000000, 0x00195a8e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00174a09, 0x00000000, 0x00194b21, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00151124, 0x00000000,
+	0x00000000, 0x00000000, 0x00175392, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0015430d, 0x00375200, 0x00174425, 0x00000000,
+	0x00155c01, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00150b41, 0x00000000, 0x00000000, 0x001a222c, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00160126, 0x001b4073, 0x00000000, 0x00000000,
+	0x0019584f, 0x001b5964, 0x00000000, 0x00000000, 0x00000000, 0x001a1c49,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175153,
+	0x00000000, 0x0019526a, 0x00000000, 0x001b5380, 0x00000000, 0x00000000,
+	0x00000000, 0x0015186e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00150900, 0x00000000, 0x00000000,
+	0x00174b6e, 0x00000000, 0x00194c85, 0x00156348, 0x00000000, 0x00176460,
+	0x00000000, 0x00000000, 0x001a1082, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0024c101, 0x00154473, 0x001a1a08, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a2390, 0x00000000, 0x0019502a, 0x00000000,
+	0x00000000, 0x0018130d, 0x00000000, 0x001a1425, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0017492f, 0x002b5a00, 0x00194a44,
+	0x00156108, 0x00000000, 0x00176220, 0x00000000, 0x00000000, 0x00000000,
+	0x0015104a, 0x001b6450, 0x00171160, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154233, 0x00000000, 0x0019030d,
+	0x0017434a, 0x00155b24, 0x00194461, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0016ca29, 0x00150a66, 0x00000000, 0x00000000, 0x001a2153,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016004a, 0x00180162,
+	0x00000000, 0x00000000, 0x00000000, 0x001b588a, 0x00000000, 0x00000000,
+	0x001a1b6c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a0c01, 0x00000000, 0x001b6210, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0019518e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0017410b, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150824, 0x001b5c2d,
+	0x00000000, 0x00000000, 0x00174a92, 0x00000000, 0x0015626c, 0x00000000,
+	0x00176384, 0x00000000, 0x00000000, 0x00374900, 0x00000000, 0x00000000,
+	0x00155300, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150241,
+	0x0016c205, 0x00000000, 0x00000000, 0x001a192c, 0x00000000, 0x00000000,
+	0x00155c89, 0x00000000, 0x00148920, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b5066, 0x00000000, 0x00000000, 0x001a1348, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174853,
+	0x00000000, 0x0015602c, 0x0019496a, 0x00176144, 0x001b4a82, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b5409, 0x00000000, 0x00000000, 0x00000000,
+	0x0017426e, 0x00000000, 0x00194386, 0x00171a0c, 0x00155a48, 0x00191b24,
+	0x00175b60, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155465, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a1a92, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00180a0c, 0x00000000, 0x001a0b24, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0017402f, 0x002b5100, 0x00194146,
+	0x00155808, 0x00175920, 0x00000000, 0x00000000, 0x00000000, 0x001b5b50,
+	0x00000000, 0x00170862, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00156192, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00155224, 0x00000000, 0x00191301, 0x00000000, 0x00000000,
+	0x00000000, 0x0016c12b, 0x00150166, 0x00000000, 0x001a1853, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154c41, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a126e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b5910, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0019488e, 0x00000000, 0x0017606a, 0x00000000,
+	0x00196180, 0x001a0c8a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b532c, 0x00000000,
+	0x00000000, 0x00174192, 0x00000000, 0x00000000, 0x0015596e, 0x00000000,
+	0x00191a48, 0x00175a84, 0x00000000, 0x00000000, 0x00000000, 0x00154a00,
+	0x00000000, 0x00000000, 0x00000000, 0x00194c31, 0x00000000, 0x00000000,
+	0x0017640c, 0x00000000, 0x001a102e, 0x00000000, 0x00000000, 0x0017134d,
+	0x0015538a, 0x00148022, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00250201, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a0a4a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019406a, 0x00000000, 0x001b4182, 0x0018034f, 0x00191808, 0x001a0465,
+	0x00175846, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b4b08, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0017110c, 0x0015514a, 0x00191224, 0x00175260,
+	0x00000000, 0x00000000, 0x001b5492, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0019440d, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00170b29, 0x00154b64,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0014d244, 0x001a1192, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0018010f, 0x00000000, 0x003a1000, 0x00000000, 0x00000000, 0x00181a00,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00175020, 0x00000000, 0x00000000, 0x00000000, 0x001b5253,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155892,
+	0x00000000, 0x0019196e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154924, 0x00000000, 0x00000000, 0x00190a00, 0x00000000, 0x00000000,
+	0x001b4c6e, 0x00176330, 0x00000000, 0x0014d004, 0x00196448, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00170305, 0x00154341, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0014ca21, 0x001a096e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a2260, 0x00000000,
+	0x00000000, 0x00000000, 0x001b5013, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a038a, 0x00195882, 0x00000000, 0x00181b64, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b4a2e, 0x00000000, 0x00000000,
+	0x00196208, 0x00000000, 0x001b6320, 0x0015506e, 0x00000000, 0x00175186,
+	0x0019114a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154101,
+	0x00000000, 0x00000000, 0x00000000, 0x00194333, 0x00000000, 0x00175b0c,
+	0x001b4449, 0x00195c25, 0x00000000, 0x00000000, 0x00000000, 0x00170a4f,
+	0x00154a8a, 0x00190b65, 0x001a2020, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155411,
+	0x00000000, 0x00000000, 0x00000000, 0x001a014a, 0x00000000, 0x00000000,
+	0x00181924, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00161228, 0x00181341, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0017080f, 0x0015484a, 0x00174960, 0x00000000,
+	0x00000000, 0x00000000, 0x001b4b92, 0x00000000, 0x0019636c, 0x00000000,
+	0x0016d040, 0x001b6484, 0x00000000, 0x003b4a01, 0x00000000, 0x00000000,
+	0x00195401, 0x00000000, 0x00000000, 0x0017022b, 0x00154266, 0x00190341,
+	0x00151a04, 0x00000000, 0x00000000, 0x00000000, 0x00175c71, 0x00000000,
+	0x0014c946, 0x001a0892, 0x00000000, 0x00000000, 0x00000000, 0x001a2184,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00181100, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00160a05, 0x001b4953,
+	0x00000000, 0x0019612c, 0x00000000, 0x001b6244, 0x00000000, 0x00000000,
+	0x00000000, 0x0019106e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154026, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b436e, 0x00175a30, 0x00195b48, 0x00000000, 0x001b5c61, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0017544d, 0x00000000, 0x0014c121, 0x001a006e,
+	0x00000000, 0x0018184a, 0x00000000, 0x001a1960, 0x00151b68, 0x00254301,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b6004, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00181264, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b412e, 0x00000000, 0x00195908,
+	0x001a0411, 0x001b5a20, 0x00000000, 0x00000000, 0x00000000, 0x0019084a,
+	0x00174886, 0x00000000, 0x00156060, 0x00000000, 0x00000000, 0x00196292,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017520c,
+	0x00000000, 0x00195325, 0x00000000, 0x00000000, 0x0015418a, 0x0017014f,
+	0x00190266, 0x00151928, 0x00000000, 0x00171a40, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154b10, 0x00000000,
+	0x00174c29, 0x00000000, 0x00000000, 0x00156404, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00151345, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016092b,
+	0x00000000, 0x00180a40, 0x00196053, 0x00000000, 0x001b6168, 0x00000000,
+	0x00000000, 0x00000000, 0x001a244c, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x004a0900, 0x00174062, 0x00000000, 0x00000000,
+	0x00171800, 0x001b4292, 0x00000000, 0x00000000, 0x00195a6e, 0x00000000,
+	0x001b5b84, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194b01,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00151104, 0x00000000, 0x00000000, 0x00175373, 0x00000000, 0x0014c046,
+	0x00195489, 0x00000000, 0x00000000, 0x00000000, 0x001a1886, 0x00174405,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00150b21, 0x00000000, 0x00000000, 0x001a220c, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b4053, 0x00000000,
+	0x00000000, 0x0019582f, 0x00000000, 0x001b5944, 0x00000000, 0x00000000,
+	0x001a1c29, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00175133, 0x00000000, 0x00195248, 0x00000000, 0x001b5360, 0x00000000,
+	0x00000000, 0x00000000, 0x0015184f, 0x00000000, 0x00171964, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00174b4e, 0x00194c65, 0x00156328, 0x00000000,
+	0x00176440, 0x00000000, 0x00000000, 0x00000000, 0x0015126a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154453, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00180966, 0x00000000, 0x00000000, 0x001b608e,
+	0x00000000, 0x00000000, 0x00000000, 0x001a2370, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a1405, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00195992,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017490c, 0x00000000,
+	0x00194a24, 0x00000000, 0x00000000, 0x00176200, 0x00000000, 0x00000000,
+	0x00000000, 0x0015102a, 0x001b6430, 0x00171140, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154213, 0x00000000,
+	0x0017432b, 0x00000000, 0x00155b04, 0x00194441, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0016ca09, 0x00150a44, 0x00000000, 0x00000000,
+	0x001a2130, 0x00000000, 0x0015648c, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016002b,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b586a, 0x00000000,
+	0x00000000, 0x001a1b4c, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00280a01, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0019516e, 0x00000000, 0x001b5286,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150804,
+	0x001b5c0d, 0x00000000, 0x00000000, 0x00174a73, 0x00000000, 0x0015624c,
+	0x00194b8a, 0x00176364, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00150221, 0x00000000, 0x00000000, 0x00000000, 0x001a190c, 0x0017448e,
+	0x00000000, 0x00155c69, 0x00000000, 0x00148900, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a1328,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00174833, 0x00000000, 0x0015600c, 0x0019494a, 0x00176124, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00171066, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0017424e, 0x00000000, 0x00194366, 0x00155a28, 0x00000000,
+	0x00191b04, 0x00175b40, 0x00000000, 0x0015096a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155445,
+	0x00000000, 0x00000000, 0x00180066, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a1a73, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a0b04, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00195092, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a148e, 0x0017400f,
+	0x00000000, 0x00000000, 0x00000000, 0x00175900, 0x00000000, 0x00000000,
+	0x001b5b30, 0x00000000, 0x00170842, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00156173, 0x00000000, 0x00176288, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155204, 0x00000000, 0x00000000, 0x00000000,
+	0x00271100, 0x00000000, 0x0016c10b, 0x00150146, 0x00000000, 0x001a1833,
+	0x00000000, 0x00000000, 0x00155b8e, 0x00000000, 0x00148824, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154c21, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a124e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00140920, 0x0019486e, 0x00000000, 0x0017604a,
+	0x001b4986, 0x00196160, 0x001a0c69, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b530c,
+	0x00000000, 0x00000000, 0x00174173, 0x00000000, 0x0019428a, 0x0015594e,
+	0x00000000, 0x00191a28, 0x00175a64, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194c11, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00155368, 0x0017132d, 0x00175481, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0019404a, 0x00000000, 0x00000000, 0x0018032f, 0x00175824,
+	0x001a0445, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00155128, 0x00000000, 0x00191204,
+	0x00175240, 0x00000000, 0x00000000, 0x0015006a, 0x001b5473, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00275b00, 0x00000000, 0x00170b09,
+	0x00154b44, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0014d224, 0x001a1173, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a0b8e, 0x00196086, 0x00000000,
+	0x00000000, 0x00000000, 0x001a2480, 0x00175000, 0x00000000, 0x00000000,
+	0x001b5233, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00155873, 0x00000000, 0x0019194f, 0x0017598a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154904, 0x00000000, 0x00000000, 0x00270800,
+	0x00000000, 0x001b4c4d, 0x00176310, 0x00000000, 0x00196428, 0x00000000,
+	0x00000000, 0x00000000, 0x0015528e, 0x00000000, 0x00191369, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154321, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0014ca01,
+	0x001a094e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a2240,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00140022, 0x00000000, 0x001b4086, 0x00000000,
+	0x00000000, 0x00195860, 0x001a036a, 0x00000000, 0x00181b44, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b6300, 0x0015504e, 0x00000000,
+	0x00175166, 0x00191128, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194313, 0x00000000,
+	0x001b4429, 0x00000000, 0x00195c05, 0x00000000, 0x00000000, 0x00000000,
+	0x00170a2f, 0x00154a6a, 0x00190b45, 0x001a2000, 0x00174b81, 0x00000000,
+	0x00000000, 0x00000000, 0x0014d148, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00181904, 0x00154486, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00161208, 0x00181321, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154828, 0x00000000, 0x00174940,
+	0x00000000, 0x00000000, 0x00000000, 0x001b4b73, 0x00000000, 0x0019634c,
+	0x00000000, 0x0016d020, 0x001b6464, 0x00000000, 0x00000000, 0x00494800,
+	0x00000000, 0x00000000, 0x00275200, 0x00000000, 0x00170209, 0x00154245,
+	0x00190321, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175c51,
+	0x00000000, 0x0014c924, 0x001a0873, 0x00000000, 0x00000000, 0x00000000,
+	0x001a2164, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a028e, 0x00000000, 0x00181a68,
+	0x00000000, 0x001a1b80, 0x00000000, 0x00000000, 0x00000000, 0x001b4933,
+	0x00000000, 0x00000000, 0x0019610c, 0x00000000, 0x001b6224, 0x00000000,
+	0x00000000, 0x00000000, 0x0019104f, 0x0017508a, 0x00000000, 0x00000000,
+	0x00000000, 0x00154007, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b434e, 0x00175a10, 0x00000000, 0x00195b28, 0x001b5c41,
+	0x00000000, 0x0015498e, 0x00000000, 0x00190a6a, 0x00000000, 0x00000000,
+	0x00156280, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0017542d, 0x00000000, 0x0014c101,
+	0x001a004e, 0x00000000, 0x00181828, 0x0017036e, 0x001a1940, 0x00151b48,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00181244, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b5a00, 0x00000000, 0x00000000, 0x00000000,
+	0x0019082a, 0x00174866, 0x00000000, 0x00156040, 0x00000000, 0x00000000,
+	0x00196273, 0x00000000, 0x001b6388, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00195305, 0x00000000, 0x00000000, 0x0015416a,
+	0x0017012f, 0x00174282, 0x00151908, 0x00190246, 0x00171a20, 0x00000000,
+	0x00000000, 0x00000000, 0x0014c84a, 0x00195c8d, 0x00000000, 0x00000000,
+	0x00000000, 0x001a208a, 0x00174c09, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00151325, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00160908, 0x00000000, 0x00180a20, 0x00196033, 0x00000000, 0x001b6148,
+	0x00000000, 0x00000000, 0x00000000, 0x001a242c, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174042, 0x00000000,
+	0x00000000, 0x00000000, 0x001b4273, 0x00000000, 0x00000000, 0x00195a4c,
+	0x00000000, 0x001b5b64, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00274900, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175353, 0x00000000,
+	0x0014c026, 0x00195469, 0x00000000, 0x00000000, 0x00000000, 0x001a1866,
+	0x00000000, 0x00151a6c, 0x00000000, 0x00000000, 0x00000000, 0x00370101,
+	0x00000000, 0x00000000, 0x00150b01, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0018116a,
+	0x00000000, 0x001a1280, 0x00000000, 0x00000000, 0x00000000, 0x001b4033,
+	0x00000000, 0x00000000, 0x0019580c, 0x00000000, 0x001b5924, 0x00000000,
+	0x00000000, 0x001a1c09, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00175110, 0x00000000, 0x00195228, 0x00000000, 0x001b5340,
+	0x00000000, 0x0015408e, 0x00000000, 0x0015182f, 0x0019016a, 0x00171944,
+	0x00155980, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00174b2d, 0x00000000, 0x00156308,
+	0x00194c45, 0x00176420, 0x00000000, 0x00000000, 0x00000000, 0x00151248,
+	0x00000000, 0x00171361, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154433, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x002a1900, 0x00000000, 0x00180946, 0x00000000, 0x00000000,
+	0x001b606e, 0x00000000, 0x00000000, 0x00000000, 0x001a2350, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0016024a, 0x00000000, 0x00180361,
+	0x00195973, 0x00000000, 0x001b5a8a, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00194a04, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00151008, 0x001b6410, 0x00171120, 0x00000000,
+	0x00000000, 0x0019538e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00174309, 0x00000000, 0x00194421, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00150a24, 0x00000000, 0x00000000,
+	0x00000000, 0x001a2110, 0x00174c92, 0x00000000, 0x0015646c, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0016000b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b584a,
+	0x00000000, 0x00000000, 0x001a1b2c, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019514f, 0x00000000,
+	0x001b5264, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0017186a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174a53, 0x00000000,
+	0x0015622c, 0x00194b6a, 0x00176344, 0x001b4c81, 0x00000000, 0x00000000,
+	0x0015116e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00150201, 0x00000000, 0x00000000, 0x0017446e,
+	0x00000000, 0x00000000, 0x00155c49, 0x00000000, 0x0018086a, 0x00000000,
+	0x001a0982, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a1308, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a1c91, 0x00174813, 0x00000000, 0x0019492a, 0x00000000, 0x00176104,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00171046,
+	0x00155082, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0017422f, 0x002b5301, 0x00194345, 0x00155a08,
+	0x00000000, 0x00175b20, 0x00000000, 0x00000000, 0x0015094a, 0x00000000,
+	0x00170a61, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00156390,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00155425, 0x00000000, 0x00000000, 0x00180046, 0x00000000, 0x00000000,
+	0x00150366, 0x00000000, 0x00000000, 0x001a1a53, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00195073, 0x001b518a, 0x00000000, 0x00000000, 0x00000000, 0x001a146d,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b5b10, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00194a8e, 0x00156153, 0x00000000, 0x00176268, 0x00000000,
+	0x00196380, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00150125, 0x00000000, 0x00000000,
+	0x001a1813, 0x00174392, 0x00000000, 0x00155b6c, 0x00000000, 0x00148804,
+	0x00175c85, 0x00000000, 0x00374201, 0x00000000, 0x00154c01, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a122c, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00140900, 0x0019484f, 0x00000000,
+	0x00176028, 0x001b4966, 0x00196140, 0x001a0c49, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00174153, 0x00000000, 0x0019426a,
+	0x0015592c, 0x001b4382, 0x00191a08, 0x00175a44, 0x00000000, 0x00000000,
+	0x0015086e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00155348, 0x0017130d, 0x00175461, 0x00000000, 0x00000000,
+	0x001a0082, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a1392, 0x00000000, 0x0019402a, 0x00000000, 0x00000000, 0x0018030d,
+	0x00175804, 0x001a0425, 0x003a1200, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017618e,
+	0x00000000, 0x00000000, 0x002b4a00, 0x00000000, 0x00155108, 0x00000000,
+	0x00175220, 0x00000000, 0x00000000, 0x00000000, 0x0015004a, 0x001b5451,
+	0x00170162, 0x00000000, 0x00000000, 0x00000000, 0x00155a92, 0x00000000,
+	0x00191b6c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154b24, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0014d204, 0x001a1153, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00140824, 0x00000000,
+	0x00000000, 0x001b488a, 0x00000000, 0x00000000, 0x001a0b6e, 0x00196066,
+	0x00000000, 0x00000000, 0x00000000, 0x001a2460, 0x00000000, 0x00000000,
+	0x00000000, 0x001b5210, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019418e, 0x00155853, 0x00000000, 0x0019192c, 0x0017596a, 0x00195a80,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b4c2d, 0x00000000, 0x00000000, 0x00196408,
+	0x00000000, 0x00000000, 0x00000000, 0x0015526e, 0x00000000, 0x00191349,
+	0x00175384, 0x00000000, 0x00000000, 0x00000000, 0x00154301, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a092e, 0x00000000, 0x00000000, 0x00154c8a, 0x00000000,
+	0x001a2220, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b4066,
+	0x00000000, 0x00000000, 0x00195840, 0x001a034a, 0x00000000, 0x00181b24,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015502e,
+	0x00000000, 0x00175144, 0x00191108, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00151860, 0x00000000,
+	0x00000000, 0x001b4409, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00170a0d, 0x00154a4a, 0x00190b25, 0x00174b61, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0014d128, 0x00000000, 0x0016d240,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154465, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a0a92,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a2384, 0x00000000,
+	0x00000000, 0x003a0900, 0x00000000, 0x00000000, 0x00181301, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017588e, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154808, 0x00000000,
+	0x00174920, 0x00000000, 0x00000000, 0x00000000, 0x001b4b53, 0x00000000,
+	0x0019632c, 0x00000000, 0x0016d000, 0x001b6444, 0x00155192, 0x00000000,
+	0x0019126e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154225,
+	0x00355000, 0x00190301, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00175c31, 0x00000000, 0x0014c904, 0x001a0853, 0x00000000, 0x00000000,
+	0x00000000, 0x001a2144, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a026e, 0x00000000,
+	0x00181a48, 0x00000000, 0x001a1b60, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b4913, 0x00000000, 0x00000000, 0x00000000, 0x001b6204,
+	0x00000000, 0x00000000, 0x00000000, 0x0019102f, 0x0017506a, 0x00195182,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b432e, 0x00000000, 0x00000000, 0x00195b08,
+	0x00000000, 0x001b5c21, 0x0015496e, 0x00000000, 0x00190a4a, 0x00174a86,
+	0x00000000, 0x00156260, 0x00000000, 0x00000000, 0x00000000, 0x00196490,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017540d, 0x00000000,
+	0x00000000, 0x001a002e, 0x00000000, 0x00181808, 0x0017034f, 0x001a1920,
+	0x00151b28, 0x0015438a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00181224,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00295800,
+	0x00000000, 0x00174846, 0x00000000, 0x00000000, 0x00156020, 0x00000000,
+	0x00000000, 0x00196250, 0x00000000, 0x001b6368, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0015414a, 0x0017010f, 0x00174261, 0x00000000, 0x00000000, 0x00171a00,
+	0x001b4492, 0x00000000, 0x00000000, 0x0014c82b, 0x00195c6d, 0x0016c940,
+	0x00000000, 0x00000000, 0x001a206a, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00151305,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0014c246, 0x001a0192,
+	0x00000000, 0x00000000, 0x0018196e, 0x00000000, 0x001a1a84, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00180a00, 0x00196010, 0x00000000,
+	0x001b6128, 0x00000000, 0x00000000, 0x00000000, 0x001a240c, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b4253, 0x00000000, 0x00000000,
+	0x00195a2c, 0x00000000, 0x001b5b44, 0x00154892, 0x00000000, 0x0019096e,
+	0x00000000, 0x00000000, 0x00156184, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175330,
+	0x00000000, 0x0014c007, 0x00195449, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00151a4c, 0x00000000, 0x00171b64, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0018114a, 0x00000000, 0x001a1260, 0x00000000, 0x00000000, 0x00000000,
+	0x001b4013, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5904,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194882, 0x00000000,
+	0x00000000, 0x00180b65, 0x00000000, 0x00000000, 0x00000000, 0x001b628e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00195208, 0x00000000,
+	0x001b5320, 0x00000000, 0x0015406e, 0x00000000, 0x0019014a, 0x0015180c,
+	0x00171924, 0x00155960, 0x00174186, 0x00000000, 0x00195b92, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174b0d, 0x00000000,
+	0x00194c25, 0x00000000, 0x00176400, 0x00000000, 0x00000000, 0x00000000,
+	0x00151228, 0x00000000, 0x00171341, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154411, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b604e, 0x00000000, 0x00000000, 0x001a2330,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016022b, 0x00000000,
+	0x00180341, 0x00195953, 0x00000000, 0x001b5a68, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00171100,
+	0x00000000, 0x00000000, 0x0019536e, 0x00000000, 0x0016c042, 0x001b5485,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194401, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150a04, 0x00000000,
+	0x00000000, 0x00000000, 0x0026c900, 0x00174c73, 0x00000000, 0x0015644c,
+	0x00000000, 0x0018106e, 0x00000000, 0x001a1186, 0x00000000, 0x00454900,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a1b0c, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019512f,
+	0x00000000, 0x001b5244, 0x00000000, 0x00000000, 0x00000000, 0x0019006e,
+	0x00000000, 0x00155886, 0x0017184a, 0x00000000, 0x00191960, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174a33,
+	0x00000000, 0x0015620c, 0x00194b49, 0x00176324, 0x001b4c61, 0x00000000,
+	0x00000000, 0x0015114f, 0x00000000, 0x00171264, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0017444e, 0x00000000, 0x00000000, 0x00155c29, 0x00000000, 0x00000000,
+	0x0018084a, 0x00000000, 0x00000000, 0x00150b6a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00180266, 0x00000000, 0x00000000, 0x001b598e, 0x00000000,
+	0x00000000, 0x001a1c71, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00171024, 0x00155060, 0x00000000, 0x00000000, 0x00195292, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0017420d, 0x00000000, 0x00194325,
+	0x00395100, 0x00000000, 0x00175b00, 0x00000000, 0x00000000, 0x0015092a,
+	0x00000000, 0x00170a41, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00156370, 0x00000000, 0x00176488, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00155405, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00150345, 0x00000000, 0x00000000, 0x001a1a30, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00195053, 0x001b516a, 0x00000000, 0x00000000, 0x00000000,
+	0x001a144d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00194a6e, 0x00156130, 0x001b4b86, 0x00176248,
+	0x00000000, 0x00196360, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150105, 0x00000000,
+	0x00000000, 0x00174373, 0x00000000, 0x0019448a, 0x00155b4c, 0x00000000,
+	0x00175c65, 0x00000000, 0x00000000, 0x001a0886, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a120c, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019482f,
+	0x00000000, 0x00000000, 0x00176008, 0x00196120, 0x001a0c29, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00191062, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174133, 0x00000000,
+	0x0019424a, 0x0015590c, 0x00000000, 0x00175a24, 0x00000000, 0x00000000,
+	0x00000000, 0x0015084f, 0x00000000, 0x00170966, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155328, 0x00000000, 0x00175441, 0x00000000,
+	0x00000000, 0x00000000, 0x0015026a, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00161140, 0x001b508e, 0x00000000,
+	0x00000000, 0x001a1373, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a0405, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00194992, 0x00000000, 0x00000000,
+	0x0017616e, 0x00000000, 0x00196284, 0x00000000, 0x00394800, 0x00000000,
+	0x00000000, 0x00175200, 0x00000000, 0x00000000, 0x00000000, 0x0015002a,
+	0x001b5431, 0x00170142, 0x00000000, 0x00000000, 0x00000000, 0x00155a73,
+	0x00000000, 0x00191b4c, 0x00175b88, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154b04, 0x00000000, 0x00000000, 0x00000000, 0x00270a01,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a1133, 0x00000000,
+	0x00000000, 0x0015548e, 0x00000000, 0x00148125, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00140804,
+	0x00000000, 0x00000000, 0x001b486a, 0x00000000, 0x00000000, 0x001a0b4e,
+	0x00196044, 0x00000000, 0x00000000, 0x00000000, 0x001a2440, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155833, 0x0019416e, 0x0019190c, 0x00175948,
+	0x00195a60, 0x001b4286, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b4c0d, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015524e, 0x00000000,
+	0x00191329, 0x00175364, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154c69,
+	0x00000000, 0x001a2200, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00195820, 0x00000000, 0x00000000,
+	0x00181b04, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00176092, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0015500c, 0x00175124, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00170066, 0x00000000, 0x00000000, 0x00151840,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154a28, 0x00000000, 0x00190b05, 0x00174b41,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0014d108, 0x00000000,
+	0x0016d220, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154445, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00160842, 0x00000000, 0x00000000,
+	0x00000000, 0x001a0a73, 0x001b6080, 0x00000000, 0x00000000, 0x001a2364,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00194092, 0x00000000, 0x0017586e,
+	0x00000000, 0x00195986, 0x001a048e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00174900, 0x00000000, 0x00000000, 0x00000000, 0x001b4b33,
+	0x00000000, 0x0019630c, 0x00000000, 0x001b6424, 0x00000000, 0x00155173,
+	0x00000000, 0x0019124f, 0x0017528a, 0x00000000, 0x00000000, 0x00000000,
+	0x00154205, 0x00000000, 0x00000000, 0x00000000, 0x00270101, 0x00000000,
+	0x00000000, 0x00175c11, 0x00000000, 0x001a0833, 0x00000000, 0x00000000,
+	0x00154b8e, 0x00000000, 0x001a2124, 0x00000000, 0x00000000, 0x00156480,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a024e,
+	0x00000000, 0x00181a28, 0x00000000, 0x001a1b40, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019100f, 0x0017504a,
+	0x00195160, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b5c01, 0x0015494e, 0x00000000, 0x00190a28,
+	0x00174a66, 0x00000000, 0x00156240, 0x00000000, 0x00000000, 0x00000000,
+	0x00196470, 0x00000000, 0x0016d144, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017032f,
+	0x001a1900, 0x00151b08, 0x0015436a, 0x00174481, 0x00000000, 0x00000000,
+	0x00000000, 0x0014ca49, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a2288, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00181204, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00174826, 0x00000000, 0x00000000, 0x00156000,
+	0x00000000, 0x00000000, 0x00000000, 0x00196230, 0x001b6348, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154129, 0x00000000, 0x00174241, 0x00000000, 0x00000000,
+	0x00000000, 0x001b4473, 0x00000000, 0x00000000, 0x0014c80b, 0x00195c4d,
+	0x0016c920, 0x00000000, 0x00000000, 0x001a2048, 0x00494101, 0x00000000,
+	0x00000000, 0x00274b01, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0014c225,
+	0x001a0173, 0x00000000, 0x00000000, 0x0018194f, 0x00000000, 0x001a1a64,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00260800, 0x001b6108, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00195086, 0x00000000, 0x00000000, 0x00181369, 0x00000000,
+	0x001a1481, 0x00000000, 0x00000000, 0x00000000, 0x001b4233, 0x00000000,
+	0x00000000, 0x00195a0c, 0x00000000, 0x001b5b24, 0x00154873, 0x00000000,
+	0x0017498a, 0x0019094f, 0x00000000, 0x00156164, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00175310, 0x00000000, 0x00195429, 0x00000000, 0x00000000, 0x00000000,
+	0x0015428e, 0x00000000, 0x0019036a, 0x00151a2c, 0x00155b80, 0x00171b44,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00181128, 0x00000000, 0x001a1240, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194862,
+	0x00000000, 0x002a1b00, 0x00180b45, 0x00000000, 0x00000000, 0x00000000,
+	0x001b626c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b5300, 0x00000000, 0x0015404e, 0x00000000, 0x0019012a,
+	0x00174166, 0x00171904, 0x00155940, 0x00000000, 0x00000000, 0x00195b73,
+	0x00000000, 0x0016c846, 0x001b5c89, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00194c05, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00151208, 0x00000000, 0x00171321, 0x00000000, 0x00000000,
+	0x00000000, 0x0014c14a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a198a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b602c, 0x00000000, 0x00000000,
+	0x001a2310, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00160209,
+	0x00000000, 0x00180321, 0x00195933, 0x00000000, 0x001b5a48, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015608a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019534d, 0x001b5465,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00171a68, 0x00274201, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00174c53, 0x00000000, 0x00000000,
+	0x0015642c, 0x00000000, 0x0018104f, 0x00000000, 0x001a1166, 0x0015136d,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00180a6a, 0x00000000,
+	0x001a0b80, 0x001b6192, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019510c, 0x00000000, 0x001b5224, 0x00000000, 0x00000000, 0x00000000,
+	0x0019004f, 0x0017408a, 0x00000000, 0x0017182b, 0x00155866, 0x00191940,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00174a11, 0x00000000, 0x00194b29, 0x00000000, 0x00176304, 0x001b4c41,
+	0x00000000, 0x00000000, 0x0015112f, 0x00000000, 0x00171244, 0x00155280,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0017442f, 0x00000000, 0x00000000, 0x00155c09, 0x00000000,
+	0x00000000, 0x0018082a, 0x00000000, 0x00000000, 0x00150b49, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x002a1200, 0x00000000, 0x00180246, 0x00000000, 0x00000000, 0x001b596e,
+	0x00000000, 0x00000000, 0x00000000, 0x001a1c51, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00171004, 0x00155040, 0x00000000, 0x00000000, 0x00195273,
+	0x00000000, 0x001b538a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00194305, 0x00000000, 0x00000000, 0x00000000, 0x00255900, 0x00000000,
+	0x00000000, 0x00150908, 0x00170a21, 0x00000000, 0x00000000, 0x00000000,
+	0x00194c8e, 0x00156350, 0x00000000, 0x00176468, 0x00000000, 0x001a108a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00150325, 0x00000000, 0x00000000, 0x001a1a10,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00195033, 0x00000000, 0x001b514a, 0x00000000,
+	0x00000000, 0x001a142d, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00191866, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00194a4f, 0x00156110, 0x001b4b64,
+	0x00176228, 0x00000000, 0x00196340, 0x00000000, 0x00000000, 0x0017116a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00174353, 0x0019446a, 0x00155b2c,
+	0x00000000, 0x00175c45, 0x00000000, 0x00000000, 0x001a0866, 0x00150a6e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0018016a, 0x00000000, 0x001a0282,
+	0x001b5892, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019480f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a0c09,
+	0x00196100, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174113,
+	0x00000000, 0x0019422a, 0x00000000, 0x00000000, 0x00175a04, 0x00000000,
+	0x00000000, 0x00000000, 0x0015082f, 0x00154982, 0x00170946, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017638c, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00155308, 0x00000000, 0x00175421,
+	0x00000000, 0x00000000, 0x00000000, 0x0015024a, 0x00000000, 0x00170361,
+	0x00000000, 0x00000000, 0x00000000, 0x00155c91, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00161120, 0x001b506e,
+	0x00000000, 0x00000000, 0x001a1353, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194973, 0x00000000,
+	0x001b4a8a, 0x0017614c, 0x00000000, 0x00196264, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0015000b, 0x001b5411, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00155a53, 0x0019438e, 0x00175b68, 0x00191b2c, 0x00195c81, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00350800, 0x00000000, 0x00000000, 0x00000000, 0x001a1113,
+	0x00000000, 0x00000000, 0x0015546d, 0x00000000, 0x00148105, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b484a, 0x00000000, 0x00000000,
+	0x001a0b2c, 0x00196024, 0x00000000, 0x00000000, 0x00000000, 0x001a2420,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00155813, 0x0019414f, 0x00175928,
+	0x001b4266, 0x00195a40, 0x00000000, 0x00000000, 0x00000000, 0x0017086a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015522c,
+	0x00000000, 0x00191309, 0x00175344, 0x00000000, 0x0015016e, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00151a60, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154c49, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00161046,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00195800, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00176073, 0x00000000, 0x0019618a, 0x001a0c92,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175104, 0x00000000,
+	0x00000000, 0x00291000, 0x00000000, 0x00170046, 0x00154082, 0x00000000,
+	0x00151820, 0x00000000, 0x00000000, 0x00000000, 0x00175a8e, 0x00000000,
+	0x002b4301, 0x00000000, 0x00000000, 0x00154a08, 0x00000000, 0x00174b21,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0016d200, 0x00000000, 0x00155392, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154425, 0x00355200,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a0a53, 0x001b6060, 0x00000000, 0x00000000,
+	0x001a2344, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00140125, 0x00194073, 0x00000000,
+	0x0017584e, 0x001b418a, 0x00195964, 0x001a046e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b4b10, 0x00000000, 0x00000000, 0x00000000, 0x001b6404, 0x00000000,
+	0x00155153, 0x00000000, 0x0019122c, 0x0017526a, 0x00195381, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a0813, 0x00000000,
+	0x00000000, 0x00154b6e, 0x00000000, 0x001a2104, 0x00174c85, 0x00000000,
+	0x00156460, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a022e, 0x00000000, 0x00000000, 0x00181a08, 0x001a1b20, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017502b,
+	0x00000000, 0x00195140, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015492e, 0x00295a00,
+	0x00190a08, 0x00174a45, 0x00000000, 0x00156220, 0x00000000, 0x00000000,
+	0x00000000, 0x00196450, 0x00151160, 0x0016d124, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0017030d, 0x0015434a, 0x00174461, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0014ca29, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a2268, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a0392, 0x0019588a,
+	0x00000000, 0x00181b6c, 0x00000000, 0x001a1c85, 0x00000000, 0x003a0201,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00196210, 0x00000000,
+	0x001b6328, 0x00000000, 0x00000000, 0x0017518e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154109, 0x00174221, 0x00000000,
+	0x00000000, 0x00000000, 0x001b4453, 0x00000000, 0x00000000, 0x00195c2d,
+	0x00000000, 0x0016c900, 0x00000000, 0x00154a92, 0x001a2028, 0x00190b6e,
+	0x00000000, 0x00156384, 0x00000000, 0x00000000, 0x00354900, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0014c205, 0x001a0153, 0x00000000, 0x0018192c, 0x00000000,
+	0x001a1a44, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00195066, 0x00000000, 0x00000000, 0x00181349,
+	0x00000000, 0x001a1461, 0x00000000, 0x00000000, 0x00000000, 0x001b4213,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5b04, 0x00154853,
+	0x00000000, 0x0017496a, 0x0019092f, 0x00194a82, 0x00156144, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016d04a, 0x001b648c,
+	0x00000000, 0x00000000, 0x00000000, 0x00195409, 0x00000000, 0x00000000,
+	0x00000000, 0x0015426e, 0x00000000, 0x0019034a, 0x00151a0c, 0x00155b60,
+	0x00171b24, 0x00174386, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a218e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00181108, 0x00000000, 0x001a1220, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00180b25, 0x00000000,
+	0x00000000, 0x001b624c, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015402e, 0x00295100,
+	0x00174146, 0x00000000, 0x00155920, 0x00000000, 0x00000000, 0x00000000,
+	0x00195b50, 0x00000000, 0x0016c826, 0x00150862, 0x001b5c69, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00390900, 0x00000000, 0x00000000, 0x00171301, 0x00000000,
+	0x00000000, 0x00000000, 0x0014c12b, 0x00000000, 0x0016c241, 0x00000000,
+	0x00000000, 0x001a196a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b600c, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0018126e, 0x00000000, 0x001a1384, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00180301, 0x00195910, 0x00000000, 0x001b5a28,
+	0x00000000, 0x00000000, 0x00000000, 0x0017488e, 0x00000000, 0x0015606a,
+	0x00000000, 0x00176180, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019532d,
+	0x00000000, 0x001b5445, 0x00154192, 0x00000000, 0x0019026e, 0x00000000,
+	0x00000000, 0x00171a48, 0x00155a84, 0x00191b60, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174c31, 0x00000000,
+	0x00000000, 0x0015640c, 0x00000000, 0x0018102f, 0x00000000, 0x00000000,
+	0x0015134d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00180a4a,
+	0x00000000, 0x001a0b60, 0x001b6173, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b5204, 0x00000000, 0x00000000,
+	0x00000000, 0x0019002f, 0x0017406a, 0x00194182, 0x00171808, 0x00155844,
+	0x00191920, 0x00000000, 0x00000000, 0x001b5b8e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00194b09, 0x00000000, 0x001b4c21,
+	0x00000000, 0x00000000, 0x00000000, 0x0015110c, 0x00000000, 0x00171224,
+	0x00155260, 0x00000000, 0x00000000, 0x00195492, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a188e, 0x0017440d, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150b29,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b594e, 0x00000000, 0x00000000, 0x00000000, 0x001a1c31, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155020, 0x00000000, 0x00000000, 0x00000000,
+	0x00195253, 0x00000000, 0x001b5368, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0017196e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00170a01, 0x00000000,
+	0x00000000, 0x00194c6e, 0x00156330, 0x00000000, 0x00176448, 0x00000000,
+	0x001a106a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00150305, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0018096e, 0x00000000, 0x001a0a86, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00195013, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a140d, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00191844, 0x00175882, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194a2f, 0x00000000,
+	0x001b4b44, 0x00176208, 0x00000000, 0x00196320, 0x00000000, 0x00000000,
+	0x0017114a, 0x00155186, 0x00191260, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174333, 0x00000000,
+	0x00155b0c, 0x0019444a, 0x00175c25, 0x00000000, 0x00000000, 0x00000000,
+	0x00150a4f, 0x00000000, 0x00170b65, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0018014a, 0x00000000,
+	0x00000000, 0x001b5873, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b528e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0015080f, 0x00000000, 0x00170924,
+	0x00154960, 0x00000000, 0x00194b92, 0x00000000, 0x00000000, 0x0017636c,
+	0x00000000, 0x0014d040, 0x00196484, 0x00000000, 0x00394a01, 0x00000000,
+	0x00175401, 0x00000000, 0x00000000, 0x00000000, 0x0015022a, 0x00000000,
+	0x00170341, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155c71,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00161100,
+	0x001b504e, 0x00000000, 0x00000000, 0x001a1330, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194953,
+	0x00000000, 0x001b4a6a, 0x0017612c, 0x00000000, 0x00196244, 0x00000000,
+	0x00000000, 0x00000000, 0x0017106e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00155a30, 0x0019436e, 0x00175b48, 0x00191b0c, 0x00195c61,
+	0x001b4486, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0015544d, 0x00000000, 0x0018006e,
+	0x00000000, 0x001a0186, 0x00000000, 0x00000000, 0x00181960, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a0b0c, 0x00196004, 0x00000000, 0x00000000, 0x00000000,
+	0x001a2400, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019412f, 0x00000000,
+	0x00175908, 0x00000000, 0x00195a20, 0x00000000, 0x00000000, 0x00000000,
+	0x0017084a, 0x00154886, 0x00190962, 0x00000000, 0x00000000, 0x00000000,
+	0x00176292, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0015520c, 0x00000000, 0x00175324, 0x00000000, 0x00000000, 0x0015014f,
+	0x00000000, 0x00170266, 0x00000000, 0x00000000, 0x00151a40, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154c29, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00161024, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00160a41, 0x00176053, 0x001b498e, 0x0019616a,
+	0x001a0c73, 0x001b6280, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00170026, 0x00154062,
+	0x00000000, 0x00151800, 0x00194292, 0x00000000, 0x00000000, 0x00175a6e,
+	0x00000000, 0x00195b84, 0x00000000, 0x00394101, 0x00000000, 0x00000000,
+	0x00174b01, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155373, 0x00000000,
+	0x00175489, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154405, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a0a33, 0x001b6040, 0x00000000,
+	0x00000000, 0x001a2324, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00140105, 0x00194053,
+	0x00000000, 0x0017582f, 0x001b416a, 0x00195944, 0x001a044e, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00155133, 0x00000000, 0x0019120c, 0x00175248, 0x00195361,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00151964,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154b4e, 0x00000000, 0x00174c65, 0x00000000,
+	0x00000000, 0x00156440, 0x00000000, 0x00000000, 0x00181062, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a1b00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019608e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a2488, 0x00175008, 0x00195120, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00190062, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00175992, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015490c,
+	0x00000000, 0x00174a25, 0x00000000, 0x00000000, 0x00156200, 0x00000000,
+	0x00000000, 0x00000000, 0x00196430, 0x00000000, 0x0016d104, 0x00151140,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154329, 0x00000000, 0x00174441, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0014ca09, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a2248, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00160142, 0x001b408e, 0x00000000, 0x00000000, 0x001a0373,
+	0x0019586a, 0x001b5980, 0x00181b4c, 0x00000000, 0x001a1c65, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b6308, 0x00000000, 0x00000000, 0x0017516e, 0x00000000,
+	0x00195286, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00174201, 0x00000000, 0x00000000, 0x001b4433, 0x00000000, 0x00000000,
+	0x00195c0d, 0x00000000, 0x00000000, 0x00000000, 0x00154a73, 0x001a2008,
+	0x00190b4f, 0x00174b8a, 0x00156364, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a0133, 0x00000000, 0x00000000, 0x0018190c,
+	0x0015448e, 0x001a1a24, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00195046, 0x00000000, 0x00000000,
+	0x00181329, 0x00000000, 0x001a1441, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154833, 0x00000000, 0x0017494a, 0x0019090f, 0x00194a60, 0x00156124,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016d02b,
+	0x00151066, 0x001b646c, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0015424e, 0x00000000, 0x00190329, 0x00174366,
+	0x00000000, 0x00171b04, 0x00155b40, 0x00000000, 0x00000000, 0x00000000,
+	0x0016ca45, 0x00000000, 0x00000000, 0x00000000, 0x001a216e, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a1200,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a1b88,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00180b05,
+	0x00000000, 0x00000000, 0x001b622c, 0x00000000, 0x00000000, 0x00175092,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015400f,
+	0x00000000, 0x00174126, 0x00000000, 0x00155900, 0x00000000, 0x00000000,
+	0x00000000, 0x00195b30, 0x00000000, 0x00150840, 0x001b5c49, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00156288, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00251100, 0x00000000, 0x0014c10b, 0x00000000, 0x0016c221,
+	0x00000000, 0x00000000, 0x001a1948, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b5082, 0x0018124f, 0x00000000, 0x001a1364, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00260101, 0x00000000,
+	0x001b5a08, 0x00000000, 0x00000000, 0x00000000, 0x0017486e, 0x00000000,
+	0x00156048, 0x00194986, 0x00176160, 0x00000000, 0x00000000, 0x00000000,
+	0x001b6390, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019530d, 0x00000000, 0x001b5425, 0x00154173, 0x00000000, 0x0019024f,
+	0x0017428a, 0x00000000, 0x00171a28, 0x00155a64, 0x00191b40, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a2092,
+	0x00174c11, 0x00000000, 0x00000000, 0x00000000, 0x0018100f, 0x00000000,
+	0x00000000, 0x0015132d, 0x00000000, 0x00155481, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00180a28, 0x00000000, 0x001a0b40, 0x001b6153, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0019000f, 0x0017404a, 0x00194162, 0x00155824,
+	0x00000000, 0x00191900, 0x00000000, 0x00000000, 0x001b5b6c, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b4c01, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00171204, 0x00155240, 0x00000000, 0x00000000, 0x00195473, 0x00000000,
+	0x0016c146, 0x00000000, 0x00000000, 0x001a186e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00255b00, 0x00000000,
+	0x00150b09, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a128a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b592c, 0x00000000, 0x00000000, 0x00000000, 0x001a1c11,
+	0x00000000, 0x00000000, 0x00000000, 0x00176086, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00155000, 0x00000000, 0x00000000,
+	0x00000000, 0x00195233, 0x00000000, 0x001b5348, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0017194f, 0x0015598a, 0x00191a64,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00194c4f, 0x00156310, 0x00000000, 0x00176428,
+	0x00000000, 0x001a104a, 0x00000000, 0x00000000, 0x00000000, 0x00171369,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0018094f, 0x00000000, 0x001a0a66, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194086,
+	0x00000000, 0x00000000, 0x0018036a, 0x00191824, 0x001a0481, 0x00175860,
+	0x001b5a92, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194a0c,
+	0x00000000, 0x001b4b24, 0x00000000, 0x00000000, 0x00196300, 0x00000000,
+	0x00000000, 0x00171128, 0x00155166, 0x00191240, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174313,
+	0x00000000, 0x00194429, 0x00000000, 0x00175c05, 0x00000000, 0x00000000,
+	0x00000000, 0x00150a2f, 0x00000000, 0x00170b45, 0x00154b80, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0018012a,
+	0x00000000, 0x00000000, 0x00000000, 0x001b5853, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x002a0b01,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b526e, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00170904, 0x00154940, 0x00000000, 0x00194b73, 0x00000000, 0x001b4c8a,
+	0x0017634c, 0x00000000, 0x0014d020, 0x00196464, 0x00000000, 0x00000000,
+	0x00474800, 0x00000000, 0x00000000, 0x00255200, 0x00000000, 0x00150209,
+	0x00000000, 0x00170321, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00155c51, 0x00000000, 0x00000000, 0x00000000, 0x001a098a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b502e, 0x00000000, 0x00000000, 0x001a1310, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00194933, 0x00000000, 0x001b4a4a, 0x0017610c, 0x00000000, 0x00196224,
+	0x00000000, 0x00000000, 0x0015508a, 0x0017104f, 0x00000000, 0x00191166,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155a10, 0x0019434f, 0x00175b28, 0x001b4465,
+	0x00195c41, 0x00000000, 0x00000000, 0x00000000, 0x00170a6a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015542d, 0x00000000,
+	0x00000000, 0x0018004f, 0x001a0166, 0x00000000, 0x0015036e, 0x00181940,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00161244,
+	0x001b5192, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019410f,
+	0x003b5000, 0x00000000, 0x00000000, 0x00195a00, 0x00000000, 0x00000000,
+	0x00000000, 0x0017082b, 0x00154866, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00176273, 0x00000000, 0x00196388, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00175304, 0x00000000, 0x00000000,
+	0x0015012f, 0x00291200, 0x00170246, 0x00154282, 0x00000000, 0x00151a20,
+	0x00000000, 0x00000000, 0x00000000, 0x00175c8d, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154c09, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00161004, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00160a21, 0x00176033, 0x001b496e,
+	0x00196148, 0x001a0c53, 0x001b6260, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154042,
+	0x00000000, 0x00000000, 0x00000000, 0x00194273, 0x00000000, 0x001b438a,
+	0x00175a4c, 0x00000000, 0x00195b64, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155353,
+	0x00000000, 0x00175469, 0x00000000, 0x00000000, 0x001a008a, 0x00000000,
+	0x00181866, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00350101, 0x00000000, 0x00000000, 0x00000000, 0x001a0a13, 0x001b6020,
+	0x00000000, 0x00000000, 0x001a2304, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00194033, 0x00000000, 0x001b414a, 0x0017580c, 0x00195924, 0x001a042d,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00190866, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155113, 0x00000000, 0x00175228, 0x00000000,
+	0x00195341, 0x00000000, 0x00000000, 0x00000000, 0x0017016a, 0x00000000,
+	0x00151944, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154b2c, 0x00000000, 0x00174c45,
+	0x00000000, 0x00000000, 0x00156420, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00151361, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00160946, 0x001b4892,
+	0x00000000, 0x0019606e, 0x00000000, 0x001b6184, 0x00000000, 0x00000000,
+	0x00000000, 0x001a2468, 0x00000000, 0x00195100, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00175973, 0x00000000, 0x00195a8a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00174a05, 0x00000000, 0x00000000, 0x00000000,
+	0x00290900, 0x00000000, 0x00000000, 0x00196410, 0x00000000, 0x00151120,
+	0x00000000, 0x00000000, 0x0017538e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154309, 0x00000000, 0x00174421, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154c92, 0x001a2228, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b406e, 0x00000000, 0x00000000,
+	0x001a0353, 0x0019584a, 0x001b5960, 0x00181b2c, 0x00000000, 0x001a1c45,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017514e,
+	0x00000000, 0x00195264, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0015186a, 0x00000000, 0x00000000, 0x001b4411, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154a53,
+	0x00000000, 0x00190b2d, 0x00174b6a, 0x00156344, 0x00194c81, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0016d248, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a0113, 0x00000000, 0x00000000,
+	0x0015446e, 0x00000000, 0x001a1a04, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a238c, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00181309, 0x00000000, 0x001a1421, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154813, 0x0017492b, 0x00000000, 0x00194a40,
+	0x00156104, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0016d008, 0x00151046, 0x001b644c, 0x00000000, 0x00000000, 0x00000000,
+	0x004b4900, 0x00000000, 0x00000000, 0x0015422e, 0x00295301, 0x00190309,
+	0x00174346, 0x00000000, 0x00155b20, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0016ca25, 0x00150a60, 0x00000000, 0x00000000, 0x001a214c,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00281000, 0x00000000, 0x00160046, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b5886, 0x00000000, 0x00000000,
+	0x001a1b68, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b620c, 0x00000000, 0x00000000,
+	0x00175073, 0x00000000, 0x0019518a, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00195b10, 0x00000000, 0x00150820, 0x001b5c29,
+	0x00000000, 0x00000000, 0x00174a8e, 0x00000000, 0x00156268, 0x00000000,
+	0x00176380, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0016c201, 0x00154392, 0x00000000, 0x001a1928, 0x00000000, 0x00000000,
+	0x00155c85, 0x00000000, 0x00354201, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0018122c, 0x00000000, 0x001a1344, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017484e,
+	0x00000000, 0x00156028, 0x00194966, 0x00176140, 0x00000000, 0x00000000,
+	0x00000000, 0x001b6370, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b5405, 0x00154153, 0x00000000,
+	0x0019022f, 0x0017426a, 0x00194382, 0x00171a08, 0x00155a44, 0x00191b20,
+	0x00000000, 0x00000000, 0x00000000, 0x0016c94a, 0x00000000, 0x00000000,
+	0x001a2073, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0015130d, 0x00000000, 0x00155461, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a1a8e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00180a08, 0x00000000, 0x001a0b20, 0x001b6130, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0017402b, 0x00000000, 0x00000000,
+	0x00155804, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5b4c,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0015618e, 0x00000000, 0x00000000, 0x00294a01, 0x00000000, 0x00000000,
+	0x00000000, 0x00155220, 0x00000000, 0x00000000, 0x00000000, 0x00195451,
+	0x00000000, 0x0016c126, 0x00150162, 0x00000000, 0x001a184e, 0x00000000,
+	0x00000000, 0x00171b6c, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a126a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b590c, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0019488a, 0x00000000, 0x00176066, 0x00180b6e,
+	0x00000000, 0x001a0c85, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00195210, 0x00000000, 0x001b5328, 0x00000000,
+	0x00000000, 0x0017418e, 0x00000000, 0x00000000, 0x0017192c, 0x0015596a,
+	0x00191a44, 0x00175a80, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00194c2d, 0x00000000, 0x00000000,
+	0x00176408, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155384,
+	0x00171349, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0018092f, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00194066, 0x00000000, 0x00000000, 0x0018034a, 0x00191804, 0x001a0461,
+	0x00175840, 0x001b5a73, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b4b04, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155144, 0x00171108, 0x00191220, 0x00000000,
+	0x00000000, 0x00000000, 0x0016c04a, 0x001b548e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00194409, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00150a0c, 0x00000000, 0x00170b25, 0x00154b60,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0014d240, 0x001a118e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5833, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00380900, 0x00000000, 0x00000000, 0x00000000, 0x001b524e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015588e,
+	0x00000000, 0x0019196a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154920, 0x00000000, 0x00000000, 0x00000000, 0x00194b53,
+	0x001b4c69, 0x0017632c, 0x00000000, 0x0014d000, 0x00196444, 0x00000000,
+	0x00000000, 0x0017126e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00170301, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00155c31, 0x00000000, 0x00000000, 0x00000000, 0x001a096a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0018026e,
+	0x00000000, 0x001a0386, 0x00000000, 0x00181b60, 0x00000000, 0x00000000,
+	0x00000000, 0x00194913, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00196204, 0x00000000, 0x00000000, 0x00000000, 0x0017102f, 0x0015506a,
+	0x00191144, 0x00175180, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0019432f, 0x00000000, 0x00175b08,
+	0x001b4445, 0x00195c21, 0x00000000, 0x00000000, 0x00000000, 0x00170a4a,
+	0x00154a86, 0x00190b61, 0x00000000, 0x00000000, 0x00000000, 0x00176490,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015540d,
+	0x00000000, 0x00000000, 0x0018002f, 0x00000000, 0x00000000, 0x0015034f,
+	0x00181920, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00161224, 0x001b5173, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00275800, 0x00000000, 0x0017080b, 0x00154844, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00176250, 0x001b4b8e, 0x00196368, 0x00000000,
+	0x001b6480, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0015010f, 0x00170225, 0x00154261, 0x00000000,
+	0x00151a00, 0x00194492, 0x00000000, 0x00000000, 0x00175c6d, 0x00000000,
+	0x0014c940, 0x001a088e, 0x00000000, 0x00000000, 0x00000000, 0x001a2180,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00160a01, 0x00176010,
+	0x001b494e, 0x00196128, 0x001a0c31, 0x001b6240, 0x00000000, 0x00000000,
+	0x00000000, 0x0019106a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154022, 0x00000000, 0x00000000, 0x00000000, 0x00194253, 0x00000000,
+	0x001b436a, 0x00175a2c, 0x00000000, 0x00195b44, 0x00000000, 0x00000000,
+	0x0017096e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00155330, 0x00000000, 0x00175449, 0x00000000, 0x00000000, 0x001a006a,
+	0x00000000, 0x00181844, 0x00000000, 0x00000000, 0x00151b64, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b6000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00161148, 0x00000000, 0x00181260, 0x00000000, 0x00000000,
+	0x00000000, 0x00194013, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a040d, 0x00195904, 0x00000000, 0x00000000, 0x00000000, 0x00190846,
+	0x00174882, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019628e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175208,
+	0x00000000, 0x00195321, 0x00000000, 0x00000000, 0x00154186, 0x0017014a,
+	0x00000000, 0x00151924, 0x00190262, 0x00000000, 0x00000000, 0x00175b92,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154b0c, 0x00000000,
+	0x00174c25, 0x00000000, 0x00000000, 0x00156400, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00151341, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00160924,
+	0x001b4873, 0x00000000, 0x0019604f, 0x00000000, 0x001b6164, 0x00000000,
+	0x00000000, 0x00000000, 0x001a2448, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b428e, 0x00175953, 0x00000000, 0x00195a68, 0x00000000,
+	0x001b5b80, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00151100, 0x00000000, 0x00000000, 0x0017536e, 0x00000000, 0x0014c042,
+	0x00195485, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a1882,
+	0x00174401, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0024c900, 0x00154c73, 0x001a2208,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b404e, 0x00000000,
+	0x00000000, 0x001a0333, 0x00195828, 0x001b5940, 0x00181b0c, 0x00000000,
+	0x001a1c25, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0017512f, 0x00000000, 0x00195244, 0x00000000, 0x00000000, 0x00000000,
+	0x0017006e, 0x00000000, 0x00000000, 0x0015184a, 0x00171960, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154a33, 0x00000000, 0x00190b0d, 0x00174b49, 0x00156324, 0x00194c61,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016d228, 0x00151264,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0015444e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0016084a, 0x00000000, 0x00180962, 0x00000000, 0x00000000, 0x00000000,
+	0x001b608a, 0x00000000, 0x00000000, 0x001a236c, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a1401, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019598e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174908,
+	0x00194a20, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00151024, 0x001b642c, 0x00000000, 0x00000000, 0x00175292,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015420d, 0x00000000,
+	0x00174325, 0x00375100, 0x00000000, 0x00155b00, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0016ca05, 0x00150a40, 0x00000000, 0x00000000,
+	0x001a212c, 0x00000000, 0x00000000, 0x00156488, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00160026,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5866, 0x00000000,
+	0x00000000, 0x001a1b48, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00175053, 0x00000000, 0x0019516a, 0x00000000, 0x001b5280,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150800,
+	0x001b5c09, 0x00000000, 0x00000000, 0x00174a6e, 0x00000000, 0x00194b86,
+	0x00156248, 0x00176360, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154373, 0x00000000, 0x001a1908, 0x0017448a,
+	0x00000000, 0x00155c65, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a2292, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0018120c, 0x001a1324,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0017482f, 0x002b5900, 0x00156008, 0x00194946, 0x00176120, 0x00000000,
+	0x00000000, 0x00000000, 0x001b6350, 0x00000000, 0x00171062, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154133,
+	0x00000000, 0x0019020f, 0x0017424a, 0x00194361, 0x00155a24, 0x00000000,
+	0x00191b00, 0x00000000, 0x00000000, 0x00000000, 0x0016c92b, 0x00150966,
+	0x00000000, 0x001a2053, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155441,
+	0x00000000, 0x00000000, 0x00180062, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a1a6e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a0b00, 0x001b6110,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019508e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a1489, 0x0017400b,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b5b2c, 0x00000000, 0x00000000, 0x00174992, 0x00000000,
+	0x00000000, 0x0015616e, 0x00000000, 0x00176284, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155200, 0x00000000, 0x00000000, 0x00000000,
+	0x00195431, 0x00000000, 0x00150141, 0x00000000, 0x00000000, 0x001a182e,
+	0x00000000, 0x00000000, 0x00171b4c, 0x00155b88, 0x00148820, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00250a01,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a1248, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0019486a, 0x00000000, 0x001b4982,
+	0x00180b4f, 0x00176044, 0x001a0c65, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5308,
+	0x00000000, 0x00000000, 0x0017416e, 0x00000000, 0x00194286, 0x0017190c,
+	0x00155948, 0x00191a24, 0x00175a60, 0x00000000, 0x00000000, 0x001b5c91,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194c0d, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00155364, 0x00171329, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a1992, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0018090f, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00194046, 0x00000000, 0x00000000, 0x00175820, 0x00180329,
+	0x001a0441, 0x00000000, 0x001b5a53, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00156092, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00155124, 0x00000000, 0x00000000,
+	0x00191200, 0x00000000, 0x00000000, 0x0016c02b, 0x00150066, 0x001b546d,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00170b05,
+	0x00154b40, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0014d220, 0x001a116e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5813,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a0b8a, 0x00196080, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b522c, 0x00000000, 0x00000000, 0x00000000, 0x00174092, 0x00000000,
+	0x0015586e, 0x00000000, 0x00191948, 0x00175986, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154900, 0x00000000, 0x00000000, 0x00000000,
+	0x00194b33, 0x00000000, 0x0017630c, 0x001b4c49, 0x00196424, 0x00000000,
+	0x00000000, 0x00000000, 0x0017124f, 0x0015528a, 0x00191365, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155c11, 0x00000000, 0x00000000, 0x00000000,
+	0x001a094a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b4082, 0x00000000,
+	0x0018024f, 0x00000000, 0x001a0366, 0x00000000, 0x00181b40, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017100f,
+	0x0015504a, 0x00191124, 0x00175160, 0x00000000, 0x001b5392, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019430d, 0x00000000,
+	0x001b4425, 0x003b5200, 0x00195c01, 0x00000000, 0x00000000, 0x00000000,
+	0x00170a29, 0x00154a66, 0x00190b41, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00176470, 0x00000000, 0x0014d144, 0x001a1092, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0018000f, 0x00000000, 0x00000000,
+	0x0015032f, 0x00181900, 0x00154481, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00161204, 0x001b5153, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019186e, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154824, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00176230, 0x001b4b6e, 0x00196348,
+	0x00000000, 0x001b6460, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154241, 0x00170205,
+	0x00000000, 0x00000000, 0x00194473, 0x00000000, 0x00000000, 0x00175c4d,
+	0x00000000, 0x0014c920, 0x001a086e, 0x00000000, 0x00000000, 0x00474101,
+	0x001a2160, 0x00000000, 0x00254b01, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a028a, 0x00000000, 0x00000000,
+	0x00181a64, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b492e, 0x00000000, 0x00196108, 0x001a0c11, 0x001b6220, 0x00000000,
+	0x00000000, 0x00000000, 0x0019104a, 0x00175086, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194233,
+	0x00000000, 0x001b434a, 0x00175a0c, 0x00000000, 0x00195b24, 0x00000000,
+	0x00000000, 0x0017094f, 0x0015498a, 0x00190a66, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00155310, 0x00000000, 0x00175429, 0x00000000, 0x00000000,
+	0x001a004a, 0x00000000, 0x00181824, 0x0017036a, 0x00000000, 0x00151b44,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00161128, 0x00000000, 0x00181240, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00174862, 0x00000000, 0x00000000, 0x00000000, 0x001b4a92, 0x00000000,
+	0x00000000, 0x0019626c, 0x00000000, 0x001b6384, 0x00000000, 0x003b4900,
+	0x00000000, 0x00000000, 0x00195301, 0x00000000, 0x00000000, 0x00000000,
+	0x0017012b, 0x00154166, 0x00151904, 0x00000000, 0x00000000, 0x00000000,
+	0x00175b73, 0x00000000, 0x0014c846, 0x00195c89, 0x00000000, 0x00000000,
+	0x00000000, 0x001a2086, 0x00174c05, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00151321, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00160904, 0x001b4853, 0x00000000, 0x0019602f, 0x00000000, 0x001b6144,
+	0x00000000, 0x00000000, 0x00000000, 0x001a2428, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b426e, 0x00175933, 0x00000000, 0x00195a48,
+	0x00000000, 0x001b5b60, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017534c, 0x00000000,
+	0x0014c022, 0x00195465, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00151a68, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154c53, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00181166,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b402e,
+	0x00000000, 0x00000000, 0x001a0313, 0x00195808, 0x001b5920, 0x00000000,
+	0x00000000, 0x001a1c05, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00196192, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0017510c, 0x00000000, 0x00195224, 0x00000000, 0x00000000,
+	0x00000000, 0x0017004f, 0x0015408a, 0x00190166, 0x00151828, 0x00000000,
+	0x00171940, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154a13, 0x00000000, 0x00174b29, 0x00000000, 0x00156304,
+	0x00194c41, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016d208,
+	0x00151244, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0015442d, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0016082b, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b606a, 0x00000000, 0x00000000, 0x001a234c, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x004a0800, 0x00000000,
+	0x00000000, 0x00281200, 0x00000000, 0x00160246, 0x001b4192, 0x00000000,
+	0x0019596e, 0x00000000, 0x001b5a84, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00194a00, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00151004, 0x001b640c, 0x00000000, 0x00000000,
+	0x00175273, 0x00000000, 0x0019538a, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00174305, 0x00000000, 0x00000000, 0x00000000, 0x00290201,
+	0x00000000, 0x00000000, 0x00000000, 0x00150a20, 0x00000000, 0x00000000,
+	0x00000000, 0x001a210c, 0x00174c8e, 0x00000000, 0x00156468, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a1b28, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00175033, 0x00000000, 0x0019514a, 0x00000000,
+	0x001b5260, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00171866, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174a4e, 0x00000000,
+	0x00194b65, 0x00156228, 0x00176340, 0x00000000, 0x00000000, 0x00000000,
+	0x0015116a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154353, 0x00000000, 0x0017446a,
+	0x00000000, 0x00000000, 0x00155c45, 0x00000000, 0x00000000, 0x00180866,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a2273,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a1304, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00195892, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a1c8d, 0x0017480f, 0x00000000, 0x00000000, 0x00176100,
+	0x00000000, 0x00000000, 0x00000000, 0x001b6330, 0x00000000, 0x00171040,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154113, 0x00000000, 0x0017422b, 0x00000000, 0x00194341, 0x00155a04,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016c908,
+	0x00150946, 0x00000000, 0x001a2033, 0x00000000, 0x00000000, 0x0015638c,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00155421, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00150361, 0x00000000, 0x00000000, 0x001a1a4c, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00280900, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019506e, 0x00000000, 0x001b5186, 0x00000000, 0x00000000, 0x001a1469,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b5b0c, 0x00000000, 0x00000000, 0x00174973,
+	0x00000000, 0x00194a8a, 0x0015614c, 0x00000000, 0x00176264, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00195411, 0x00000000, 0x00150121, 0x00000000, 0x00000000,
+	0x00000000, 0x0017438e, 0x00000000, 0x00171b2c, 0x00155b68, 0x00148800,
+	0x00175c81, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a1228, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019484a, 0x00000000,
+	0x00000000, 0x00180b2d, 0x00176024, 0x001a0c45, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0017414e, 0x00000000, 0x00194266,
+	0x00155928, 0x00000000, 0x00191a04, 0x00175a40, 0x00000000, 0x00000000,
+	0x0015086a, 0x001b5c71, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00171309, 0x00155344, 0x00000000, 0x00000000,
+	0x00000000, 0x0016c24a, 0x00000000, 0x00000000, 0x00000000, 0x001a1973,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a138e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175800,
+	0x00180309, 0x00000000, 0x001a0421, 0x001b5a30, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00156073, 0x00000000, 0x0017618a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155104, 0x00000000,
+	0x00000000, 0x00000000, 0x00271000, 0x00000000, 0x0016c00b, 0x00150046,
+	0x001b544d, 0x00000000, 0x00000000, 0x00000000, 0x00155a8e, 0x00000000,
+	0x00000000, 0x00191b68, 0x00294301, 0x00000000, 0x00000000, 0x00000000,
+	0x00154b20, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0014d200, 0x001a114e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00140820,
+	0x00000000, 0x001b4886, 0x00000000, 0x00000000, 0x001a0b6a, 0x00196060,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b520c, 0x00000000, 0x00000000, 0x00000000, 0x00174073,
+	0x00000000, 0x0015584e, 0x0019418a, 0x00191928, 0x00175964, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00194b11, 0x00000000, 0x001b4c29, 0x00000000, 0x00196404,
+	0x00000000, 0x00000000, 0x00000000, 0x0017122c, 0x0015526a, 0x00191345,
+	0x00175380, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154c85, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0018022f, 0x00000000, 0x00000000, 0x00000000, 0x00181b20,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00155028, 0x00000000, 0x00191104, 0x00175140, 0x00000000, 0x001b5373,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b4405, 0x00000000, 0x00000000, 0x00000000, 0x00275a00,
+	0x00000000, 0x00170a09, 0x00154a44, 0x00190b21, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00176450, 0x00000000, 0x0014d124, 0x001a1073,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0015030d, 0x00154461, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a0a8e, 0x00000000, 0x00000000, 0x00000000, 0x001a2380, 0x00000000,
+	0x00000000, 0x00000000, 0x001b5133, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017588a, 0x0019184f,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154804, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00176210, 0x001b4b4e,
+	0x00196328, 0x00000000, 0x001b6440, 0x00000000, 0x0015518e, 0x00000000,
+	0x0019126a, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154221,
+	0x00000000, 0x00000000, 0x00000000, 0x00194453, 0x00000000, 0x00000000,
+	0x00175c2d, 0x00000000, 0x0014c900, 0x001a084e, 0x00000000, 0x00000000,
+	0x00170b6e, 0x001a2140, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a026a, 0x00000000,
+	0x00000000, 0x00181a44, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b6200,
+	0x00000000, 0x00000000, 0x00000000, 0x0019102a, 0x00175066, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00194213, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00195b04,
+	0x00000000, 0x00000000, 0x0017092f, 0x0015496a, 0x00190a44, 0x00174a81,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0014d04a,
+	0x0019648c, 0x00000000, 0x00000000, 0x00000000, 0x00175409, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00181804, 0x0017034a, 0x00154386,
+	0x00000000, 0x00151b24, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00161108, 0x00000000, 0x00181220,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00174842, 0x00000000, 0x00000000, 0x00000000, 0x001b4a73,
+	0x00000000, 0x00000000, 0x0019624c, 0x00000000, 0x001b6364, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00275100,
+	0x00000000, 0x0017010b, 0x00154145, 0x00000000, 0x00000000, 0x00000000,
+	0x001b448e, 0x00175b50, 0x00000000, 0x0014c826, 0x00195c69, 0x00000000,
+	0x00000000, 0x00000000, 0x001a2064, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00370900, 0x00000000, 0x00000000, 0x00151301,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0014c241,
+	0x001a018e, 0x00000000, 0x0018196a, 0x00000000, 0x001a1a80, 0x00000000,
+	0x00000000, 0x00000000, 0x001b4833, 0x00000000, 0x00000000, 0x0019600c,
+	0x001b6124, 0x00000000, 0x00000000, 0x00000000, 0x001a2408, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b424e, 0x00175910, 0x00000000,
+	0x00195a28, 0x00000000, 0x001b5b40, 0x0015488e, 0x00000000, 0x00000000,
+	0x0019096a, 0x00000000, 0x00156180, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017532c,
+	0x00000000, 0x00195445, 0x00000000, 0x00000000, 0x00000000, 0x0017026e,
+	0x00000000, 0x00000000, 0x00151a48, 0x00000000, 0x00171b60, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154c31,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00181144, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5900,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00160a49, 0x00000000, 0x00180b61, 0x00196173, 0x00000000, 0x001b6288,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00195204, 0x00000000,
+	0x00000000, 0x00000000, 0x0017002f, 0x0015406a, 0x00190146, 0x00151808,
+	0x00174182, 0x00171920, 0x00000000, 0x00000000, 0x00195b8e, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174b09, 0x00000000,
+	0x00194c21, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00151224, 0x00000000, 0x00000000, 0x00000000, 0x00175492, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0015440d, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0016080b, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001b6048, 0x00000000, 0x00000000, 0x001a232c,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00160225, 0x001b4173,
+	0x00000000, 0x0019594f, 0x00000000, 0x001b5a64, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00274800, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00175253, 0x00000000, 0x00195369, 0x00000000, 0x001b5481,
+	0x00000000, 0x00000000, 0x00000000, 0x0015196e, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150a00, 0x00000000,
+	0x00000000, 0x00000000, 0x00174c6e, 0x00000000, 0x00000000, 0x00156448,
+	0x00000000, 0x0018106a, 0x00000000, 0x001a1182, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a1b08, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a2490, 0x00175013, 0x00195128,
+	0x00000000, 0x001b5240, 0x00000000, 0x00000000, 0x00000000, 0x0019006a,
+	0x00000000, 0x00000000, 0x00171846, 0x00155882, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174a2f,
+	0x002b5b00, 0x00194b45, 0x00156208, 0x00000000, 0x00176320, 0x00000000,
+	0x00000000, 0x0015114a, 0x00000000, 0x00171260, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154333, 0x00000000,
+	0x0017444a, 0x00000000, 0x00000000, 0x00155c25, 0x002a1800, 0x00000000,
+	0x00180846, 0x00000000, 0x00000000, 0x00150b65, 0x00000000, 0x00000000,
+	0x001a2250, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0016014a,
+	0x00000000, 0x00180262, 0x00195873, 0x00000000, 0x001b598a, 0x00000000,
+	0x00000000, 0x00000000, 0x001a1c6d, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b6310, 0x00000000,
+	0x00171020, 0x00000000, 0x00000000, 0x00000000, 0x0019528e, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00174209, 0x00000000, 0x00194321,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00150924, 0x00000000, 0x00000000, 0x001a2010, 0x00174b92, 0x00000000,
+	0x0015636c, 0x00000000, 0x00176484, 0x00000000, 0x00374a01, 0x00000000,
+	0x00000000, 0x00155401, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00150341, 0x00000000, 0x00000000, 0x001a1a2c, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0019504f, 0x00000000, 0x001b5166, 0x00000000, 0x00000000,
+	0x001a1449, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00174953, 0x00000000, 0x00194a6a, 0x0015612c, 0x001b4b80, 0x00176244,
+	0x00000000, 0x00000000, 0x0015106e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150101, 0x00000000,
+	0x00000000, 0x00000000, 0x0017436e, 0x00000000, 0x00171b0c, 0x00155b48,
+	0x00175c61, 0x00194486, 0x00000000, 0x001a0882, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a1208, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a1b92, 0x00000000, 0x0019482a,
+	0x00000000, 0x00000000, 0x00180b0d, 0x00176004, 0x001a0c25, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017412f, 0x002b5200,
+	0x00194246, 0x00155908, 0x00000000, 0x00175a20, 0x00000000, 0x00000000,
+	0x00000000, 0x0015084a, 0x001b5c51, 0x00170962, 0x00000000, 0x00000000,
+	0x00000000, 0x00156292, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00155324, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0016c22b, 0x00150266, 0x00000000, 0x00000000,
+	0x001a1953, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b508a, 0x00000000,
+	0x00000000, 0x001a136e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a0401, 0x001b5a10, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0019498e, 0x00156053, 0x00000000,
+	0x00176168, 0x00000000, 0x00196280, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150026,
+	0x001b542d, 0x00000000, 0x00000000, 0x00174292, 0x00000000, 0x00155a6e,
+	0x00000000, 0x00175b84, 0x00191b48, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154b00, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a112e, 0x00000000,
+	0x00000000, 0x00155489, 0x00000000, 0x00148121, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00140800, 0x00000000, 0x001b4866, 0x00000000, 0x00000000, 0x001a0b48,
+	0x00196040, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00174053, 0x00000000, 0x0015582e, 0x0019416a, 0x00191908, 0x00175944,
+	0x001b4282, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b4c09, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017120c, 0x00155248,
+	0x00191325, 0x00175360, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154c65,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a1292, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0018020f, 0x003a1100, 0x00000000, 0x00000000,
+	0x00181b00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0017608e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00155008, 0x00000000, 0x00175120, 0x00000000, 0x00000000,
+	0x00000000, 0x001b5353, 0x00170062, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00155992, 0x00000000, 0x00191a6c, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154a24, 0x00000000, 0x00190b01, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00176430, 0x00000000, 0x0014d104,
+	0x001a1053, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154441, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a0a6e, 0x00000000, 0x00000000, 0x00000000, 0x001a2360,
+	0x00000000, 0x00000000, 0x00000000, 0x001b5113, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0019408e, 0x00000000, 0x00000000,
+	0x0019182f, 0x0017586a, 0x001a048a, 0x00195980, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b4b2c,
+	0x00000000, 0x00196308, 0x00000000, 0x001b6420, 0x00000000, 0x0015516e,
+	0x00000000, 0x00191248, 0x00175286, 0x00000000, 0x00000000, 0x00000000,
+	0x00154201, 0x00000000, 0x00000000, 0x00000000, 0x00194433, 0x00000000,
+	0x00000000, 0x00175c0d, 0x00000000, 0x00000000, 0x001a082e, 0x00000000,
+	0x00154b8a, 0x00170b4f, 0x001a2120, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a024a,
+	0x00000000, 0x00000000, 0x00181a24, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175046, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0015494a, 0x0017090f, 0x00190a24,
+	0x00174a61, 0x00000000, 0x00000000, 0x001b4c92, 0x00000000, 0x00000000,
+	0x0014d02b, 0x0019646c, 0x0016d140, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017032b,
+	0x00154366, 0x00000000, 0x00151b04, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0014ca45, 0x001a0992, 0x00000000, 0x00000000, 0x00000000,
+	0x001a2284, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00181200, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b4a53, 0x00000000, 0x00000000, 0x0019622c, 0x00000000, 0x001b6344,
+	0x00155092, 0x00000000, 0x0019116e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154125, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b446e, 0x00175b30, 0x00000000, 0x0014c804, 0x00195c49,
+	0x00000000, 0x00000000, 0x00000000, 0x001a2044, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0014c221, 0x001a016e, 0x00000000, 0x00181948, 0x00000000, 0x001a1a60,
+	0x00000000, 0x00000000, 0x00000000, 0x001b4813, 0x00000000, 0x00000000,
+	0x00000000, 0x001b6104, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00195082, 0x00000000, 0x00000000, 0x00181365, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b422e, 0x00000000,
+	0x00000000, 0x00195a08, 0x00000000, 0x001b5b20, 0x00000000, 0x0015486e,
+	0x00174986, 0x0019094a, 0x00000000, 0x00156160, 0x00000000, 0x00000000,
+	0x00000000, 0x00196390, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0017530c, 0x00000000, 0x00195425, 0x00000000, 0x00000000, 0x00000000,
+	0x0017024f, 0x0015428a, 0x00190366, 0x00151a28, 0x00000000, 0x00171b40,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154c11, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00181124, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00160a29, 0x00000000, 0x00180b41, 0x00196153, 0x00000000,
+	0x001b6268, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0017000f, 0x0015404a, 0x00174162,
+	0x00000000, 0x00000000, 0x00171900, 0x001b4392, 0x00000000, 0x00195b6c,
+	0x00000000, 0x0016c842, 0x001b5c85, 0x00000000, 0x003b4201, 0x00000000,
+	0x00000000, 0x00194c01, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00151204, 0x00000000, 0x00000000, 0x00000000, 0x00175473,
+	0x00000000, 0x0014c146, 0x001a0092, 0x00000000, 0x0018186e, 0x00000000,
+	0x001a1986, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b6028, 0x00000000, 0x00000000,
+	0x001a230c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00160205,
+	0x001b4153, 0x00000000, 0x0019592c, 0x00000000, 0x001b5a44, 0x00000000,
+	0x00000000, 0x00000000, 0x0019086e, 0x00000000, 0x00156086, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00175233, 0x00000000, 0x00195349, 0x00000000,
+	0x001b5461, 0x00000000, 0x00000000, 0x00000000, 0x0015194f, 0x00000000,
+	0x00171a64, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00174c4d, 0x00000000, 0x00000000,
+	0x00156428, 0x00000000, 0x0018104a, 0x00000000, 0x00000000, 0x00151369,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00180a66, 0x00000000,
+	0x00000000, 0x001b618e, 0x00000000, 0x00000000, 0x001a2470, 0x00000000,
+	0x00000000, 0x00195108, 0x001b5220, 0x00000000, 0x00000000, 0x00000000,
+	0x0019004a, 0x00174086, 0x00000000, 0x00171824, 0x00155860, 0x00000000,
+	0x00000000, 0x00195a92, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00174a0d, 0x00000000, 0x00194b25, 0x00000000, 0x00000000, 0x00176300,
+	0x00000000, 0x00000000, 0x00151128, 0x00000000, 0x00171240, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154313, 0x00174429, 0x00000000, 0x00000000, 0x00155c05, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150b45, 0x00000000,
+	0x00000000, 0x001a2230, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0016012b, 0x00000000, 0x00000000, 0x00195853, 0x00000000, 0x001b596a,
+	0x00000000, 0x00000000, 0x00000000, 0x001a1c4d, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x004a0101, 0x00000000, 0x00000000,
+	0x00000000, 0x00171000, 0x00000000, 0x00000000, 0x00000000, 0x0019526e,
+	0x00000000, 0x001b5384, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00194301, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00150904, 0x00000000, 0x00000000, 0x0026c800, 0x00174b73,
+	0x00194c8a, 0x0015634c, 0x00000000, 0x00176464, 0x00000000, 0x00000000,
+	0x001a1086, 0x00454800, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00150321, 0x00000000, 0x00000000, 0x00000000,
+	0x001a1a0c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0019502f, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a1429, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00191860, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00174933, 0x00000000, 0x00194a4a, 0x0015610c, 0x001b4b60,
+	0x00176224, 0x00000000, 0x00000000, 0x00000000, 0x0015104f, 0x00171166,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0017434e, 0x00000000, 0x00155b28,
+	0x00194466, 0x00175c41, 0x00000000, 0x00000000, 0x00000000, 0x00150a6a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00180166, 0x00000000, 0x00000000,
+	0x00000000, 0x001b588e, 0x00000000, 0x00000000, 0x001a1b73, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a0c05,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00195192, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0017410f, 0x00395000, 0x00000000, 0x00000000, 0x00175a00, 0x00000000,
+	0x00000000, 0x00000000, 0x0015082a, 0x001b5c31, 0x00170940, 0x00000000,
+	0x00000000, 0x00000000, 0x00156273, 0x00000000, 0x00176388, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155304, 0x00000000,
+	0x00000000, 0x00271200, 0x00000000, 0x0016c209, 0x00150246, 0x00000000,
+	0x00000000, 0x001a1933, 0x00000000, 0x00000000, 0x00155c8d, 0x00000000,
+	0x00148924, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b506a,
+	0x00000000, 0x00000000, 0x001a134c, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00280201,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019496e, 0x00156033,
+	0x001b4a86, 0x00176148, 0x00000000, 0x00196260, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00150007, 0x001b540d, 0x00000000, 0x00000000, 0x00174273, 0x00000000,
+	0x0019438a, 0x00155a4c, 0x00175b64, 0x00191b28, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155469, 0x00000000, 0x00148101, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a0b28, 0x00196020, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00174033, 0x00000000, 0x0015580c, 0x0019414a, 0x00175924,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00170866,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155228,
+	0x00000000, 0x00191305, 0x00175340, 0x00000000, 0x00000000, 0x0015016a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154c45, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00161040,
+	0x00000000, 0x00000000, 0x00000000, 0x001a1273, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00194892, 0x00000000, 0x0017606e, 0x00000000, 0x00196184, 0x001a0c8e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175100, 0x00000000,
+	0x00000000, 0x00000000, 0x001b5330, 0x00170042, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00155973, 0x00000000, 0x00191a4c, 0x00175a8a,
+	0x00000000, 0x00000000, 0x00000000, 0x00154a04, 0x00000000, 0x00000000,
+	0x00000000, 0x00270900, 0x00000000, 0x00000000, 0x00176410, 0x00000000,
+	0x001a1033, 0x00000000, 0x00000000, 0x0015538e, 0x00000000, 0x00148026,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154421,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a0a4e, 0x00000000, 0x00000000, 0x00000000,
+	0x001a2340, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00140121, 0x0019406e, 0x00000000,
+	0x001b4186, 0x0019180c, 0x0017584a, 0x001a046a, 0x00195960, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b4b0c, 0x00000000, 0x00000000, 0x00000000, 0x001b6400, 0x00000000,
+	0x0015514e, 0x00000000, 0x00191228, 0x00175264, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194411,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154b6a, 0x00170b2d, 0x001a2100, 0x00174c81, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0014d248, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00181a04, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00175024,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154928, 0x00000000,
+	0x00174a41, 0x00190a04, 0x00000000, 0x00000000, 0x001b4c73, 0x00000000,
+	0x00000000, 0x0014d008, 0x0019644c, 0x0016d120, 0x00000000, 0x00000000,
+	0x00000000, 0x00494900, 0x00000000, 0x00000000, 0x00275301, 0x00000000,
+	0x00170309, 0x00154345, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0014ca25, 0x001a0973, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a2264, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a038e, 0x00195886,
+	0x00000000, 0x00181b68, 0x00000000, 0x001a1c81, 0x00000000, 0x00000000,
+	0x00000000, 0x001b4a33, 0x00000000, 0x00000000, 0x0019620c, 0x00000000,
+	0x001b6324, 0x00155073, 0x00000000, 0x0019114f, 0x0017518a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00154105, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00175b10, 0x001b444e, 0x00195c29,
+	0x00000000, 0x00000000, 0x00000000, 0x00154a8e, 0x001a2024, 0x00190b6a,
+	0x00000000, 0x00156380, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0014c201, 0x001a014e, 0x00000000, 0x00181928, 0x00000000,
+	0x001a1a40, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00195062, 0x00000000, 0x00000000, 0x00181345,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5b00, 0x00000000,
+	0x0015484e, 0x00000000, 0x0019092a, 0x00174966, 0x00156140, 0x00000000,
+	0x00000000, 0x00000000, 0x00196370, 0x00000000, 0x0016d046, 0x001b6488,
+	0x00000000, 0x00000000, 0x00000000, 0x00195405, 0x00000000, 0x00000000,
+	0x00000000, 0x0017022f, 0x0015426a, 0x00190345, 0x00151a08, 0x00174382,
+	0x00171b20, 0x00000000, 0x00000000, 0x00000000, 0x0014c94a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a218a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00181104, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00160a09, 0x00000000, 0x00180b21, 0x00196130,
+	0x00000000, 0x001b6248, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015402a, 0x00000000,
+	0x00174142, 0x00000000, 0x00000000, 0x00000000, 0x001b4373, 0x00000000,
+	0x00195b4c, 0x00000000, 0x001b5c65, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00274a00, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00175451, 0x00000000, 0x0014c126, 0x001a0073, 0x00000000, 0x0018184f,
+	0x00000000, 0x001a1964, 0x00151b6c, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b6008, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0018126a, 0x001a1380, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b4133, 0x00000000, 0x0019590c, 0x00000000, 0x001b5a24,
+	0x00000000, 0x00000000, 0x00000000, 0x0019084f, 0x0017488a, 0x00156064,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00175210, 0x00000000, 0x00195329,
+	0x00000000, 0x001b5441, 0x0015418e, 0x00000000, 0x0019026a, 0x0015192c,
+	0x00000000, 0x00171a44, 0x00155a80, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174c2d, 0x00000000,
+	0x00000000, 0x00156408, 0x00000000, 0x0018102a, 0x00000000, 0x00000000,
+	0x00151349, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x002a1a00, 0x00000000, 0x00180a44,
+	0x00000000, 0x00000000, 0x001b616e, 0x00000000, 0x00000000, 0x001a2450,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b5200, 0x00000000,
+	0x00000000, 0x0019002a, 0x00174066, 0x00000000, 0x00171804, 0x00155840,
+	0x00000000, 0x00000000, 0x00195a73, 0x00000000, 0x001b5b88, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00194b05, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00151108, 0x00000000, 0x00171220,
+	0x00000000, 0x00000000, 0x00000000, 0x0014c04a, 0x0019548e, 0x00000000,
+	0x00000000, 0x00000000, 0x001a188a, 0x00174409, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150b25,
+	0x00000000, 0x00000000, 0x001a2210, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0016010b, 0x00000000, 0x00000000, 0x00195833, 0x00000000,
+	0x001b5948, 0x00000000, 0x00000000, 0x00000000, 0x001a1c2d, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019524f, 0x00000000, 0x001b5364, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0017196a, 0x00274101, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174b53,
+	0x00000000, 0x00194c6a, 0x0015632c, 0x00000000, 0x00176444, 0x00000000,
+	0x00000000, 0x001a1066, 0x0015126e, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00150301, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0018096a, 0x00000000, 0x001a0a82, 0x001b6092, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0019500f, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a1409, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00191840, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00174913, 0x00000000, 0x00194a28, 0x00000000,
+	0x001b4b40, 0x00176204, 0x00000000, 0x00000000, 0x00000000, 0x0015102f,
+	0x00155182, 0x00171144, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017432f, 0x00000000,
+	0x00155b08, 0x00194445, 0x00175c21, 0x00000000, 0x00000000, 0x00000000,
+	0x00150a4a, 0x00000000, 0x00170b61, 0x00000000, 0x00000000, 0x00000000,
+	0x00156490, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x002a1100, 0x00000000, 0x00180146, 0x00000000,
+	0x00000000, 0x00000000, 0x001b586e, 0x00000000, 0x00000000, 0x001a1b50,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00195173, 0x00000000, 0x001b528a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00255800, 0x00000000, 0x00150808, 0x001b5c11, 0x00170920,
+	0x00000000, 0x00000000, 0x00000000, 0x00156250, 0x00194b8e, 0x00176368,
+	0x00000000, 0x00196480, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150225, 0x00000000,
+	0x00000000, 0x00000000, 0x001a1910, 0x00174492, 0x00000000, 0x00155c6d,
+	0x00000000, 0x00148904, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b504a, 0x00000000, 0x00000000, 0x001a132c, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0019494f,
+	0x00156010, 0x001b4a66, 0x00176128, 0x00000000, 0x00196240, 0x00000000,
+	0x00000000, 0x00000000, 0x0017106a, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00174253,
+	0x00000000, 0x0019436a, 0x00155a2c, 0x001b4481, 0x00191b08, 0x00175b44,
+	0x00000000, 0x0015096e, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00155449, 0x00000000, 0x00000000,
+	0x0018006a, 0x00000000, 0x001a0182, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00196000, 0x001a0b08, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a1492, 0x00174013, 0x0019412a, 0x00000000,
+	0x00175904, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00170846, 0x00154882, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0017628e, 0x00000000, 0x00000000, 0x002b4b01, 0x00000000, 0x00000000,
+	0x00155208, 0x00000000, 0x00175320, 0x00000000, 0x00000000, 0x00000000,
+	0x0015014a, 0x00000000, 0x00170262, 0x00000000, 0x00000000, 0x00000000,
+	0x00155b92, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154c25, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00161020, 0x00000000, 0x00000000, 0x001a1253, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00140924, 0x00194873, 0x00000000, 0x0017604e, 0x001b498a, 0x00196164,
+	0x001a0c6e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b5310, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0019428e, 0x00155953, 0x00000000, 0x00191a2c,
+	0x00175a68, 0x00195b80, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a1013, 0x00000000, 0x00000000, 0x0015536e, 0x00000000,
+	0x00148007, 0x00175485, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00154401, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a0a2e, 0x00000000, 0x00000000,
+	0x00000000, 0x001a2320, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00140101, 0x0019404f,
+	0x00000000, 0x001b4166, 0x0017582b, 0x00000000, 0x001a0449, 0x00195940,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0015512e, 0x00000000, 0x00191208, 0x00175244, 0x00000000,
+	0x00000000, 0x0015006e, 0x00000000, 0x00000000, 0x00000000, 0x00151960,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00170b0d, 0x00154b48, 0x00174c61,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0014d228,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019608a, 0x001a0b92, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001a2484, 0x00175004, 0x003a0a01, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0017598e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154908,
+	0x00000000, 0x00174a21, 0x00000000, 0x00000000, 0x00000000, 0x001b4c53,
+	0x00000000, 0x00000000, 0x0019642c, 0x00000000, 0x0016d100, 0x00155292,
+	0x00000000, 0x00000000, 0x0019136d, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00154325, 0x00355100, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0014ca05, 0x001a0953, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001a2244, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00140026, 0x00000000, 0x001b408a, 0x00000000, 0x00000000, 0x001a036e,
+	0x00195866, 0x00000000, 0x00181b48, 0x00000000, 0x001a1c61, 0x00000000,
+	0x00000000, 0x00000000, 0x001b4a13, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001b6304, 0x00155053, 0x00000000, 0x0019112f, 0x0017516a,
+	0x00195280, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b442d, 0x00000000,
+	0x00195c09, 0x00000000, 0x00000000, 0x00000000, 0x00154a6e, 0x001a2004,
+	0x00190b49, 0x00174b86, 0x00156360, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a012e, 0x00000000, 0x00000000, 0x00181908,
+	0x0015448a, 0x001a1a20, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00181325, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0015482e, 0x00295900, 0x00174946, 0x00000000, 0x00156120,
+	0x00000000, 0x00000000, 0x00000000, 0x00196350, 0x00000000, 0x0016d024,
+	0x00151062, 0x001b6468, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0017020f, 0x0015424a, 0x00190325, 0x00174361,
+	0x00000000, 0x00171b00, 0x00000000, 0x00000000, 0x00000000, 0x0014c92b,
+	0x00000000, 0x0016ca41, 0x00000000, 0x00000000, 0x001a2168, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x001a0292, 0x00000000, 0x00181a6c, 0x00000000, 0x001a1b84,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00180b01,
+	0x00196110, 0x00000000, 0x001b6228, 0x00000000, 0x00000000, 0x0017508e,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015400b,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001b4353,
+	0x00000000, 0x00195b2c, 0x00000000, 0x001b5c45, 0x00000000, 0x00154992,
+	0x00000000, 0x00190a6e, 0x00000000, 0x00000000, 0x00156284, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00175431, 0x00000000, 0x0014c105, 0x001a0053, 0x00000000,
+	0x0018182f, 0x00000000, 0x001a1944, 0x00151b4c, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00181248, 0x00000000, 0x001a1360, 0x00000000,
+	0x00000000, 0x00000000, 0x001b4113, 0x00000000, 0x00000000, 0x00000000,
+	0x001b5a04, 0x00000000, 0x00000000, 0x00000000, 0x0019082f, 0x0017486a,
+	0x00156044, 0x00194982, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x001b638c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00195309, 0x00000000, 0x001b5421, 0x0015416e, 0x00000000, 0x0019024a,
+	0x0015190c, 0x00174286, 0x00171a24, 0x00155a60, 0x00000000, 0x00000000,
+	0x00195c91, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a208e,
+	0x00174c0d, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00151329, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00180a24, 0x00000000, 0x00000000, 0x001b614c, 0x00000000, 0x00000000,
+	0x001a2430, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00295000, 0x00000000, 0x00174046, 0x00000000, 0x00000000, 0x00155820,
+	0x00000000, 0x00000000, 0x00000000, 0x00195a53, 0x00000000, 0x001b5b68,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00390800, 0x00000000, 0x00000000,
+	0x00171200, 0x00000000, 0x00000000, 0x00000000, 0x0014c02b, 0x0019546d,
+	0x0016c142, 0x00000000, 0x00000000, 0x001a186a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00150b05, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0018116e, 0x00000000, 0x001a1286,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00195813, 0x001b5928, 0x00000000, 0x00000000, 0x00000000, 0x001a1c0d,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00176080, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0019522c, 0x00000000, 0x001b5344, 0x00154092, 0x00000000,
+	0x00000000, 0x0019016e, 0x00000000, 0x00171948, 0x00155986, 0x00191a60,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00174b33, 0x00000000, 0x00194c49, 0x0015630c, 0x00000000, 0x00176424,
+	0x00000000, 0x00000000, 0x00000000, 0x0015124f, 0x00000000, 0x00171365,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x0018094a, 0x00000000, 0x00000000, 0x001b6073, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194082,
+	0x00000000, 0x00000000, 0x00191820, 0x00180366, 0x00000000, 0x00000000,
+	0x001b5a8e, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194a08,
+	0x00000000, 0x001b4b20, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0015100f, 0x00155160, 0x00171124, 0x00000000, 0x00000000, 0x00195392,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017430d,
+	0x00395200, 0x00194425, 0x00000000, 0x00175c01, 0x00000000, 0x00000000,
+	0x00000000, 0x00150a28, 0x00000000, 0x00170b41, 0x00000000, 0x00000000,
+	0x00000000, 0x00156470, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x001b584e, 0x00000000, 0x00000000,
+	0x001a1b30, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00195153, 0x00000000, 0x001b526a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0017186e, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00170900, 0x00000000, 0x00000000, 0x00000000, 0x00156230, 0x00194b6e,
+	0x00176348, 0x001b4c85, 0x00196460, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00150205,
+	0x00000000, 0x00000000, 0x00000000, 0x0026c101, 0x00174473, 0x00000000,
+	0x00155c4d, 0x00000000, 0x0018086e, 0x00000000, 0x001a0986, 0x00000000,
+	0x00454101, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a130c, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019492f, 0x00000000, 0x00000000, 0x00176108, 0x00000000, 0x00196220,
+	0x00000000, 0x00000000, 0x00000000, 0x0017104a, 0x00155086, 0x00191160,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00174233, 0x00000000, 0x0019434a, 0x00155a0c, 0x001b4461, 0x00175b24,
+	0x00000000, 0x00000000, 0x0015094f, 0x00000000, 0x00170a66, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00155429, 0x00000000,
+	0x00000000, 0x0018004a, 0x00000000, 0x00000000, 0x0015036a, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00161240,
+	0x001b518e, 0x00000000, 0x00000000, 0x001a1473, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00170826, 0x00154860, 0x00000000, 0x00000000, 0x00194a92,
+	0x00000000, 0x0017626c, 0x00000000, 0x00196384, 0x00000000, 0x00000000,
+	0x00394900, 0x00000000, 0x00000000, 0x00175300, 0x00000000, 0x00000000,
+	0x00000000, 0x0015012a, 0x00000000, 0x00170241, 0x00000000, 0x00000000,
+	0x00000000, 0x00155b73, 0x00000000, 0x00175c89, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154c05, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00161000, 0x00000000, 0x00000000, 0x001a1233,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00140904, 0x00194853, 0x00000000, 0x0017602f, 0x001b496a,
+	0x00196144, 0x001a0c4d, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0019426e, 0x00155933, 0x001b4386,
+	0x00191a0c, 0x00175a48, 0x00195b60, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0015534c,
+	0x00000000, 0x00175465, 0x00000000, 0x00000000, 0x001a0086, 0x00000000,
+	0x00181860, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a2300, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0019402f, 0x00000000, 0x00000000, 0x00175808, 0x00000000, 0x001a0429,
+	0x00195920, 0x00000000, 0x00000000, 0x00000000, 0x00190862, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00176192, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0015510c, 0x00000000, 0x00175224, 0x00000000,
+	0x00000000, 0x00000000, 0x0015004f, 0x00000000, 0x00170166, 0x00000000,
+	0x00151940, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154b28, 0x00000000,
+	0x00174c41, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0014d208, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00160940, 0x001b488e,
+	0x00000000, 0x0019606a, 0x001a0b73, 0x001b6180, 0x00000000, 0x00000000,
+	0x00000000, 0x001a2464, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00194192, 0x00000000,
+	0x00000000, 0x0017596e, 0x00000000, 0x00195a84, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00174a01, 0x00000000, 0x00000000, 0x00000000,
+	0x001b4c31, 0x00000000, 0x00000000, 0x0019640c, 0x00000000, 0x00000000,
+	0x00155273, 0x00000000, 0x0017538a, 0x0019134d, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00154305, 0x00000000, 0x00000000, 0x00000000,
+	0x00270201, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x001a0933,
+	0x00000000, 0x00000000, 0x00154c8e, 0x00000000, 0x001a2224, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00140007, 0x00000000, 0x001b406a, 0x00000000, 0x00000000,
+	0x001a034e, 0x00195844, 0x00000000, 0x00181b28, 0x00000000, 0x001a1c41,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00155033, 0x00000000, 0x0019110c,
+	0x0017514a, 0x00195260, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00151866, 0x00000000, 0x00000000, 0x001b440d,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00154a4e,
+	0x00000000, 0x00190b29, 0x00174b65, 0x00156340, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x0016d244, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0015446a, 0x00000000, 0x001a1a00, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x001a2388, 0x00000000,
+};
@@ -0,0 +1,505 @@
+/**
+ * @file channel.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-25
+ *
+ * @brief Shared memory transport for OSUE exercise 1B `Battleship'.
+ * @details The producer of a ring publishes a message by advancing head and
+ * then seq, the consumer sleeps on seq. Both, the close flag and every push
+ * change seq, so a consumer can never miss a wake-up. The futex is only woken
+ * if the consumer announced that it sleeps. A peer that crashed never closes
+ * its ring, so sleeping consumers wake up every CHECK_INTERVAL ms to check
+ * that the peer's process still exists.
+ *
+ * Every reset of the channel starts a new epoch. Head, tail and every slot
+ * carry the epoch they were written in, and all of them are only changed by
+ * a compare-and-swap expecting the epoch of the writer. A client that was
+ * stopped and detached meanwhile therefore fails on its first write to the
+ * rings of the next client, no matter when it resumes.
+ */
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+#include "../include/channel.h"
+
+// number of slots of a ring, has to be a power of two
+#define RING_SIZE 64
+// number of polls of a receiver before it goes to sleep, spinning only pays
+// off if the peer runs on another processor
+#define SPIN_LIMIT 4096
+// time in milliseconds a receiver sleeps before it checks that its peer lives
+#define CHECK_INTERVAL 100
+
+#define CHANNEL_MAGIC 0x42534850
+
+// an index or slot of a ring: the epoch in the upper 32 bits, the number of
+// messages or the message in the lower ones
+#define TAG(epoch, low) ((uint64_t)(epoch) << 32 | (uint32_t)(low))
+#define EPOCH(tagged) ((uint32_t)((tagged) >> 32))
+#define LOW(tagged) ((uint32_t)(tagged))
+
+// keeps the fields of producer and consumer in different cache lines
+#define CACHE_LINE __attribute__((aligned(64)))
+
+/**
+ * @brief a single producer single consumer ring of messages
+ */
+typedef struct
+{
+	CACHE_LINE uint64_t head;  // number of messages pushed, tagged
+	uint32_t seq;			   // futex word, changed by every push and close
+	uint32_t closed;		   // the producer detached
+	CACHE_LINE uint64_t tail;  // number of messages popped, tagged
+	uint32_t sleeping;		   // the consumer is sleeping on seq
+	CACHE_LINE uint64_t slots[RING_SIZE];  // the messages, tagged
+} ring_t;
+
+/**
+ * @brief the contents of the shared memory object
+ */
+typedef struct
+{
+	uint32_t magic;		// CHANNEL_MAGIC once the server initialized it
+	uint32_t attached;  // a client is attached
+	uint32_t epoch;		// incremented by every reset
+	int32_t server_pid;  // the process of the server
+	int32_t client_pid;  // the process of the attached client, 0 if there is
+						 // none or it was detached by the server
+	ring_t requests;	// client to server
+	ring_t responses;   // server to client
+} shared_t;
+
+struct channel
+{
+	shared_t *shared;
+	char *name;  // the name of the object if this process created it
+	int spins;   // number of polls before sleeping
+	pid_t pid;   // the process of this end of the channel
+	uint32_t epoch;  // the epoch this end writes the rings in
+};
+
+static void init_ring(ring_t *ring, uint32_t epoch);
+static int push(const channel_t *channel, ring_t *ring, uint16_t value);
+static int pop(const channel_t *channel,
+			   ring_t *ring,
+			   int timeout,
+			   uint16_t *value);
+static int get_spin_limit(void);
+static bool is_attached(const channel_t *channel);
+static bool is_peer_alive(const channel_t *channel);
+static void close_ring(ring_t *ring);
+static bool wait_seq(ring_t *ring, uint32_t seq, int timeout);
+static void wake_seq(ring_t *ring);
+
+channel_t *create_channel(const char *name)
+{
+	channel_t *channel = (channel_t *)malloc(sizeof(channel_t));
+	if (channel == NULL) {
+		return NULL;
+	}
+
+	channel->spins = get_spin_limit();
+	channel->pid = getpid();
+	channel->name = strdup(name);
+	if (channel->name == NULL) {
+		free(channel);
+		return NULL;
+	}
+
+	// remove a stale object left behind by a crashed server
+	shm_unlink(name);
+	int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+	if (fd < 0 || ftruncate(fd, sizeof(shared_t)) < 0) {
+		int err = errno;
+		if (fd >= 0) {
+			close(fd);
+			shm_unlink(name);
+		}
+		free(channel->name);
+		free(channel);
+		errno = err;
+		return NULL;
+	}
+
+	channel->shared = mmap(
+		NULL, sizeof(shared_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (channel->shared == MAP_FAILED) {
+		int err = errno;
+		shm_unlink(name);
+		free(channel->name);
+		free(channel);
+		errno = err;
+		return NULL;
+	}
+
+	reset_channel(channel);
+	channel->shared->server_pid = channel->pid;
+	__atomic_store_n(&channel->shared->magic, CHANNEL_MAGIC, __ATOMIC_SEQ_CST);
+	return channel;
+}
+
+channel_t *open_channel(const char *name)
+{
+	channel_t *channel = (channel_t *)malloc(sizeof(channel_t));
+	if (channel == NULL) {
+		return NULL;
+	}
+	channel->name = NULL;
+	channel->spins = get_spin_limit();
+	channel->pid = getpid();
+
+	int fd = shm_open(name, O_RDWR, 0);
+	if (fd < 0) {
+		free(channel);
+		return NULL;
+	}
+
+	channel->shared = mmap(
+		NULL, sizeof(shared_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (channel->shared == MAP_FAILED) {
+		free(channel);
+		return NULL;
+	}
+
+	uint32_t free_state = 0;
+	shared_t *shared = channel->shared;
+	if (__atomic_load_n(&shared->magic, __ATOMIC_SEQ_CST) != CHANNEL_MAGIC
+		|| !__atomic_compare_exchange_n(&shared->attached,
+										&free_state,
+										1,
+										false,
+										__ATOMIC_SEQ_CST,
+										__ATOMIC_SEQ_CST)) {
+		munmap(channel->shared, sizeof(shared_t));
+		free(channel);
+		errno = EBUSY;
+		return NULL;
+	}
+	__atomic_store_n(&shared->client_pid, channel->pid, __ATOMIC_SEQ_CST);
+	// the server resets the channel only after this client detached
+	channel->epoch = __atomic_load_n(&shared->epoch, __ATOMIC_SEQ_CST);
+
+	return channel;
+}
+
+void close_channel(channel_t *channel)
+{
+	if (channel == NULL) {
+		return;
+	}
+
+	if (channel->name != NULL) {
+		close_ring(&channel->shared->responses);
+		shm_unlink(channel->name);
+		free(channel->name);
+	} else if (is_attached(channel)) {
+		// a client detached by the server must not close the ring of the next
+		close_ring(&channel->shared->requests);
+	}
+
+	munmap(channel->shared, sizeof(shared_t));
+	free(channel);
+}
+
+void reset_channel(channel_t *channel)
+{
+	// a client still attached, e.g. after a timeout, notices the reset by its
+	// pid and stops using the rings, its writes in progress fail by the epoch
+	shared_t *shared = channel->shared;
+	__atomic_store_n(&shared->client_pid, 0, __ATOMIC_SEQ_CST);
+	channel->epoch = __atomic_add_fetch(&shared->epoch, 1, __ATOMIC_SEQ_CST);
+	init_ring(&shared->requests, channel->epoch);
+	init_ring(&shared->responses, channel->epoch);
+	__atomic_store_n(&shared->attached, 0, __ATOMIC_SEQ_CST);
+}
+
+int send_request(channel_t *channel, client_msg_t msg)
+{
+	if (__atomic_load_n(&channel->shared->responses.closed, __ATOMIC_SEQ_CST)
+		|| !is_attached(channel)) {
+		errno = EPIPE;
+		return -1;
+	}
+	return push(channel, &channel->shared->requests, msg);
+}
+
+int recv_request(channel_t *channel, client_msg_t *msg, int timeout)
+{
+	uint16_t value;
+	if (pop(channel, &channel->shared->requests, timeout, &value) < 0) {
+		return -1;
+	}
+	*msg = value;
+	return 0;
+}
+
+int send_response(channel_t *channel, server_msg_t msg)
+{
+	if (__atomic_load_n(&channel->shared->requests.closed, __ATOMIC_SEQ_CST)) {
+		errno = EPIPE;
+		return -1;
+	}
+	return push(channel, &channel->shared->responses, msg);
+}
+
+int recv_response(channel_t *channel, server_msg_t *msg)
+{
+	uint16_t value;
+	if (pop(channel, &channel->shared->responses, -1, &value) < 0) {
+		return -1;
+	}
+	*msg = value;
+	return 0;
+}
+
+/**
+ * @brief empty a ring and move it and all of its slots to a new epoch
+ * @param ring the ring to initialize
+ * @param epoch the new epoch
+ */
+static void init_ring(ring_t *ring, uint32_t epoch)
+{
+	for (int i = 0; i < RING_SIZE; i++) {
+		__atomic_store_n(&ring->slots[i], TAG(epoch, 0), __ATOMIC_SEQ_CST);
+	}
+	__atomic_store_n(&ring->head, TAG(epoch, 0), __ATOMIC_SEQ_CST);
+	__atomic_store_n(&ring->tail, TAG(epoch, 0), __ATOMIC_SEQ_CST);
+	ring->closed = 0;
+	ring->sleeping = 0;
+	__atomic_store_n(&ring->seq, 0, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief append a message to a ring
+ * @details the protocol allows a single outstanding shot, so the ring is never
+ * full in practice and a full ring is simply waited out by yielding.
+ * @param channel the channel of the ring
+ * @param ring the ring to push to
+ * @param value the message
+ * @return 0 on success, -1 with errno set to EPIPE if the consumer died while
+ * the ring was full or the ring was reset in another epoch
+ */
+static int push(const channel_t *channel, ring_t *ring, uint16_t value)
+{
+	uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_SEQ_CST);
+	while (LOW(head) - LOW(__atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE))
+		   == RING_SIZE) {
+		if (!is_peer_alive(channel)) {
+			errno = EPIPE;
+			return -1;
+		}
+		sched_yield();
+	}
+
+	// a client stopped while the server detached it must neither overwrite
+	// a slot nor publish in the ring of the next client
+	uint64_t *slot = &ring->slots[LOW(head) % RING_SIZE];
+	uint64_t old = __atomic_load_n(slot, __ATOMIC_SEQ_CST);
+	if (EPOCH(head) != channel->epoch || EPOCH(old) != channel->epoch
+		|| !__atomic_compare_exchange_n(slot,
+										&old,
+										TAG(channel->epoch, value),
+										false,
+										__ATOMIC_SEQ_CST,
+										__ATOMIC_SEQ_CST)
+		|| !__atomic_compare_exchange_n(&ring->head,
+										&head,
+										TAG(channel->epoch, LOW(head) + 1),
+										false,
+										__ATOMIC_SEQ_CST,
+										__ATOMIC_SEQ_CST)) {
+		errno = EPIPE;
+		return -1;
+	}
+	__atomic_add_fetch(&ring->seq, 1, __ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&ring->sleeping, __ATOMIC_SEQ_CST)) {
+		wake_seq(ring);
+	}
+	return 0;
+}
+
+/**
+ * @brief remove the oldest message from a ring, waiting for one if empty
+ * @details the peer is only checked after sleeping for CHECK_INTERVAL ms
+ * without a wake-up, so receiving a message costs no additional system call.
+ * @param channel the channel of the ring
+ * @param ring the ring to pop from
+ * @param timeout the maximum time to wait in milliseconds, -1 for no limit
+ * @param value the message is stored into this parameter
+ * @return 0 on success, -1 if the ring is empty and the producer detached or
+ * died, or the ring was reset in another epoch, with errno set to EPIPE, or
+ * the timeout expired, with ETIMEDOUT
+ */
+static int pop(const channel_t *channel,
+			   ring_t *ring,
+			   int timeout,
+			   uint16_t *value)
+{
+	uint64_t tail = __atomic_load_n(&ring->tail, __ATOMIC_SEQ_CST);
+	int spins = channel->spins;
+	uint64_t deadline = 0;
+
+	while (true) {
+		uint32_t seq = __atomic_load_n(&ring->seq, __ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&ring->head, __ATOMIC_SEQ_CST) != tail) {
+			break;
+		}
+		if (__atomic_load_n(&ring->closed, __ATOMIC_SEQ_CST)) {
+			errno = EPIPE;
+			return -1;
+		}
+
+		if (spins > 0) {
+			spins--;
+			continue;
+		}
+
+		int wait = CHECK_INTERVAL;
+		if (timeout >= 0) {
+			uint64_t now = get_time_ns() / 1000000;
+			if (deadline == 0) {
+				deadline = now + timeout;
+			}
+			if (now >= deadline) {
+				errno = ETIMEDOUT;
+				return -1;
+			}
+			if (deadline - now < (uint64_t)wait) {
+				wait = deadline - now;
+			}
+		}
+
+		bool expired = false;
+		__atomic_store_n(&ring->sleeping, 1, __ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&ring->head, __ATOMIC_SEQ_CST) == tail
+			&& !__atomic_load_n(&ring->closed, __ATOMIC_SEQ_CST)) {
+			expired = wait_seq(ring, seq, wait);
+		}
+		__atomic_store_n(&ring->sleeping, 0, __ATOMIC_SEQ_CST);
+		if (expired && !is_peer_alive(channel)) {
+			errno = EPIPE;
+			return -1;
+		}
+	}
+
+	uint64_t entry =
+		__atomic_load_n(&ring->slots[LOW(tail) % RING_SIZE], __ATOMIC_ACQUIRE);
+	// like in push(), a detached client must not touch the reset ring
+	if (EPOCH(tail) != channel->epoch
+		|| !__atomic_compare_exchange_n(&ring->tail,
+										&tail,
+										TAG(channel->epoch, LOW(tail) + 1),
+										false,
+										__ATOMIC_RELEASE,
+										__ATOMIC_RELAXED)) {
+		errno = EPIPE;
+		return -1;
+	}
+	*value = (uint16_t)LOW(entry);
+	return 0;
+}
+
+/**
+ * @brief get the number of polls before a receiver sleeps
+ * @return SPIN_LIMIT on multiprocessors, 0 otherwise
+ */
+static int get_spin_limit(void)
+{
+	return sysconf(_SC_NPROCESSORS_ONLN) > 1 ? SPIN_LIMIT : 0;
+}
+
+/**
+ * @brief check that a client still owns the channel
+ * @param channel the channel
+ * @return false if the channel belongs to a client that was detached by the
+ * server, true otherwise
+ */
+static bool is_attached(const channel_t *channel)
+{
+	return channel->name != NULL
+		   || __atomic_load_n(&channel->shared->client_pid, __ATOMIC_SEQ_CST)
+				  == channel->pid;
+}
+
+/**
+ * @brief check that the process at the other end of a channel still exists
+ * @details a process that exists but belongs to another user still counts as
+ * alive.
+ * @param channel the channel
+ * @return true if the peer lives or no client is attached yet, false if it
+ * died or, for a client, the server detached it
+ */
+static bool is_peer_alive(const channel_t *channel)
+{
+	if (!is_attached(channel)) {
+		return false;
+	}
+	pid_t peer =
+		channel->name != NULL
+			? __atomic_load_n(&channel->shared->client_pid, __ATOMIC_SEQ_CST)
+			: channel->shared->server_pid;
+	return peer == 0 || kill(peer, 0) == 0 || errno != ESRCH;
+}
+
+/**
+ * @brief mark the producer of a ring as detached and wake its consumer
+ * @param ring the ring to close
+ */
+static void close_ring(ring_t *ring)
+{
+	__atomic_store_n(&ring->closed, 1, __ATOMIC_SEQ_CST);
+	__atomic_add_fetch(&ring->seq, 1, __ATOMIC_SEQ_CST);
+	wake_seq(ring);
+}
+
+/**
+ * @brief sleep until seq of the ring changes from the given value
+ * @details returns early on spurious wake-ups and signals, callers recheck the
+ * ring anyway.
+ * @param ring the ring to wait on
+ * @param seq the last observed value of seq
+ * @param timeout the maximum time to sleep in milliseconds
+ * @return true if the timeout expired without a wake-up, false otherwise
+ */
+static bool wait_seq(ring_t *ring, uint32_t seq, int timeout)
+{
+#ifdef __linux__
+	struct timespec ts = {.tv_sec = timeout / 1000,
+						  .tv_nsec = (timeout % 1000) * 1000000L};
+	return syscall(SYS_futex, &ring->seq, FUTEX_WAIT, seq, &ts, NULL, 0) < 0
+		   && errno == ETIMEDOUT;
+#else
+	// without futexes every nap counts as expired, which checks the peer
+	(void)timeout;
+	struct timespec ts = {.tv_sec = 0, .tv_nsec = 50000};
+	nanosleep(&ts, NULL);
+	return true;
+#endif
+}
+
+/**
+ * @brief wake the consumer sleeping on seq of the ring
+ * @param ring the ring to wake
+ */
+static void wake_seq(ring_t *ring)
+{
+#ifdef __linux__
+	syscall(SYS_futex, &ring->seq, FUTEX_WAKE, 1, NULL, NULL, 0);
+#endif
+}
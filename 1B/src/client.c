@@ -26,26 +26,51 @@
 // Sockets, TCP, ... :
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/un.h>
 #include <netdb.h>
 #include <fcntl.h>
 
 // stuff shared by client and server:
 #include "../include/common.h"
 #include "../include/msg.h"
+#include "../include/codec.h"
+#include "../include/sockbuf.h"
 #include "../include/solver.h"
+#include "../include/loadgen.h"
+#include "../include/channel.h"
+#include "../include/rules.h"
+#include "../include/heatmap.h"
 
 // Static variables for things you might want to access from several functions:
 static const char *port = DEFAULT_PORT;  // the port to connect to
-static const char *host = DEFAULT_HOST;  // the port to connect to
+static const char *host = DEFAULT_HOST;  // the host to connect to
+static const char *shm_name = NULL;		 // the shared memory channel to use
+static const char *unix_path = NULL;	 // the Unix domain socket to connect to
+static unsigned long connection_cnt = 0;  // concurrent connections in load
+										  // mode, 0 plays a single game
+static unsigned long game_cnt = 0;		  // games to play in load mode
+static char *const *servers = NULL;		  // servers to spread the load over
+static unsigned long server_cnt = 0;
+static rules_t rules;					  // the rules to play by
+static bool propose = false;			  // propose the rules at connect
+static const char *prior_path = NULL;	  // the heatmap of the opponent
+static unsigned long budget = 0;		  // time per move in microseconds
+static unsigned long sampler_cnt = 1;	  // threads sampling fleets per move
 
 // Static variables for resources that should be freed before exiting:
 static struct addrinfo *ai = NULL;  // stores address information
 static int sock_fd = -1;			// socket file descriptor
+static sockbuf_t io;				// buffers of the socket
+static channel_t *channel = NULL;   // shared memory channel
+static solver_t *solver = NULL;		// the solver playing the game
+static heatmap_t *prior = NULL;		// the heatmap of the opponent
 static char *program_name;
 
 static int parse_args(int argc, char *argv[]);
 static void print_usage(void);
 
+static int connect_socket(void);
+static int negotiate_rules(void);
 static int send_msg(client_msg_t msg);
 static int recv_msg(server_msg_t *msg);
 
@@ -71,32 +96,54 @@ int main(int argc, char *argv[])
 		return EXIT_FAILURE;
 	}
 
-	init_solver();
+	if (prior_path != NULL) {
+		prior = open_heatmap(prior_path);
+		if (prior == NULL) {
+			print_err("Could not open heatmap:");
+			return EXIT_FAILURE;
+		}
+		if (prior->header->map_size != rules.map_size) {
+			fprintf(stderr, "%s: Heatmap of another map size\n", program_name);
+			return EXIT_FAILURE;
+		}
+	}
 
-	struct addrinfo hints;
-	memset(&hints, 0, sizeof(hints));
-	hints.ai_family = AF_INET;
-	hints.ai_socktype = SOCK_STREAM;
+	if (connection_cnt > 0) {
+		load_config_t config = {.host = host,
+								.port = port,
+								.unix_path = unix_path,
+								.shm_name = shm_name,
+								.servers = servers,
+								.server_cnt = server_cnt,
+								.connections = connection_cnt,
+								.games = game_cnt,
+								.rules = propose ? &rules : NULL,
+								.seed = time(NULL) ^ getpid(),
+								.prior = prior,
+								.budget = budget,
+								.samplers = sampler_cnt};
+		return run_load(&config, program_name);
+	}
 
-	debug_print("%s\n", "Get address info");
-	int res = getaddrinfo(NULL, port, &hints, &ai);
-	if (res != 0) {  // no errno
-		fprintf(
-			stderr, "%s: Could not set parameters for socket:", program_name);
-		fprintf(stderr, "\t%s\n", gai_strerror(res));
+	solver = get_solver(&rules, time(NULL) ^ getpid());
+	if (solver == NULL || set_prior(solver, prior) < 0
+		|| set_budget(solver, budget, sampler_cnt) < 0) {
+		print_err("Could not create solver:");
 		return EXIT_FAILURE;
 	}
 
-	debug_print("%s\n", "Creating socket");
-	sock_fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
-	if (sock_fd < 0) {
-		print_err("Could not create socket:");
+	if (shm_name != NULL) {
+		debug_print("Opening shared memory channel %s\n", shm_name);
+		channel = open_channel(shm_name);
+		if (channel == NULL) {
+			print_err("Could not open shared memory channel:");
+			return EXIT_FAILURE;
+		}
+	} else if (connect_socket() < 0) {
 		return EXIT_FAILURE;
 	}
 
-	debug_print("%s\n", "Connecting");
-	if (connect(sock_fd, ai->ai_addr, ai->ai_addrlen) < 0) {
-		print_err("Could connect on socket:");
+	if (propose && negotiate_rules() < 0) {
 		return EXIT_FAILURE;
 	}
 
@@ -104,19 +151,17 @@ int main(int argc, char *argv[])
 	while (true) {
 
 
-		coordinate_t c = next_move(last_shot, last_report);
+		coordinate_t c = next_move(solver, last_shot, last_report);
 		last_shot = c;
 
 		debug_print("row=%d col=%d\n", c.row, c.col);
 
-		client_msg_t request = (c.col << X_COORDINATE_OFFSET) | c.row;
+		client_msg_t request = get_shot_msg(c);
 
 		debug_print("Request: %04x\n", request);
 
-		uint8_t p = calc_parity_bit(request);
-
 		debug_print("%s\n", "Sending message");
-		if (send_msg(set_parity_bit(request, p)) < 0) {
+		if (send_msg(request) < 0) {
 			print_err("Could not send message over socket:");
 			return EXIT_FAILURE;
 		}
@@ -161,6 +206,103 @@ int main(int argc, char *argv[])
 	return EXIT_SUCCESS;
 }
 
+/**
+ * @brief resolve the server's address and connect to it, either over TCP or
+ * a Unix domain socket
+ * @return 0 on success, -1 on failure
+ */
+static int connect_socket(void)
+{
+	if (unix_path != NULL) {
+		struct sockaddr_un addr;
+		memset(&addr, 0, sizeof(addr));
+		addr.sun_family = AF_UNIX;
+		if (strlen(unix_path) >= sizeof(addr.sun_path)) {
+			fprintf(stderr, "%s: Socket path too long\n", program_name);
+			return -1;
+		}
+		strcpy(addr.sun_path, unix_path);
+
+		debug_print("%s\n", "Creating socket");
+		sock_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (sock_fd < 0) {
+			print_err("Could not create socket:");
+			return -1;
+		}
+
+		debug_print("%s\n", "Connecting");
+		if (connect(sock_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+			print_err("Could connect on socket:");
+			return -1;
+		}
+		init_sockbuf(&io, sock_fd);
+		return 0;
+	}
+
+	struct addrinfo hints;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = SOCK_STREAM;
+
+	debug_print("%s\n", "Get address info");
+	int res = getaddrinfo(host, port, &hints, &ai);
+	if (res != 0) {  // no errno
+		fprintf(
+			stderr, "%s: Could not set parameters for socket:", program_name);
+		fprintf(stderr, "\t%s\n", gai_strerror(res));
+		return -1;
+	}
+
+	debug_print("%s\n", "Creating socket");
+	sock_fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+	if (sock_fd < 0) {
+		print_err("Could not create socket:");
+		return -1;
+	}
+
+	debug_print("%s\n", "Connecting");
+	if (connect(sock_fd, ai->ai_addr, ai->ai_addrlen) < 0) {
+		print_err("Could connect on socket:");
+		return -1;
+	}
+
+	// requests are flushed when waiting for the response, Nagle's algorithm
+	// only delays them
+	if (set_nodelay(sock_fd, true) < 0) {
+		print_err("Could not set socket options:");
+		return -1;
+	}
+	init_sockbuf(&io, sock_fd);
+	return 0;
+}
+
+/**
+ * @brief propose the rules to the server and wait for its answer
+ * @return 0 if the server plays by the rules, -1 otherwise
+ */
+static int negotiate_rules(void)
+{
+	client_msg_t msgs[MAX_RULES_MSGS];
+	int n = encode_rules(&rules, msgs);
+	for (int i = 0; i < n; i++) {
+		if (send_msg(msgs[i]) < 0) {
+			print_err("Could not send message over socket:");
+			return -1;
+		}
+	}
+
+	server_msg_t response;
+	if (recv_msg(&response) < 0) {
+		print_err("Could not receive message over socket:");
+		return -1;
+	}
+	if (get_status(response) != game_ongoing) {
+		fprintf(stderr, "%s: Rules rejected by server\n", program_name);
+		return -1;
+	}
+	return 0;
+}
+
 /**
  * @brief Parses the program command line options
  * @details Returns 0 if all parameters were parsed correctly, -1 otherwise
@@ -174,7 +316,9 @@ static int parse_args(int argc, char *argv[])
 	program_name = argv[0];
 
 	int arg_c;
-	while ((arg_c = getopt(argc, argv, "h:p:")) != EOF) {
+	char *end;
+	const char *rules_str = CLASSIC_RULES;
+	while ((arg_c = getopt(argc, argv, "h:p:u:m:c:g:R:H:b:j:")) != EOF) {
 		switch (arg_c) {
 			case 'p':
 				port = optarg;
@@ -182,12 +326,69 @@ static int parse_args(int argc, char *argv[])
 			case 'h':
 				host = optarg;
 				break;
+			case 'u':
+				unix_path = optarg;
+				break;
+			case 'm':
+				shm_name = optarg;
+				break;
+			case 'c':
+				errno = 0;
+				connection_cnt = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0' || connection_cnt == 0) {
+					return -1;
+				}
+				break;
+			case 'g':
+				errno = 0;
+				game_cnt = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0' || game_cnt == 0) {
+					return -1;
+				}
+				break;
+			case 'R':
+				rules_str = optarg;
+				propose = true;
+				break;
+			case 'H':
+				prior_path = optarg;
+				break;
+			case 'b':
+				errno = 0;
+				budget = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0' || budget > UINT32_MAX) {
+					return -1;
+				}
+				break;
+			case 'j':
+				errno = 0;
+				sampler_cnt = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0' || sampler_cnt == 0
+					|| sampler_cnt > MAX_SAMPLERS) {
+					return -1;
+				}
+				break;
 			default:
 				return -1;
 		}
 	}
 
-	if (argc - optind >= 1) {
+	servers = argv + optind;
+	server_cnt = argc - optind;
+
+	if (parse_rules(rules_str, &rules) < 0) {
+		fprintf(stderr, "%s: Invalid rules %s\n", program_name, rules_str);
+		return -1;
+	}
+
+	if (game_cnt > 0 && connection_cnt == 0) {
+		connection_cnt = 1;
+	}
+	if (connection_cnt > 0 && game_cnt == 0) {
+		game_cnt = connection_cnt;
+	}
+	// a single game or a shared memory channel has a single server
+	if (server_cnt > 0 && (connection_cnt == 0 || shm_name != NULL)) {
 		return -1;
 	}
 
@@ -202,46 +403,97 @@ static void print_usage(void)
 
 	printf("\nUsage:\n");
 	printf("\tclient [-h HOST] [-p PORT]\n");
+	printf("\tclient [-h HOST] [-p PORT] -c CONNECTIONS [-g GAMES]\n");
+	printf("\tclient [-p PORT] -c CONNECTIONS [-g GAMES] SERVER...\n");
+	printf("\tclient -u PATH [-c CONNECTIONS [-g GAMES]]\n");
+	printf("\tclient -m NAME [-c 1 [-g GAMES]]\n");
+	printf(
+		"\n\tall forms also accept [-R RULES] [-H HEATMAP] "
+		"[-b MICROSECONDS [-j THREADS]]\n");
 	printf("\n\t-p\tthe port to connect on. Defaults to %s\n", DEFAULT_PORT);
-	printf("\n\t-p\tthe addres to connect to. Defaults to %s\n", DEFAULT_HOST);
+	printf("\n\t-h\tthe addres to connect to. Defaults to %s\n", DEFAULT_HOST);
+	printf(
+		"\n\t-u\tconnect to the Unix domain socket at PATH instead of "
+		"TCP\n");
+	printf(
+		"\n\t-m\tconnect over the shared memory object NAME of a server on "
+		"the same host instead of TCP\n");
+	printf(
+		"\n\t-c\tgenerate load over this many concurrent connections and "
+		"print latency percentiles instead of playing a single game\n");
+	printf(
+		"\n\t-g\tthe total number of games to play in load mode. Defaults to "
+		"the number of connections\n");
+	printf(
+		"\n\tserver\tspread the connections of load mode round robin over "
+		"these servers, each either HOST, HOST:PORT or the path of a Unix "
+		"domain socket. PORT defaults to the one of -p\n");
+	printf(
+		"\n\t-R\tpropose these rules to the server at connect, the map size "
+		"followed by the number of ships of each length. Defaults to playing "
+		"by %s without proposing\n",
+		CLASSIC_RULES);
+	printf(
+		"\n\t-H\tfire at the squares most often covered by ships in the "
+		"games counted in HEATMAP first, see heatmaps\n");
+	printf(
+		"\n\t-b\tspend this many microseconds on every move counting or "
+		"sampling the fleets consistent with the shots so far, and fire at "
+		"the square most of them cover. Defaults to 0, firing by a "
+		"checkerboard scan and sinking hit ships\n");
+	printf(
+		"\n\t-j\tsample the fleets of every move on this many threads "
+		"within the same budget, at most %d. With -c the connections take "
+		"turns on the same threads. Defaults to 1\n",
+		MAX_SAMPLERS);
+	printf("\nexample:\n");
 	printf("\tclient -h localhost -p 1280\n");
+	printf("\tclient -c 64 -g 100000\n");
+	printf("\tclient -c 4096 -g 100000 localhost:1280 localhost:1281\n");
+	printf("\tclient -R 16:4x2,3x3,2x4,1x5\n");
+	printf("\tclient -c 8 -g 1000 -b 500\n");
+	printf("\tclient -b 2000 -j 4\n");
 }
 
 /**
- * @brief receive a message on the socket
- * @details reads a message in little endian byte order from the socket.
+ * @brief receive a message on the socket or the shared memory channel
+ * @details flushes the buffered requests and reads a message from the
+ * socket.
  * @param msg the message is stored into this parameter
  * @return 0 if the read succeeded, -1 otherwise
  */
 static int recv_msg(server_msg_t *msg)
 {
-	*msg = 0;
-	uint8_t buf[sizeof(server_msg_t)];
-	if (recv(sock_fd, buf, sizeof(server_msg_t), MSG_WAITALL) < 0) {
-		return -1;
+	if (channel != NULL) {
+		return recv_response(channel, msg);
 	}
 
-	for (int i = 0; i < sizeof(server_msg_t); i++) {
-		*msg |= (server_msg_t)buf[i] << 8 * i;
+	uint8_t buf[RESPONSE_LEN];
+	if (read_sockbuf(&io, buf, RESPONSE_LEN) < 0) {
+		return -1;
 	}
+
+	decode_responses(buf, 1, msg);
 	debug_print("Received message %04x\n", *msg);
 	return 0;
 }
 
 /**
- * @brief send a message on the socket
- * @details sends a message in little endian byte order over the socket.
+ * @brief send a message on the socket or the shared memory channel
+ * @details buffers a message for the socket, it is sent once the response
+ * is awaited.
  * @param msg the message to be send
  * @return 0 if sending succeeded, -1 otherwise
  */
 static int send_msg(client_msg_t msg)
 {
 	debug_print("Sending message %04x\n", msg);
-	uint8_t buf[sizeof(client_msg_t)];
-	for (int i = 0; i < sizeof(client_msg_t); i++) {
-		buf[i] = msg >> 8 * i;
+	if (channel != NULL) {
+		return send_request(channel, msg);
 	}
-	return send(sock_fd, buf, sizeof(client_msg_t), 0);
+
+	uint8_t buf[REQUEST_LEN];
+	return write_sockbuf(&io, buf, encode_requests(&msg, 1, buf));
 }
 
 /**
@@ -268,5 +520,8 @@ static void exit_cleanup()
 		close(sock_fd);
 	}
 
-	free_solver();
+	close_channel(channel);
+
+	free_solver(solver);
+	close_heatmap(prior);
 }
\ No newline at end of file
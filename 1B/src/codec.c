@@ -0,0 +1,90 @@
+/**
+ * @file codec.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Batch message codec of OSUE exercise 1B `Battleship'.
+ */
+#include <string.h>
+
+#include "../include/codec.h"
+
+// messages checked at once, packed into a 64 bit word
+#define WORD_MSGS (sizeof(uint64_t) / REQUEST_LEN)
+// the lowest bit of every message in such a word
+#define LANE_LOW_BITS 0x0001000100010001ULL
+
+static uint64_t get_lane_parity(uint64_t word);
+
+size_t encode_requests(const client_msg_t *msgs, size_t n, uint8_t *buf)
+{
+	for (size_t m = 0; m < n; m++) {
+		for (int i = 0; i < REQUEST_LEN; i++) {
+			buf[m * REQUEST_LEN + i] = msgs[m] >> 8 * i;
+		}
+	}
+	return n * REQUEST_LEN;
+}
+
+void decode_requests(const uint8_t *buf, size_t n, client_msg_t *msgs)
+{
+	for (size_t m = 0; m < n; m++) {
+		client_msg_t msg = 0;
+		for (int i = 0; i < REQUEST_LEN; i++) {
+			msg |= (client_msg_t)buf[m * REQUEST_LEN + i] << 8 * i;
+		}
+		msgs[m] = msg;
+	}
+}
+
+size_t check_requests(const uint8_t *buf, size_t n)
+{
+	size_t m = 0;
+	for (; m + WORD_MSGS <= n; m += WORD_MSGS) {
+		uint64_t word;
+		memcpy(&word, buf + m * REQUEST_LEN, sizeof(word));
+		if (get_lane_parity(word) != 0) {
+			// the offending message is found below
+			break;
+		}
+	}
+
+	for (; m < n; m++) {
+		client_msg_t msg;
+		decode_requests(buf + m * REQUEST_LEN, 1, &msg);
+		if (!check_parity(msg)) {
+			return m;
+		}
+	}
+	return n;
+}
+
+size_t encode_responses(const server_msg_t *msgs, size_t n, uint8_t *buf)
+{
+	memcpy(buf, msgs, n * RESPONSE_LEN);
+	return n * RESPONSE_LEN;
+}
+
+void decode_responses(const uint8_t *buf, size_t n, server_msg_t *msgs)
+{
+	memcpy(msgs, buf, n * RESPONSE_LEN);
+}
+
+/**
+ * @brief compute the parity of every message of a word at once
+ * @details each step folds the upper half of the remaining bits of a message
+ * onto its lower half. Bits of a neighbouring message only ever end up above
+ * the lowest bit, which is masked. The result is independent of the byte
+ * order of the word, as every message keeps its two bytes.
+ * @param word four encoded messages
+ * @return a word with the lowest bit of each message set if the bits of the
+ * message, including its parity bit, are odd
+ */
+static uint64_t get_lane_parity(uint64_t word)
+{
+	word ^= word >> 8;
+	word ^= word >> 4;
+	word ^= word >> 2;
+	word ^= word >> 1;
+	return word & LANE_LOW_BITS;
+}
@@ -1,9 +1,17 @@
+#include <time.h>
+
 #include "../include/common.h"
 
-bool check_coordinate(coordinate_t c)
+bool check_coordinate(coordinate_t c, uint8_t map_size)
 {
-	return c.row >= 0 && c.col >= 0 && c.row < MAP_SIZE && c.col < MAP_SIZE;
+	return c.row < map_size && c.col < map_size;
 }
 
-const coordinate_t invalid_coordinate = {.row = MAP_SIZE + 1,
-										 .col = MAP_SIZE + 1};
\ No newline at end of file
+const coordinate_t invalid_coordinate = {.row = UINT8_MAX, .col = UINT8_MAX};
+
+uint64_t get_time_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
@@ -0,0 +1,268 @@
+/**
+ * @file corpus.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief A fixed set of fleets for the server of OSUE exercise 1B
+ * `Battleship'.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../include/corpus.h"
+#include "../include/gamelog.h"
+
+// initial number of fleets of the storage of a corpus
+#define INITIAL_CAPACITY 1024
+
+static int load_log(corpus_t *corpus,
+					gamelog_t *log,
+					const rules_t *rules,
+					unsigned long *bad);
+static int load_text(corpus_t *corpus,
+					 const char *path,
+					 const rules_t *rules,
+					 unsigned long *bad);
+static int parse_lines(corpus_t *corpus,
+					   const char *data,
+					   size_t size,
+					   const rules_t *rules,
+					   unsigned long *bad);
+static int add_fleet(corpus_t *corpus, const fleet_t *fleet);
+
+int load_corpus(corpus_t *corpus,
+				const char *path,
+				const rules_t *rules,
+				unsigned long *bad)
+{
+	memset(corpus, 0, sizeof(*corpus));
+	corpus->ship_cnt = rules->ship_cnt;
+	*bad = 0;
+
+	gamelog_t *log = open_gamelog(path);
+	int res;
+	if (log != NULL) {
+		res = load_log(corpus, log, rules, bad);
+		close_gamelog(log);
+	} else if (errno == EINVAL) {
+		// no game log, so one fleet per line
+		res = load_text(corpus, path, rules, bad);
+	} else {
+		res = -1;
+	}
+
+	if (res == 0 && corpus->fleet_cnt == 0) {
+		errno = EINVAL;
+		res = -1;
+	}
+	if (res < 0) {
+		int err = errno;
+		free_corpus(corpus);
+		errno = err;
+	}
+	return res;
+}
+
+void free_corpus(corpus_t *corpus)
+{
+	free(corpus->ships);
+	corpus->ships = NULL;
+	corpus->fleet_cnt = 0;
+	corpus->capacity = 0;
+}
+
+void get_corpus_fleet(const corpus_t *corpus, size_t i, fleet_t *fleet)
+{
+	memcpy(fleet->ships,
+		   &corpus->ships[i * corpus->ship_cnt],
+		   corpus->ship_cnt * sizeof(ship_t));
+}
+
+/**
+ * @brief add the fleets of all games of a log
+ * @param corpus the corpus to add to
+ * @param log the mapped log
+ * @param rules the rules every fleet has to follow
+ * @param bad the number of the first illegal game is stored into this
+ * parameter
+ * @return 0 on success, -1 on failure with errno set
+ */
+static int load_log(corpus_t *corpus,
+					gamelog_t *log,
+					const rules_t *rules,
+					unsigned long *bad)
+{
+	unsigned long n = 0;
+	game_t game;
+	int res;
+	while ((res = next_game(log, &game)) > 0) {
+		n++;
+		if (!check_fleet(&game.fleet, rules)) {
+			*bad = n;
+			errno = EINVAL;
+			return -1;
+		}
+		if (add_fleet(corpus, &game.fleet) < 0) {
+			return -1;
+		}
+	}
+	if (res < 0) {
+		*bad = n + 1;
+		errno = EINVAL;
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * @brief add the fleets of all lines of a text file, skipping empty ones
+ * @param corpus the corpus to add to
+ * @param path the path of the file
+ * @param rules the rules every fleet has to follow
+ * @param bad the line of the first illegal fleet is stored into this
+ * parameter
+ * @return 0 on success, -1 on failure with errno set
+ */
+static int load_text(corpus_t *corpus,
+					 const char *path,
+					 const rules_t *rules,
+					 unsigned long *bad)
+{
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return -1;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) < 0) {
+		int err = errno;
+		close(fd);
+		errno = err;
+		return -1;
+	}
+	if (st.st_size == 0) {
+		close(fd);
+		errno = EINVAL;
+		return -1;
+	}
+
+	void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		return -1;
+	}
+	// the file is read front to back exactly once
+	madvise(data, st.st_size, MADV_SEQUENTIAL);
+
+	int res = parse_lines(corpus, data, st.st_size, rules, bad);
+	int err = errno;
+	munmap(data, st.st_size);
+	errno = err;
+	return res;
+}
+
+/**
+ * @brief parse the fleets of the lines of a mapped text file
+ * @param corpus the corpus to add to
+ * @param data the mapped file, not null terminated
+ * @param size the size of the file
+ * @param rules the rules every fleet has to follow
+ * @param bad the line of the first illegal fleet is stored into this
+ * parameter
+ * @return 0 on success, -1 on failure with errno set
+ */
+static int parse_lines(corpus_t *corpus,
+					   const char *data,
+					   size_t size,
+					   const rules_t *rules,
+					   unsigned long *bad)
+{
+	fleet_t fleet;
+	if (init_fleet(&fleet, rules) < 0) {
+		return -1;
+	}
+	// parse_fleet() needs a terminated line, longer ones are copied into a
+	// grown buffer
+	size_t line_size = FLEET_LINE_LEN(rules->ship_cnt) + 1;
+	char *line = malloc(line_size);
+	if (line == NULL) {
+		free_fleet(&fleet);
+		return -1;
+	}
+
+	int res = 0;
+	unsigned long line_no = 0;
+	const char *pos = data;
+	const char *end = data + size;
+	while (pos < end) {
+		const char *eol = memchr(pos, '\n', end - pos);
+		size_t len = (eol != NULL ? eol : end) - pos;
+		line_no++;
+
+		if (len + 1 > line_size) {
+			char *grown = realloc(line, len + 1);
+			if (grown == NULL) {
+				res = -1;
+				break;
+			}
+			line = grown;
+			line_size = len + 1;
+		}
+		memcpy(line, pos, len);
+		line[len] = '\0';
+		pos += len + 1;
+
+		if (line[strspn(line, " \t\r\v\f")] == '\0') {
+			// skip empty lines
+			continue;
+		}
+		if (parse_fleet(line, &fleet, rules) < 0) {
+			*bad = line_no;
+			errno = EINVAL;
+			res = -1;
+			break;
+		}
+		if (add_fleet(corpus, &fleet) < 0) {
+			res = -1;
+			break;
+		}
+	}
+
+	int err = errno;
+	free(line);
+	free_fleet(&fleet);
+	errno = err;
+	return res;
+}
+
+/**
+ * @brief append a fleet to a corpus, growing its storage if needed
+ * @param corpus the corpus to append to
+ * @param fleet a legal fleet of corpus->ship_cnt ships
+ * @return 0 on success, -1 if allocating failed
+ */
+static int add_fleet(corpus_t *corpus, const fleet_t *fleet)
+{
+	if (corpus->fleet_cnt == corpus->capacity) {
+		size_t capacity =
+			corpus->capacity > 0 ? 2 * corpus->capacity : INITIAL_CAPACITY;
+		ship_t *grown = realloc(
+			corpus->ships, capacity * corpus->ship_cnt * sizeof(ship_t));
+		if (grown == NULL) {
+			return -1;
+		}
+		corpus->ships = grown;
+		corpus->capacity = capacity;
+	}
+
+	memcpy(&corpus->ships[corpus->fleet_cnt * corpus->ship_cnt],
+		   fleet->ships,
+		   corpus->ship_cnt * sizeof(ship_t));
+	corpus->fleet_cnt++;
+	return 0;
+}
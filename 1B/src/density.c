@@ -0,0 +1,609 @@
+/**
+ * @file density.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Estimation of the ship density of the squares of a game in progress
+ * for OSUE exercise 1B `Battleship'.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "../include/density.h"
+
+// fleets tried between two readings of the clock, a power of two
+#define CLOCK_INTERVAL 64
+// draws of a placement for a ship of a sampled fleet before the fleet is
+// dropped
+#define PLACEMENT_DRAWS 16
+
+/**
+ * @brief a thread sampling fleets for an estimation
+ */
+typedef struct
+{
+	pthread_t thread;
+	struct sampler_pool *pool;
+	density_t *density;	 // the workspace of the current estimation
+	sampler_t *sampler;	 // its sampler the thread counts into
+} worker_t;
+
+/**
+ * @brief the threads sampling next to the calling thread, started with the
+ * workspace and sleeping between estimations
+ * @details workspaces initialized with a shared one sample on its threads,
+ * each estimation points the workers at the samplers of its own workspace.
+ */
+struct sampler_pool
+{
+	pthread_mutex_t lock;
+	pthread_cond_t start;	 // signalled when an estimation starts sampling
+	pthread_cond_t done;	 // signalled when the last worker finished
+	uint64_t round;			 // number of estimations that sampled so far
+	uint16_t running;		 // workers still sampling the current round
+	bool stopping;			 // the workers have to exit
+	uint16_t worker_cnt;	 // number of workers started
+	uint16_t users;			 // number of workspaces sampling on the pool
+	worker_t workers[MAX_SAMPLERS];  // the workers, sampling into the
+									 // samplers after the first one
+};
+
+static void find_placements(density_t *density,
+							const bitboard_t *blocked,
+							const bitboard_t *hits,
+							const uint16_t *ship_counts);
+static uint16_t count_hits(const bitboard_t *hits,
+						   uint8_t row,
+						   uint8_t rows,
+						   uint64_t mask);
+static double count_combinations(const density_t *density,
+								 const uint16_t *ship_counts);
+static void count_fleets(density_t *density,
+						 sampler_t *sampler,
+						 uint16_t depth,
+						 uint32_t from,
+						 uint16_t covered);
+static int start_pool(density_t *density);
+static void release_pool(density_t *density);
+static void sample_fleets(density_t *density, rng_t *rng);
+static void *run_worker(void *arg);
+static void run_sampler(const worker_t *worker);
+static void sample_fleet(const density_t *density, sampler_t *sampler);
+static void add_weights(density_t *density);
+static bool check_deadline(const density_t *density, sampler_t *sampler);
+
+int init_density(density_t *density,
+				 const rules_t *rules,
+				 uint16_t threads,
+				 density_t *shared)
+{
+	if (shared != NULL) {
+		threads = shared->sampler_cnt;
+	}
+
+	memset(density, 0, sizeof(*density));
+	density->map_size = rules->map_size;
+
+	// both alignments have map size * (map size - length + 1) placements
+	for (int m = rules->min_ship_len; m <= rules->max_ship_len; m++) {
+		if (rules->ship_counts[m] > 0) {
+			density->capacity +=
+				2 * rules->map_size * (rules->map_size - m + 1);
+		}
+	}
+
+	size_t squares = rules->map_size * rules->map_size;
+	density->placements = malloc(density->capacity * sizeof(placement_t));
+	density->hit_cnts = malloc(density->capacity * sizeof(uint16_t));
+	density->lengths = malloc(rules->ship_cnt);
+	density->taken = malloc((rules->ship_cnt + 1) * sizeof(bitboard_t));
+	density->counts = malloc(squares * sizeof(uint32_t));
+	density->samplers = calloc(threads, sizeof(sampler_t));
+	if (density->placements == NULL || density->hit_cnts == NULL
+		|| density->lengths == NULL || density->taken == NULL
+		|| density->counts == NULL || density->samplers == NULL) {
+		free_density(density);
+		return -1;
+	}
+
+	density->sampler_cnt = threads;
+	for (int t = 0; t < threads; t++) {
+		sampler_t *sampler = &density->samplers[t];
+		sampler->weights = malloc(density->capacity * sizeof(uint32_t));
+		sampler->chosen = malloc(rules->ship_cnt * sizeof(uint32_t));
+		if (sampler->weights == NULL || sampler->chosen == NULL) {
+			free_density(density);
+			return -1;
+		}
+	}
+	if (shared != NULL && shared->pool != NULL) {
+		density->pool = shared->pool;
+		pthread_mutex_lock(&density->pool->lock);
+		density->pool->users++;
+		pthread_mutex_unlock(&density->pool->lock);
+	} else if (shared == NULL && threads > 1 && start_pool(density) < 0) {
+		free_density(density);
+		return -1;
+	}
+	return 0;
+}
+
+void free_density(density_t *density)
+{
+	if (density->pool != NULL) {
+		release_pool(density);
+	}
+	for (int t = 0; t < density->sampler_cnt; t++) {
+		free(density->samplers[t].weights);
+		free(density->samplers[t].chosen);
+	}
+	free(density->samplers);
+	free(density->placements);
+	free(density->hit_cnts);
+	free(density->lengths);
+	free(density->taken);
+	free(density->counts);
+	memset(density, 0, sizeof(*density));
+}
+
+void estimate_density(density_t *density,
+					  const bitboard_t *blocked,
+					  const bitboard_t *hits,
+					  const uint16_t *ship_counts,
+					  rng_t *rng,
+					  uint32_t budget)
+{
+	density->deadline = get_time_ns() + (uint64_t)budget * 1000;
+	density->hit_total = 0;
+	for (int row = 0; row < density->map_size; row++) {
+		density->hit_total += count_hits(hits, row, 1, ~UINT64_C(0));
+	}
+
+	find_placements(density, blocked, hits, ship_counts);
+	density->fleets = 0;
+	density->exact = false;
+
+	sampler_t *first = &density->samplers[0];
+	memset(first->weights, 0, density->placement_cnt * sizeof(uint32_t));
+	first->fleets = 0;
+	first->ticks = 0;
+	first->expired = false;
+
+	double combinations = count_combinations(density, ship_counts);
+	if (combinations == 0) {
+		// some length has fewer placements left than ships
+		density->exact = true;
+	} else if (combinations <= EXACT_FLEETS) {
+		memset(density->taken[0].rows, 0, density->map_size * sizeof(uint64_t));
+		count_fleets(density, first, 0, 0, 0);
+		density->exact = !first->expired;
+	} else {
+		sample_fleets(density, rng);
+	}
+
+	density->fleets = first->fleets;
+	add_weights(density);
+}
+
+/**
+ * @brief collect the placements of the remaining ships that may be part of a
+ * consistent fleet
+ * @details a placement is left out if it covers a blocked square, or if it
+ * touches a hit it does not cover, since the ship covering that hit would
+ * touch it.
+ * @param density the workspace to fill
+ * @param blocked the squares no remaining ship covers
+ * @param hits the hits on ships that are not sunk yet
+ * @param ship_counts the number of remaining ships of each length
+ */
+static void find_placements(density_t *density,
+							const bitboard_t *blocked,
+							const bitboard_t *hits,
+							const uint16_t *ship_counts)
+{
+	uint8_t size = density->map_size;
+	uint32_t n = 0;
+	density->ship_cnt = 0;
+
+	for (int m = size; m >= MIN_SHIP_LEN; m--) {
+		density->first[m] = n;
+		density->count[m] = 0;
+		if (ship_counts[m] == 0) {
+			continue;
+		}
+		for (int i = 0; i < ship_counts[m]; i++) {
+			density->lengths[density->ship_cnt++] = m;
+		}
+
+		for (int a = horizontal; a <= vertical; a++) {
+			uint8_t rows = a == vertical ? size - m + 1 : size;
+			uint8_t cols = a == vertical ? size : size - m + 1;
+			for (int row = 0; row < rows; row++) {
+				for (int col = 0; col < cols; col++) {
+					ship_t ship = {.begin = {.row = row, .col = col},
+								   .end = {.row = row, .col = col},
+								   .length = m,
+								   .alignment = a};
+					if (a == vertical) {
+						ship.end.row += m - 1;
+					} else {
+						ship.end.col += m - 1;
+					}
+
+					placement_t *p = &density->placements[n];
+					make_placement(&ship, size, p);
+					if (collides(blocked, p)) {
+						continue;
+					}
+					uint16_t covered = count_hits(hits, row, p->rows, p->mask);
+					if (count_hits(hits, p->halo_row, p->halo_rows, p->halo)
+						!= covered) {
+						continue;
+					}
+
+					density->hit_cnts[n] = covered;
+					n++;
+				}
+			}
+		}
+		density->count[m] = n - density->first[m];
+	}
+	density->placement_cnt = n;
+}
+
+/**
+ * @brief count the hits within some rows of a board
+ * @param hits the board of hits
+ * @param row the first row
+ * @param rows the number of rows
+ * @param mask the squares to look at within each row
+ * @return the number of hits
+ */
+static uint16_t count_hits(const bitboard_t *hits,
+						   uint8_t row,
+						   uint8_t rows,
+						   uint64_t mask)
+{
+	uint16_t n = 0;
+	for (int i = 0; i < rows; i++) {
+		for (uint64_t bits = hits->rows[row + i] & mask; bits != 0;
+			 bits &= bits - 1) {
+			n++;
+		}
+	}
+	return n;
+}
+
+/**
+ * @brief compute the number of ways to choose placements for the remaining
+ * ships, ignoring that they may touch
+ * @param density the workspace holding the placements
+ * @param ship_counts the number of remaining ships of each length
+ * @return the number of combinations, 0 if some length has too few placements
+ */
+static double count_combinations(const density_t *density,
+								 const uint16_t *ship_counts)
+{
+	double combinations = 1;
+	for (int m = MIN_SHIP_LEN; m <= density->map_size; m++) {
+		// ships of the same length are interchangeable
+		for (int i = 0; i < ship_counts[m]; i++) {
+			if (density->count[m] <= (uint32_t)i) {
+				return 0;
+			}
+			combinations *= (double)(density->count[m] - i) / (i + 1);
+		}
+	}
+	return combinations;
+}
+
+/**
+ * @brief count every consistent fleet extending the ships chosen so far
+ * @details ships of the same length take their placements in increasing
+ * order, so every fleet is counted once.
+ * @param density the workspace
+ * @param sampler the sampler to count into
+ * @param depth the number of ships chosen so far
+ * @param from the first placement the next ship may take if it has the
+ * length of the previous one
+ * @param covered the hits covered by the ships chosen so far
+ */
+static void count_fleets(density_t *density,
+						 sampler_t *sampler,
+						 uint16_t depth,
+						 uint32_t from,
+						 uint16_t covered)
+{
+	if (depth == density->ship_cnt) {
+		if (covered == density->hit_total) {
+			for (int i = 0; i < depth; i++) {
+				sampler->weights[sampler->chosen[i]]++;
+			}
+			sampler->fleets++;
+		}
+		return;
+	}
+	if (check_deadline(density, sampler)) {
+		return;
+	}
+
+	uint8_t m = density->lengths[depth];
+	uint32_t start = depth > 0 && density->lengths[depth - 1] == m
+						 ? from
+						 : density->first[m];
+	const bitboard_t *taken = &density->taken[depth];
+	bitboard_t *next = &density->taken[depth + 1];
+
+	for (uint32_t i = start; i < density->first[m] + density->count[m]; i++) {
+		const placement_t *p = &density->placements[i];
+		if (collides(taken, p)) {
+			continue;
+		}
+		memcpy(next->rows, taken->rows, density->map_size * sizeof(uint64_t));
+		block_placement(next, p);
+		sampler->chosen[depth] = i;
+		count_fleets(
+			density, sampler, depth + 1, i + 1, covered + density->hit_cnts[i]);
+		if (sampler->expired) {
+			return;
+		}
+	}
+}
+
+/**
+ * @brief start the threads sampling next to the calling one
+ * @details a thread that cannot be started only reduces the number of
+ * fleets sampled.
+ * @param density the workspace, its samplers are allocated
+ * @return 0 on success, -1 if allocating failed
+ */
+static int start_pool(density_t *density)
+{
+	struct sampler_pool *pool = calloc(1, sizeof(struct sampler_pool));
+	if (pool == NULL) {
+		return -1;
+	}
+	if (pthread_mutex_init(&pool->lock, NULL) != 0) {
+		free(pool);
+		return -1;
+	}
+	if (pthread_cond_init(&pool->start, NULL) != 0) {
+		pthread_mutex_destroy(&pool->lock);
+		free(pool);
+		return -1;
+	}
+	if (pthread_cond_init(&pool->done, NULL) != 0) {
+		pthread_cond_destroy(&pool->start);
+		pthread_mutex_destroy(&pool->lock);
+		free(pool);
+		return -1;
+	}
+	pool->users = 1;
+	density->pool = pool;
+
+	for (int t = 1; t < density->sampler_cnt; t++) {
+		worker_t *worker = &pool->workers[pool->worker_cnt];
+		worker->pool = pool;
+		if (pthread_create(&worker->thread, NULL, run_worker, worker) == 0) {
+			pool->worker_cnt++;
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief stop sampling on the pool of a workspace, the last workspace using
+ * it lets the workers exit and frees it
+ * @param density the workspace, its pool is started
+ */
+static void release_pool(density_t *density)
+{
+	struct sampler_pool *pool = density->pool;
+	density->pool = NULL;
+	pthread_mutex_lock(&pool->lock);
+	if (--pool->users > 0) {
+		pthread_mutex_unlock(&pool->lock);
+		return;
+	}
+	pool->stopping = true;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (int w = 0; w < pool->worker_cnt; w++) {
+		pthread_join(pool->workers[w].thread, NULL);
+	}
+	pthread_cond_destroy(&pool->done);
+	pthread_cond_destroy(&pool->start);
+	pthread_mutex_destroy(&pool->lock);
+	free(pool);
+}
+
+/**
+ * @brief sample fleets on all threads until the budget is used up and merge
+ * their counts into the first sampler
+ * @details the workers of the pool are woken for the estimation, the calling
+ * thread samples as well and then waits for them to finish.
+ * @param density the workspace, all remaining lengths have placements
+ * @param rng the random number generator seeding the samplers
+ */
+static void sample_fleets(density_t *density, rng_t *rng)
+{
+	struct sampler_pool *pool = density->pool;
+	uint16_t worker_cnt = pool != NULL ? pool->worker_cnt : 0;
+
+	seed_rng(&density->samplers[0].rng, next_random(rng));
+	for (int w = 0; w < worker_cnt; w++) {
+		sampler_t *sampler = &density->samplers[w + 1];
+		pool->workers[w].density = density;
+		pool->workers[w].sampler = sampler;
+		seed_rng(&sampler->rng, next_random(rng));
+		memset(sampler->weights, 0, density->placement_cnt * sizeof(uint32_t));
+		sampler->fleets = 0;
+		sampler->ticks = 0;
+		sampler->expired = false;
+	}
+
+	if (worker_cnt > 0) {
+		pthread_mutex_lock(&pool->lock);
+		pool->round++;
+		pool->running = worker_cnt;
+		pthread_cond_broadcast(&pool->start);
+		pthread_mutex_unlock(&pool->lock);
+	}
+
+	worker_t self = {.density = density, .sampler = &density->samplers[0]};
+	run_sampler(&self);
+
+	if (worker_cnt == 0) {
+		return;
+	}
+	pthread_mutex_lock(&pool->lock);
+	while (pool->running > 0) {
+		pthread_cond_wait(&pool->done, &pool->lock);
+	}
+	pthread_mutex_unlock(&pool->lock);
+
+	sampler_t *first = &density->samplers[0];
+	for (int w = 0; w < worker_cnt; w++) {
+		const sampler_t *sampler = pool->workers[w].sampler;
+		for (uint32_t i = 0; i < density->placement_cnt; i++) {
+			first->weights[i] += sampler->weights[i];
+		}
+		first->fleets += sampler->fleets;
+	}
+}
+
+/**
+ * @brief sample fleets for every estimation until the pool is stopped
+ * @param arg the worker_t to run
+ * @return NULL
+ */
+static void *run_worker(void *arg)
+{
+	worker_t *worker = (worker_t *)arg;
+	struct sampler_pool *pool = worker->pool;
+	uint64_t round = 0;
+
+	pthread_mutex_lock(&pool->lock);
+	while (true) {
+		while (!pool->stopping && pool->round == round) {
+			pthread_cond_wait(&pool->start, &pool->lock);
+		}
+		if (pool->stopping) {
+			break;
+		}
+		round = pool->round;
+		pthread_mutex_unlock(&pool->lock);
+
+		run_sampler(worker);
+
+		pthread_mutex_lock(&pool->lock);
+		if (--pool->running == 0) {
+			pthread_cond_signal(&pool->done);
+		}
+	}
+	pthread_mutex_unlock(&pool->lock);
+	return NULL;
+}
+
+/**
+ * @brief sample fleets until the budget is used up
+ * @param worker the thread and sampler to sample with
+ */
+static void run_sampler(const worker_t *worker)
+{
+	while (!check_deadline(worker->density, worker->sampler)) {
+		sample_fleet(worker->density, worker->sampler);
+	}
+}
+
+/**
+ * @brief draw a fleet and count it if it is consistent
+ * @details each ship is drawn uniformly from the placements of its length.
+ * A ship touching the ones already placed is drawn again, up to
+ * PLACEMENT_DRAWS times, before the fleet is dropped. Unlike starting the
+ * whole fleet over, as random_fleet() does, this slightly favours fleets
+ * whose ships have few placements left, but keeps many more fleets within
+ * the budget.
+ * @param density the workspace, all remaining lengths have placements
+ * @param sampler the sampler to count into
+ */
+static void sample_fleet(const density_t *density, sampler_t *sampler)
+{
+	bitboard_t *taken = &sampler->taken;
+	memset(taken->rows, 0, density->map_size * sizeof(uint64_t));
+	uint16_t covered = 0;
+
+	for (int s = 0; s < density->ship_cnt; s++) {
+		uint8_t m = density->lengths[s];
+		uint32_t i;
+		const placement_t *p;
+		int draws = 0;
+		do {
+			if (draws++ == PLACEMENT_DRAWS) {
+				return;
+			}
+			i = density->first[m]
+				+ random_below(&sampler->rng, density->count[m]);
+			p = &density->placements[i];
+		} while (collides(taken, p));
+		block_placement(taken, p);
+		sampler->chosen[s] = i;
+		covered += density->hit_cnts[i];
+	}
+
+	if (covered == density->hit_total) {
+		for (int s = 0; s < density->ship_cnt; s++) {
+			sampler->weights[sampler->chosen[s]]++;
+		}
+		sampler->fleets++;
+	}
+}
+
+/**
+ * @brief sum up the weights of the placements covering each square
+ * @param density the workspace, the counts are stored into it
+ */
+static void add_weights(density_t *density)
+{
+	uint8_t size = density->map_size;
+	memset(density->counts, 0, size * size * sizeof(uint32_t));
+
+	for (int m = MIN_SHIP_LEN; m <= size; m++) {
+		for (uint32_t i = density->first[m];
+			 i < density->first[m] + density->count[m];
+			 i++) {
+			uint32_t weight = density->samplers[0].weights[i];
+			if (weight == 0) {
+				continue;
+			}
+			const ship_t *ship = &density->placements[i].ship;
+			coordinate_t c = ship->begin;
+			for (int j = 0; j < m; j++) {
+				density->counts[c.row * size + c.col] += weight;
+				if (ship->alignment == vertical) {
+					c.row++;
+				} else {
+					c.col++;
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief count a fleet tried and check if the budget is used up, reading the
+ * clock only every CLOCK_INTERVAL fleets
+ * @param density the workspace
+ * @param sampler the sampler trying the fleet
+ * @return true if the sampler has to stop
+ */
+static bool check_deadline(const density_t *density, sampler_t *sampler)
+{
+	if (++sampler->ticks % CLOCK_INTERVAL == 0
+		&& get_time_ns() >= density->deadline) {
+		sampler->expired = true;
+	}
+	return sampler->expired;
+}
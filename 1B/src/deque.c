@@ -4,39 +4,57 @@
 #include "../include/deque.h"
 
 
-deque_t *get_deque(void)
+/**
+ * @brief get the storage index of the element at the given position
+ * @param deque the deque to index
+ * @param pos the position of the element counted from the front, may be -1 for
+ * the slot in front of the head
+ * @return the index into the data array
+ */
+static inline size_t get_index(const deque_t *deque, long pos)
+{
+	return (deque->head + deque->capacity + pos) % deque->capacity;
+}
+
+deque_t *get_deque(size_t capacity)
 {
 	deque_t *deque = (deque_t *)malloc(sizeof(deque_t));
 	if (deque == NULL) {
 		return NULL;
 	}
-	deque->size = 0;
-	deque->head = NULL;
-	deque->tail = NULL;
+	if (init_deque(deque, capacity) < 0) {
+		free(deque);
+		return NULL;
+	}
 
 	return deque;
 }
 
+int init_deque(deque_t *deque, size_t capacity)
+{
+	deque->size = 0;
+	deque->head = 0;
+	deque->capacity = capacity;
+	deque->data = malloc(capacity * sizeof(coordinate_t));
+	return deque->data == NULL ? -1 : 0;
+}
+
+void free_deque(deque_t *deque)
+{
+	free(deque->data);
+	deque->data = NULL;
+}
+
 int8_t push_front(deque_t *deque, coordinate_t c)
 {
-	node_t *node = (node_t *)malloc(sizeof(node_t));
-	if (node == NULL) {
+	if (deque->size == deque->capacity) {
 		debug_print("%s\n", "Could not push front");
 		return -1;
 	}
 
-	node->data = c;
-
-	if (deque->size == 0) {
-		deque->head = node;
-		deque->tail = node;
-		deque->size = 1;
-	} else {
-		node->next = deque->head;
-		deque->head = node;
-		deque->size++;
-	}
-
+	deque->head = get_index(deque, -1);
+	deque->data[deque->head] = c;
+	deque->size++;
 
 	return 0;
 }
@@ -48,11 +66,8 @@ coordinate_t pop_front(deque_t *deque)
 		return invalid_coordinate;
 	}
 
-	node_t *old = deque->head;
-	coordinate_t c = old->data;
-
-	deque->head = old->next;
-	free(old);
+	coordinate_t c = deque->data[deque->head];
+	deque->head = get_index(deque, 1);
 	deque->size--;
 	return c;
 }
@@ -62,28 +77,19 @@ coordinate_t peek_front(deque_t *deque)
 	if (deque->size == 0) {
 		return invalid_coordinate;
 	} else {
-		return deque->head->data;
+		return deque->data[deque->head];
 	}
 }
 
 int8_t push_back(deque_t *deque, coordinate_t c)
 {
-	node_t *node = (node_t *)malloc(sizeof(node_t));
-	if (node == NULL) {
+	if (deque->size == deque->capacity) {
+		debug_print("%s\n", "Could not push back");
 		return -1;
 	}
-	node->data = c;
-
-	if (deque->size == 0) {
-		deque->head = node;
-		deque->tail = node;
-		deque->size = 1;
-	} else {
-		deque->tail->next = node;
-		deque->tail = node;
-		deque->size++;
-	}
 
+	deque->data[get_index(deque, deque->size)] = c;
+	deque->size++;
 
 	return 0;
 }
@@ -95,19 +101,8 @@ coordinate_t pop_back(deque_t *deque)
 		return invalid_coordinate;
 	}
 
-	node_t *old = deque->tail;
-	coordinate_t c = old->data;
-
-	node_t *n;
-	for (n = deque->head; n->next != deque->tail; n = n->next) {
-	}
-	n->next = NULL;
-	deque->tail = n;
-
-	free(old);
 	deque->size--;
-
-	return c;
+	return deque->data[get_index(deque, deque->size)];
 }
 
 coordinate_t peek_back(deque_t *deque)
@@ -115,14 +110,15 @@ coordinate_t peek_back(deque_t *deque)
 	if (deque->size == 0) {
 		return invalid_coordinate;
 	} else {
-		return deque->tail->data;
+		return deque->data[get_index(deque, deque->size - 1)];
 	}
 }
 
 bool contains(const deque_t *deque, coordinate_t element)
 {
-	for (node_t *n = deque->head; n->next != NULL; n = n->next) {
-		if (n->data.col == element.col && n->data.row == element.row) {
+	for (size_t i = 0; i < deque->size; i++) {
+		coordinate_t c = deque->data[get_index(deque, i)];
+		if (c.col == element.col && c.row == element.row) {
 			return true;
 		}
 	}
@@ -132,7 +128,5 @@ bool contains(const deque_t *deque, coordinate_t element)
 
 void clear(deque_t *deque)
 {
-	while (deque->size > 0) {
-		pop_front(deque);
-	}
-}
\ No newline at end of file
+	deque->size = 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file endgame.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Precomputed moves for sinking the last ships of OSUE exercise 1B
+ * `Battleship'.
+ */
+#include "../include/endgame.h"
+
+// bits of each field of a key
+#define KEY_FIELD_BITS 3
+
+bool is_endgame(const uint16_t *ship_counts)
+{
+	int n = 0;
+	for (int m = MIN_SHIP_LEN; m <= MAX_MAP_SIZE; m++) {
+		if (ship_counts[m] > 0 && m > ENDGAME_MAX_LEN) {
+			return false;
+		}
+		n += ship_counts[m];
+	}
+	return n > 0 && n <= ENDGAME_SHIPS;
+}
+
+uint32_t get_endgame_key(const uint16_t *ship_counts,
+						 uint8_t hits,
+						 const uint8_t *runs)
+{
+	// the lengths of the remaining ships, shortest first
+	uint8_t lengths[ENDGAME_SHIPS] = {0};
+	int n = 0;
+	for (int m = MIN_SHIP_LEN; m <= MAX_MAP_SIZE; m++) {
+		if (ship_counts[m] == 0) {
+			continue;
+		}
+		if (m > ENDGAME_MAX_LEN || n + ship_counts[m] > ENDGAME_SHIPS) {
+			return 0;
+		}
+		for (int i = 0; i < ship_counts[m]; i++) {
+			lengths[n++] = m;
+		}
+	}
+	if (n == 0 || hits == 0 || hits >= lengths[n - 1]) {
+		return 0;
+	}
+
+	// no ship reaches further beyond the hits than the longest one
+	uint8_t reach = lengths[n - 1] - hits;
+	uint32_t key = hits;
+	for (int i = 0; i < ENDGAME_SHIPS; i++) {
+		key = key << KEY_FIELD_BITS | lengths[i];
+	}
+	for (int d = 0; d < ENDGAME_DIRS; d++) {
+		key = key << KEY_FIELD_BITS | (runs[d] < reach ? runs[d] : reach);
+	}
+	return key;
+}
+
+uint32_t get_endgame_slot(uint32_t key, uint8_t bits)
+{
+	// multiplicative hashing by 2^32 divided by the golden ratio
+	return (uint32_t)(key * UINT32_C(2654435769)) >> (32 - bits);
+}
+
+int lookup_endgame(const uint32_t *table, uint8_t bits, uint32_t key)
+{
+	uint32_t mask = (UINT32_C(1) << bits) - 1;
+	for (uint32_t slot = get_endgame_slot(key, bits); table[slot] != 0;
+		 slot = (slot + 1) & mask) {
+		if (table[slot] >> 2 == key) {
+			return table[slot] & 3;
+		}
+	}
+	return -1;
+}
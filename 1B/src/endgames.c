@@ -0,0 +1,235 @@
+/**
+ * @file endgames.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Generator of the endgame table of OSUE exercise 1B `Battleship'.
+ * @details Evaluates every endgame state, see endgame.h, and prints the
+ * table of their moves as a C source file to stdout. Run by make when
+ * building the solver.
+ */
+
+// IO, C standard library, POSIX API, data types:
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../include/common.h"
+#include "../include/endgame.h"
+
+// entries of the generated table per line
+#define LINE_ENTRIES 6
+
+static char *program_name;
+
+static uint32_t *entries = NULL;  // the entries of all states, unordered
+static size_t entry_cnt = 0;
+static size_t entry_capacity = 0;
+
+static void print_usage(void);
+
+static int add_states(const uint16_t *ship_counts,
+					  uint8_t longest,
+					  uint8_t hits,
+					  uint8_t *runs,
+					  int d);
+static int solve_state(const uint16_t *ship_counts,
+					   uint8_t hits,
+					   const uint8_t *runs);
+static int add_entry(uint32_t key, int move);
+static int print_table(void);
+
+int main(int argc, char *argv[])
+{
+	program_name = argv[0];
+	if (getopt(argc, argv, "") != EOF || argc > optind) {
+		print_usage();
+		return EXIT_FAILURE;
+	}
+
+	// the longest ship alone, other below MIN_SHIP_LEN, or with a second one
+	// at most as long
+	for (int longest = MIN_SHIP_LEN; longest <= ENDGAME_MAX_LEN; longest++) {
+		for (int other = MIN_SHIP_LEN - 1; other <= longest; other++) {
+			uint16_t ship_counts[MAX_MAP_SIZE + 1] = {0};
+			ship_counts[longest]++;
+			if (other >= MIN_SHIP_LEN) {
+				ship_counts[other]++;
+			}
+
+			for (int hits = 1; hits < longest; hits++) {
+				uint8_t runs[ENDGAME_DIRS] = {0};
+				if (add_states(ship_counts, longest, hits, runs, 0) < 0) {
+					fprintf(stderr, "%s: Could not add states\n", program_name);
+					free(entries);
+					return EXIT_FAILURE;
+				}
+			}
+		}
+	}
+
+	int res = print_table();
+	free(entries);
+	return res;
+}
+
+/**
+ * @brief Print the usage message to stdout
+ */
+static void print_usage(void)
+{
+	printf("\nUsage:\n");
+	printf("\tendgames\n");
+	printf(
+		"\n\tprints the endgame table of the solver as a C source file to "
+		"stdout\n");
+	printf("\nexample:\n");
+	printf("\tendgames > endgame_table.c\n");
+}
+
+/**
+ * @brief add the states of all runs of the directions from d on
+ * @param ship_counts the remaining ships
+ * @param longest the length of the longest remaining ship
+ * @param hits the number of hits in a line
+ * @param runs the runs of the directions before d, the others are set in turn
+ * @param d the first direction to set
+ * @return 0 on success, -1 if allocating failed
+ */
+static int add_states(const uint16_t *ship_counts,
+					  uint8_t longest,
+					  uint8_t hits,
+					  uint8_t *runs,
+					  int d)
+{
+	// a line of hits only has two directions
+	int dirs = hits == 1 ? ENDGAME_DIRS : 2;
+	if (d == dirs) {
+		uint32_t key = get_endgame_key(ship_counts, hits, runs);
+		int move = solve_state(ship_counts, hits, runs);
+		return move < 0 ? 0 : add_entry(key, move);
+	}
+
+	for (int run = 0; run <= longest - hits; run++) {
+		runs[d] = run;
+		if (add_states(ship_counts, longest, hits, runs, d + 1) < 0) {
+			return -1;
+		}
+	}
+	runs[d] = 0;
+	return 0;
+}
+
+/**
+ * @brief find the direction of the neighbor of the hits covered by the most
+ * placements of the remaining ships
+ * @details ties go to the first direction.
+ * @param ship_counts the remaining ships
+ * @param hits the number of hits in a line
+ * @param runs the unknown squares next to the hits in each direction
+ * @return the direction, -1 if no remaining ship fits
+ */
+static int solve_state(const uint16_t *ship_counts,
+					   uint8_t hits,
+					   const uint8_t *runs)
+{
+	uint32_t scores[ENDGAME_DIRS] = {0};
+	// a single hit may lie on a vertical or a horizontal ship
+	int axes = hits == 1 ? 2 : 1;
+
+	for (int m = hits + 1; m <= ENDGAME_MAX_LEN; m++) {
+		for (int a = 0; a < axes; a++) {
+			uint8_t before = runs[2 * a];
+			uint8_t after = runs[2 * a + 1];
+			// the ship extends e squares before and m - hits - e after
+			for (int e = 0; e <= m - hits; e++) {
+				int f = m - hits - e;
+				if (e <= before && f <= after) {
+					scores[2 * a] += ship_counts[m] * (e > 0);
+					scores[2 * a + 1] += ship_counts[m] * (f > 0);
+				}
+			}
+		}
+	}
+
+	int best = 0;
+	for (int d = 1; d < ENDGAME_DIRS; d++) {
+		if (scores[d] > scores[best]) {
+			best = d;
+		}
+	}
+	return scores[best] > 0 ? best : -1;
+}
+
+/**
+ * @brief remember the move of a state
+ * @param key the key of the state
+ * @param move the direction to fire at
+ * @return 0 on success, -1 if allocating failed
+ */
+static int add_entry(uint32_t key, int move)
+{
+	// runs beyond the reach of the ships give the same key
+	for (size_t i = 0; i < entry_cnt; i++) {
+		if (entries[i] >> 2 == key) {
+			return 0;
+		}
+	}
+
+	if (entry_cnt == entry_capacity) {
+		size_t capacity = entry_capacity > 0 ? 2 * entry_capacity : 1024;
+		uint32_t *grown = realloc(entries, capacity * sizeof(uint32_t));
+		if (grown == NULL) {
+			return -1;
+		}
+		entries = grown;
+		entry_capacity = capacity;
+	}
+
+	entries[entry_cnt++] = key << 2 | move;
+	return 0;
+}
+
+/**
+ * @brief hash the entries into a table of at least twice their number of
+ * slots and print it
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE otherwise
+ */
+static int print_table(void)
+{
+	uint8_t bits = 1;
+	while ((size_t)1 << bits < 2 * entry_cnt) {
+		bits++;
+	}
+	uint32_t size = UINT32_C(1) << bits;
+	uint32_t *table = calloc(size, sizeof(uint32_t));
+	if (table == NULL) {
+		fprintf(stderr, "%s: Could not allocate table\n", program_name);
+		return EXIT_FAILURE;
+	}
+
+	for (size_t i = 0; i < entry_cnt; i++) {
+		uint32_t slot = get_endgame_slot(entries[i] >> 2, bits);
+		while (table[slot] != 0) {
+			slot = (slot + 1) & (size - 1);
+		}
+		table[slot] = entries[i];
+	}
+
+	printf("/* Generated by endgames, do not edit. */\n");
+	printf("#include \"../include/endgame.h\"\n\n");
+	printf("// %zu states\n", entry_cnt);
+	printf("const uint8_t endgame_bits = %u;\n\n", bits);
+	printf("const uint32_t endgame_table[] = {");
+	for (uint32_t slot = 0; slot < size; slot++) {
+		printf("%s0x%08x,",
+			   slot % LINE_ENTRIES == 0 ? "\n\t" : " ",
+			   (unsigned)table[slot]);
+	}
+	printf("\n};\n");
+
+	free(table);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,358 @@
+/**
+ * @file fleet.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-22
+ *
+ * @brief Generation and validation of complete fleets for OSUE exercise 1B
+ * `Battleship'.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "../include/fleet.h"
+
+// a word with a bit set for every column of a map of the given size
+#define ROW_BITS(size) \
+	((size) == 64 ? ~UINT64_C(0) : (UINT64_C(1) << (size)) - 1)
+
+static bool try_fleet(fleet_t *fleet,
+					  const rules_t *rules,
+					  const placements_t *placements,
+					  rng_t *rng);
+static void make_ship(uint8_t length,
+					  alignment_t alignment,
+					  uint8_t across,
+					  uint8_t along,
+					  ship_t *ship);
+
+int init_fleet(fleet_t *fleet, const rules_t *rules)
+{
+	fleet->ships = malloc(rules->ship_cnt * sizeof(ship_t));
+	if (fleet->ships == NULL) {
+		fleet->ship_cnt = 0;
+		return -1;
+	}
+	fleet->ship_cnt = rules->ship_cnt;
+	return 0;
+}
+
+void free_fleet(fleet_t *fleet)
+{
+	free(fleet->ships);
+	fleet->ships = NULL;
+	fleet->ship_cnt = 0;
+}
+
+void copy_fleet(fleet_t *dst, const fleet_t *src)
+{
+	memcpy(dst->ships, src->ships, src->ship_cnt * sizeof(ship_t));
+}
+
+int init_placements(placements_t *placements, const rules_t *rules)
+{
+	uint8_t size = rules->map_size;
+	size_t total = 0;
+	for (int length = 0; length <= MAX_MAP_SIZE; length++) {
+		placements->counts[length] = 0;
+		placements->by_length[length] = NULL;
+		if (length >= rules->min_ship_len && length <= rules->max_ship_len
+			&& rules->ship_counts[length] > 0) {
+			placements->counts[length] = 2 * size * (size - length + 1);
+			total += placements->counts[length];
+		}
+	}
+
+	placements->placements = malloc(total * sizeof(placement_t));
+	if (placements->placements == NULL) {
+		return -1;
+	}
+
+	placement_t *p = placements->placements;
+	for (int length = 0; length <= MAX_MAP_SIZE; length++) {
+		if (placements->counts[length] == 0) {
+			continue;
+		}
+		placements->by_length[length] = p;
+		for (int alignment = horizontal; alignment <= vertical; alignment++) {
+			for (int across = 0; across < size; across++) {
+				for (int along = 0; along + length <= size; along++) {
+					ship_t ship;
+					make_ship(length, alignment, across, along, &ship);
+					make_placement(&ship, size, p++);
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+void free_placements(placements_t *placements)
+{
+	free(placements->placements);
+	placements->placements = NULL;
+}
+
+int random_fleet(fleet_t *fleet,
+				 const rules_t *rules,
+				 const placements_t *placements,
+				 unsigned long attempts,
+				 rng_t *rng)
+{
+	for (unsigned long attempt = 0; attempt < attempts; attempt++) {
+		if (try_fleet(fleet, rules, placements, rng)) {
+			return 0;
+		}
+	}
+	return -1;
+}
+
+bool check_fleet(const fleet_t *fleet, const rules_t *rules)
+{
+	int counts[MAX_MAP_SIZE + 1];
+	for (int length = 0; length <= MAX_MAP_SIZE; length++) {
+		counts[length] = rules->ship_counts[length];
+	}
+	bitboard_t blocked;
+	memset(blocked.rows, 0, rules->map_size * sizeof(uint64_t));
+
+	if (fleet->ship_cnt != rules->ship_cnt) {
+		return false;
+	}
+
+	for (int i = 0; i < fleet->ship_cnt; i++) {
+		const ship_t *ship = &fleet->ships[i];
+		if (ship->length < MIN_SHIP_LEN || ship->length > rules->map_size
+			|| --counts[ship->length] < 0) {
+			return false;
+		}
+		if (!check_coordinate(ship->begin, rules->map_size)
+			|| !check_coordinate(ship->end, rules->map_size)) {
+			return false;
+		}
+
+		placement_t p;
+		make_placement(ship, rules->map_size, &p);
+		if (collides(&blocked, &p)) {
+			return false;
+		}
+		block_placement(&blocked, &p);
+	}
+
+	return true;
+}
+
+int parse_fleet(const char *line, fleet_t *fleet, const rules_t *rules)
+{
+	int n = 0;
+	const char *c = line;
+
+	while (true) {
+		while (isspace((unsigned char)*c)) {
+			c++;
+		}
+		if (*c == '\0') {
+			break;
+		}
+
+		char token[SHIP_STR_LEN + 1];
+		int len = 0;
+		while (*c != '\0' && !isspace((unsigned char)*c)) {
+			if (len == SHIP_STR_LEN) {
+				return -1;
+			}
+			token[len++] = *c++;
+		}
+		token[len] = '\0';
+
+		if (n == fleet->ship_cnt
+			|| parse_ship(token, &fleet->ships[n], rules->map_size) < 0) {
+			return -1;
+		}
+		n++;
+	}
+
+	if (n != fleet->ship_cnt || !check_fleet(fleet, rules)) {
+		return -1;
+	}
+
+	return 0;
+}
+
+void format_fleet(const fleet_t *fleet, char *buf)
+{
+	*buf = '\0';
+	for (int i = 0; i < fleet->ship_cnt; i++) {
+		if (i > 0) {
+			*buf++ = ' ';
+		}
+		buf += format_ship(&fleet->ships[i], buf);
+	}
+}
+
+long validate_fleets(FILE *in,
+					 FILE *report,
+					 unsigned long *total,
+					 const rules_t *rules)
+{
+	fleet_t fleet;
+	if (init_fleet(&fleet, rules) < 0) {
+		return -1;
+	}
+
+	char *line = NULL;
+	size_t size = 0;
+	unsigned long line_no = 0;
+	long invalid = 0;
+	*total = 0;
+
+	while (getline(&line, &size, in) != -1) {
+		line_no++;
+
+		const char *c = line;
+		while (isspace((unsigned char)*c)) {
+			c++;
+		}
+		if (*c == '\0') {
+			// skip empty lines
+			continue;
+		}
+
+		(*total)++;
+		if (parse_fleet(line, &fleet, rules) < 0) {
+			invalid++;
+			if (report != NULL) {
+				fprintf(report, "%lu\n", line_no);
+			}
+		}
+	}
+
+	free(line);
+	free_fleet(&fleet);
+
+	if (ferror(in)) {
+		return -1;
+	}
+
+	return invalid;
+}
+
+void place_fleet(map_t *map, const fleet_t *fleet)
+{
+	for (int i = 0; i < fleet->ship_cnt; i++) {
+		add_ship(map, &fleet->ships[i]);
+	}
+}
+
+void make_placement(const ship_t *ship,
+					uint8_t map_size,
+					placement_t *placement)
+{
+	placement->ship = *ship;
+
+	if (ship->alignment == horizontal) {
+		placement->rows = 1;
+		placement->mask = ROW_BITS(ship->length) << ship->begin.col;
+	} else {
+		placement->rows = ship->length;
+		placement->mask = UINT64_C(1) << ship->begin.col;
+	}
+
+	// the halo reaches one row above and below the ship
+	placement->halo_row = ship->begin.row > 0 ? ship->begin.row - 1 : 0;
+	placement->halo_rows = ship->end.row + 2 - placement->halo_row;
+	if (placement->halo_row + placement->halo_rows > map_size) {
+		placement->halo_rows = map_size - placement->halo_row;
+	}
+
+	uint64_t mask = placement->mask;
+	placement->halo = (mask | (mask << 1) | (mask >> 1)) & ROW_BITS(map_size);
+}
+
+bool collides(const bitboard_t *blocked, const placement_t *placement)
+{
+	const uint64_t *rows = &blocked->rows[placement->ship.begin.row];
+	for (int i = 0; i < placement->rows; i++) {
+		if (rows[i] & placement->mask) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void block_placement(bitboard_t *blocked, const placement_t *placement)
+{
+	uint64_t *rows = &blocked->rows[placement->halo_row];
+	for (int i = 0; i < placement->halo_rows; i++) {
+		rows[i] |= placement->halo;
+	}
+}
+
+/**
+ * @brief place all ships of a rule set once, longest first
+ * @param fleet the fleet to store the ships into
+ * @param rules the rules to place the ships of
+ * @param placements the placements of the rules
+ * @param rng the random number generator to use
+ * @return true if all ships were placed, false if one conflicted with the
+ * ones already placed
+ */
+static bool try_fleet(fleet_t *fleet,
+					  const rules_t *rules,
+					  const placements_t *placements,
+					  rng_t *rng)
+{
+	bitboard_t blocked;
+	for (int row = 0; row < rules->map_size; row++) {
+		blocked.rows[row] = 0;
+	}
+	int placed = 0;
+
+	for (int length = rules->max_ship_len; length >= rules->min_ship_len;
+		 length--) {
+		const placement_t *all = placements->by_length[length];
+		for (int i = 0; i < rules->ship_counts[length]; i++) {
+			const placement_t *p =
+				&all[random_below(rng, placements->counts[length])];
+			if (collides(&blocked, p)) {
+				// start the fleet over to keep the distribution uniform
+				return false;
+			}
+
+			block_placement(&blocked, p);
+			fleet->ships[placed++] = p->ship;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief build a ship from its position
+ * @param length the length of the ship
+ * @param alignment the alignment of the ship
+ * @param across the row of a horizontal or the column of a vertical ship
+ * @param along the column of a horizontal or the row of a vertical ship's
+ * begin
+ * @param ship the ship is stored into this parameter
+ */
+static void make_ship(uint8_t length,
+					  alignment_t alignment,
+					  uint8_t across,
+					  uint8_t along,
+					  ship_t *ship)
+{
+	ship->length = length;
+	ship->alignment = alignment;
+	if (alignment == horizontal) {
+		ship->begin.row = across;
+		ship->begin.col = along;
+		ship->end.row = across;
+		ship->end.col = along + length - 1;
+	} else {
+		ship->begin.row = along;
+		ship->begin.col = across;
+		ship->end.row = along + length - 1;
+		ship->end.col = across;
+	}
+}
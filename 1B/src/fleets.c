@@ -0,0 +1,213 @@
+/**
+ * @file fleets.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-22
+ *
+ * @brief Bulk generator and validator of fleets for OSUE exercise 1B
+ * `Battleship'.
+ * @details Fleets are written and read one per line, in the same format the
+ * server accepts as its arguments.
+ */
+
+// IO, C standard library, POSIX API, data types:
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "../include/common.h"
+#include "../include/fleet.h"
+#include "../include/rng.h"
+#include "../include/rules.h"
+
+static char *program_name;
+
+static bool check_mode = false;
+static unsigned long long fleet_cnt = 1;
+static uint64_t seed = 0;
+static const char *path = NULL;
+static rules_t rules;  // the rules of the fleets
+
+static int parse_args(int argc, char *argv[]);
+static void print_usage(void);
+
+static int generate(void);
+static int check(void);
+
+int main(int argc, char *argv[])
+{
+	seed = time(NULL) ^ getpid();
+
+	if (parse_args(argc, argv) < 0) {
+		print_usage();
+		return EXIT_FAILURE;
+	}
+
+	if (check_mode) {
+		return check();
+	} else {
+		return generate();
+	}
+}
+
+/**
+ * @brief Parses the program command line options
+ * @param argc the argument counter, length of argv
+ * @param argv an array of arguments
+ * @return 0 on success, -1 on failure
+ */
+static int parse_args(int argc, char *argv[])
+{
+	program_name = argv[0];
+
+	const char *rules_str = CLASSIC_RULES;
+	int arg_c;
+	char *end;
+	while ((arg_c = getopt(argc, argv, "cn:s:R:")) != EOF) {
+		switch (arg_c) {
+			case 'c':
+				check_mode = true;
+				break;
+			case 'n':
+				errno = 0;
+				fleet_cnt = strtoull(optarg, &end, 10);
+				if (errno != 0 || *end != '\0') {
+					return -1;
+				}
+				break;
+			case 's':
+				errno = 0;
+				seed = strtoull(optarg, &end, 10);
+				if (errno != 0 || *end != '\0') {
+					return -1;
+				}
+				break;
+			case 'R':
+				rules_str = optarg;
+				break;
+			default:
+				return -1;
+		}
+	}
+
+	if (check_mode && argc - optind == 1) {
+		path = argv[optind];
+	} else if (argc - optind >= 1) {
+		return -1;
+	}
+
+	if (parse_rules(rules_str, &rules) < 0) {
+		fprintf(stderr, "%s: Invalid rules %s\n", program_name, rules_str);
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Print the usage message to stdout
+ */
+static void print_usage(void)
+{
+	printf("\nUsage:\n");
+	printf("\tfleets [-n COUNT] [-s SEED] [-R RULES]\n");
+	printf("\tfleets -c [-R RULES] [FILE]\n");
+	printf("\n\t-n\tthe number of random fleets to print. Defaults to 1\n");
+	printf("\n\t-s\tthe seed for the random fleets\n");
+	printf(
+		"\n\t-R\tthe rules of the fleets, the map size followed by the "
+		"number of ships of each length. Defaults to %s\n",
+		CLASSIC_RULES);
+	printf(
+		"\n\t-c\tcheck the fleets in FILE, or stdin, and print the line "
+		"numbers of illegal ones\n");
+	printf("\nexample:\n");
+	printf("\tfleets -n 1000000 -s 42 > fleets.txt\n");
+	printf("\tfleets -c fleets.txt\n");
+}
+
+/**
+ * @brief print the requested number of random fleets to stdout
+ * @return the exit code of the program
+ */
+static int generate(void)
+{
+	rng_t rng;
+	seed_rng(&rng, seed);
+
+	placements_t placements;
+	if (init_placements(&placements, &rules) < 0) {
+		fprintf(stderr, "%s: Could not allocate placements\n", program_name);
+		return EXIT_FAILURE;
+	}
+	fleet_t fleet;
+	if (init_fleet(&fleet, &rules) < 0) {
+		fprintf(stderr, "%s: Could not allocate fleet\n", program_name);
+		free_placements(&placements);
+		return EXIT_FAILURE;
+	}
+	char *line = malloc(FLEET_LINE_LEN(fleet.ship_cnt));
+	if (line == NULL) {
+		fprintf(stderr, "%s: Could not allocate fleet\n", program_name);
+		free_fleet(&fleet);
+		free_placements(&placements);
+		return EXIT_FAILURE;
+	}
+
+	int result = EXIT_SUCCESS;
+	for (unsigned long long i = 0; i < fleet_cnt; i++) {
+		if (random_fleet(&fleet, &rules, &placements, FLEET_ATTEMPTS, &rng)
+			< 0) {
+			fprintf(stderr, "%s: No fleet fits the rules\n", program_name);
+			result = EXIT_FAILURE;
+			break;
+		}
+		format_fleet(&fleet, line);
+		if (puts(line) == EOF) {
+			fprintf(stderr, "%s: Could not write fleet\n", program_name);
+			result = EXIT_FAILURE;
+			break;
+		}
+	}
+
+	free(line);
+	free_fleet(&fleet);
+	free_placements(&placements);
+	return result;
+}
+
+/**
+ * @brief check the fleets of the input file
+ * @return EXIT_SUCCESS if all fleets are legal, EXIT_FAILURE otherwise
+ */
+static int check(void)
+{
+	FILE *in = stdin;
+	if (path != NULL) {
+		in = fopen(path, "r");
+		if (in == NULL) {
+			fprintf(stderr, "%s: Could not open %s\n", program_name, path);
+			fprintf(stderr, "\t%s\n", strerror(errno));
+			return EXIT_FAILURE;
+		}
+	}
+
+	unsigned long total;
+	long invalid = validate_fleets(in, stdout, &total, &rules);
+
+	if (in != stdin) {
+		fclose(in);
+	}
+
+	if (invalid < 0) {
+		fprintf(stderr, "%s: Could not read fleets\n", program_name);
+		return EXIT_FAILURE;
+	}
+
+	fprintf(stderr, "%s: %lu fleets, %ld illegal\n", program_name, total, invalid);
+	return invalid == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,304 @@
+/**
+ * @file gamelog.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-27
+ *
+ * @brief Compact binary log of finished games for OSUE exercise 1B
+ * `Battleship'.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../include/gamelog.h"
+
+// size of the stdio buffer of a log opened for appending
+#define WRITE_BUFFER_SIZE (1 << 16)
+
+// bytes of a cell index on a map of the given size
+#define CELL_BYTES(map_size) ((map_size) <= 16 ? 1 : 2)
+// bytes of the number of shots of a game with the given round limit
+#define COUNT_BYTES(max_rounds) ((max_rounds) <= UINT8_MAX ? 1 : 2)
+
+static void init_header(gamelog_header_t *header, const rules_t *rules);
+static bool check_header(const gamelog_header_t *header);
+static uint8_t *put_number(uint8_t *buf, uint16_t n, int bytes);
+static uint16_t get_number(const uint8_t *buf, int bytes);
+
+FILE *create_gamelog(const char *path, const rules_t *rules)
+{
+	FILE *log = fopen(path, "a+b");
+	if (log == NULL) {
+		return NULL;
+	}
+
+	// a full buffer is written with a single system call
+	setvbuf(log, NULL, _IOFBF, WRITE_BUFFER_SIZE);
+
+	gamelog_header_t header;
+	size_t n = fread(&header, 1, sizeof(header), log);
+	if (n == 0 && !ferror(log)) {
+		init_header(&header, rules);
+		if (fwrite(&header, sizeof(header), 1, log) != 1 || fflush(log) != 0) {
+			fclose(log);
+			return NULL;
+		}
+		return log;
+	}
+
+	if (n != sizeof(header) || !check_header(&header)
+		|| header.map_size != rules->map_size
+		|| header.ship_cnt != rules->ship_cnt
+		|| header.max_rounds != rules->max_rounds) {
+		fclose(log);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	return log;
+}
+
+int append_game(FILE *log,
+				const rules_t *rules,
+				const fleet_t *fleet,
+				const shot_t *shots,
+				uint16_t shot_cnt)
+{
+	int cell_bytes = CELL_BYTES(rules->map_size);
+	uint8_t buf[WRITE_BUFFER_SIZE / 16];
+	uint8_t *p = put_number(buf, shot_cnt, COUNT_BYTES(rules->max_rounds));
+
+	for (int i = 0; i < fleet->ship_cnt; i++) {
+		const ship_t *ship = &fleet->ships[i];
+		if (p - buf > (long)sizeof(buf) - 3) {
+			if (fwrite(buf, p - buf, 1, log) != 1) {
+				return -1;
+			}
+			p = buf;
+		}
+		p = put_number(p,
+					   ship->begin.row * rules->map_size + ship->begin.col,
+					   cell_bytes);
+		*p++ = ship->length
+			   | (ship->alignment == vertical ? GAMELOG_VERTICAL : 0);
+	}
+
+	for (int i = 0; i < shot_cnt; i++) {
+		if (p - buf > (long)sizeof(buf) - 3) {
+			if (fwrite(buf, p - buf, 1, log) != 1) {
+				return -1;
+			}
+			p = buf;
+		}
+		p = put_number(p, shots[i].cell, cell_bytes);
+		*p++ = shots[i].msg;
+	}
+
+	if (p > buf && fwrite(buf, p - buf, 1, log) != 1) {
+		return -1;
+	}
+	return 0;
+}
+
+gamelog_t *open_gamelog(const char *path)
+{
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return NULL;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) < 0) {
+		int err = errno;
+		close(fd);
+		errno = err;
+		return NULL;
+	}
+
+	if (st.st_size < sizeof(gamelog_header_t)) {
+		close(fd);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		return NULL;
+	}
+
+	if (!check_header((const gamelog_header_t *)data)) {
+		munmap(data, st.st_size);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	// the log is read front to back exactly once in the common case
+	madvise(data, st.st_size, MADV_SEQUENTIAL);
+
+	gamelog_t *log = (gamelog_t *)malloc(sizeof(gamelog_t));
+	if (log == NULL) {
+		munmap(data, st.st_size);
+		return NULL;
+	}
+	memcpy(&log->header, data, sizeof(gamelog_header_t));
+	log->ships = malloc(log->header.ship_cnt * sizeof(ship_t));
+	if (log->ships == NULL) {
+		munmap(data, st.st_size);
+		free(log);
+		return NULL;
+	}
+
+	log->data = data;
+	log->size = st.st_size;
+	rewind_gamelog(log);
+	return log;
+}
+
+int next_game(gamelog_t *log, game_t *game)
+{
+	if (log->pos == log->size) {
+		return 0;
+	}
+
+	const gamelog_header_t *header = &log->header;
+	int count_bytes = COUNT_BYTES(header->max_rounds);
+	int cell_bytes = CELL_BYTES(header->map_size);
+	size_t fleet_size = (size_t)header->ship_cnt * (cell_bytes + 1);
+
+	const uint8_t *record = log->data + log->pos;
+	size_t remaining = log->size - log->pos;
+	if (remaining < count_bytes + fleet_size) {
+		return -1;
+	}
+	game->shot_cnt = get_number(record, count_bytes);
+	game->cell_bytes = cell_bytes;
+	size_t record_size =
+		count_bytes + fleet_size + (size_t)game->shot_cnt * (cell_bytes + 1);
+	if (remaining < record_size) {
+		return -1;
+	}
+
+	uint8_t size = header->map_size;
+	unsigned cells = (unsigned)size * size;
+	const uint8_t *p = record + count_bytes;
+	for (int i = 0; i < header->ship_cnt; i++) {
+		ship_t *ship = &log->ships[i];
+		uint16_t cell = get_number(p, cell_bytes);
+		uint8_t length = p[cell_bytes];
+		p += cell_bytes + 1;
+		if (cell >= cells) {
+			return -1;
+		}
+
+		ship->begin.row = cell / size;
+		ship->begin.col = cell % size;
+		ship->length = length & ~GAMELOG_VERTICAL;
+		ship->end = ship->begin;
+		if (length & GAMELOG_VERTICAL) {
+			ship->alignment = vertical;
+			ship->end.row += ship->length - 1;
+		} else {
+			ship->alignment = horizontal;
+			ship->end.col += ship->length - 1;
+		}
+		// the whole ship has to lie within the map
+		uint8_t along =
+			ship->alignment == vertical ? ship->begin.row : ship->begin.col;
+		if (ship->length < MIN_SHIP_LEN || ship->length > size - along) {
+			return -1;
+		}
+	}
+	game->fleet.ship_cnt = header->ship_cnt;
+	game->fleet.ships = log->ships;
+	game->shots = p;
+
+	for (int i = 0; i < game->shot_cnt; i++) {
+		if (get_shot(game, i).cell >= cells) {
+			return -1;
+		}
+	}
+
+	log->pos += record_size;
+	return 1;
+}
+
+shot_t get_shot(const game_t *game, uint16_t i)
+{
+	const uint8_t *p = game->shots + (size_t)i * (game->cell_bytes + 1);
+	shot_t shot = {.cell = get_number(p, game->cell_bytes),
+				   .msg = p[game->cell_bytes]};
+	return shot;
+}
+
+void rewind_gamelog(gamelog_t *log)
+{
+	log->pos = sizeof(gamelog_header_t);
+}
+
+void close_gamelog(gamelog_t *log)
+{
+	if (log == NULL) {
+		return;
+	}
+	munmap((void *)log->data, log->size);
+	free(log->ships);
+	free(log);
+}
+
+/**
+ * @brief fill in the header of a log of games by the given rules
+ * @param header the header to initialize
+ * @param rules the rules of the games
+ */
+static void init_header(gamelog_header_t *header, const rules_t *rules)
+{
+	memset(header, 0, sizeof(gamelog_header_t));
+	memcpy(header->magic, GAMELOG_MAGIC, sizeof(header->magic));
+	header->map_size = rules->map_size;
+	header->ship_cnt = rules->ship_cnt;
+	header->max_rounds = rules->max_rounds;
+}
+
+/**
+ * @brief check that a header belongs to a log of games
+ * @param header the header to check
+ * @return true if the log can be read, false otherwise
+ */
+static bool check_header(const gamelog_header_t *header)
+{
+	return memcmp(header->magic, GAMELOG_MAGIC, sizeof(header->magic)) == 0
+		   && header->map_size > 0 && header->map_size <= MAX_MAP_SIZE
+		   && header->ship_cnt > 0;
+}
+
+/**
+ * @brief store a number little endian
+ * @param buf the buffer to store the number into
+ * @param n the number to store
+ * @param bytes the number of bytes to use, 1 or 2
+ * @return the buffer past the stored number
+ */
+static uint8_t *put_number(uint8_t *buf, uint16_t n, int bytes)
+{
+	buf[0] = n & 0xFF;
+	if (bytes == 2) {
+		buf[1] = n >> 8;
+	}
+	return buf + bytes;
+}
+
+/**
+ * @brief load a number stored by put_number()
+ * @param buf the buffer to load the number from
+ * @param bytes the number of bytes it takes, 1 or 2
+ * @return the number
+ */
+static uint16_t get_number(const uint8_t *buf, int bytes)
+{
+	return bytes == 2 ? buf[0] | buf[1] << 8 : buf[0];
+}
@@ -0,0 +1,166 @@
+/**
+ * @file heatmap.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Persistent heatmap of the fleets of an opponent for OSUE exercise 1B
+ * `Battleship'.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../include/heatmap.h"
+
+// size of the file of a heatmap of the given map size, 4 bytes per square
+#define HEATMAP_SIZE(map_size) \
+	(sizeof(heatmap_header_t) + (size_t)(map_size) * (map_size) * 4)
+
+static heatmap_t *map_heatmap(int fd, size_t size, int prot);
+
+heatmap_t *open_heatmap(const char *path)
+{
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return NULL;
+	}
+
+	heatmap_header_t header;
+	struct stat st;
+	if (fstat(fd, &st) < 0 || read(fd, &header, sizeof(header)) < 0) {
+		int err = errno;
+		close(fd);
+		errno = err;
+		return NULL;
+	}
+
+	if (st.st_size < sizeof(header)
+		|| memcmp(header.magic, HEATMAP_MAGIC, sizeof(header.magic)) != 0
+		|| header.map_size == 0 || header.map_size > MAX_MAP_SIZE
+		|| st.st_size != HEATMAP_SIZE(header.map_size)) {
+		close(fd);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	return map_heatmap(fd, st.st_size, PROT_READ);
+}
+
+heatmap_t *create_heatmap(const char *path, uint8_t map_size)
+{
+	int fd = open(path, O_RDWR | O_CREAT, 0644);
+	if (fd < 0) {
+		return NULL;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) < 0) {
+		int err = errno;
+		close(fd);
+		errno = err;
+		return NULL;
+	}
+
+	size_t size = HEATMAP_SIZE(map_size);
+	if (st.st_size == 0) {
+		// the file reads as zeros after growing it
+		heatmap_header_t header;
+		memset(&header, 0, sizeof(header));
+		memcpy(header.magic, HEATMAP_MAGIC, sizeof(header.magic));
+		header.map_size = map_size;
+		if (ftruncate(fd, size) < 0
+			|| write(fd, &header, sizeof(header)) != sizeof(header)) {
+			int err = errno;
+			close(fd);
+			errno = err;
+			return NULL;
+		}
+	} else if (st.st_size != size) {
+		close(fd);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	heatmap_t *heatmap = map_heatmap(fd, size, PROT_READ | PROT_WRITE);
+	if (heatmap != NULL
+		&& (memcmp(heatmap->header->magic,
+				   HEATMAP_MAGIC,
+				   sizeof(heatmap->header->magic))
+				!= 0
+			|| heatmap->header->map_size != map_size)) {
+		close_heatmap(heatmap);
+		errno = EINVAL;
+		return NULL;
+	}
+	return heatmap;
+}
+
+int count_fleet(heatmap_t *heatmap, const fleet_t *fleet)
+{
+	uint8_t map_size = heatmap->header->map_size;
+
+	// check the whole fleet first, so an illegal one leaves no counts behind
+	for (int i = 0; i < fleet->ship_cnt; i++) {
+		const ship_t *ship = &fleet->ships[i];
+		uint8_t along =
+			ship->alignment == vertical ? ship->begin.row : ship->begin.col;
+		if (ship->begin.row >= map_size || ship->begin.col >= map_size
+			|| ship->length < 1 || ship->length > map_size - along) {
+			return -1;
+		}
+	}
+
+	for (int i = 0; i < fleet->ship_cnt; i++) {
+		const ship_t *ship = &fleet->ships[i];
+		coordinate_t c = ship->begin;
+		for (int j = 0; j < ship->length; j++) {
+			heatmap->counts[c.row * map_size + c.col]++;
+			if (ship->alignment == vertical) {
+				c.row++;
+			} else {
+				c.col++;
+			}
+		}
+	}
+	heatmap->header->games++;
+	return 0;
+}
+
+void close_heatmap(heatmap_t *heatmap)
+{
+	if (heatmap == NULL) {
+		return;
+	}
+	munmap(heatmap->header, heatmap->size);
+	free(heatmap);
+}
+
+/**
+ * @brief map the file of a heatmap and close it
+ * @param fd the open file
+ * @param size the size of the file
+ * @param prot the protection of the mapping
+ * @return the mapped heatmap, NULL on failure
+ */
+static heatmap_t *map_heatmap(int fd, size_t size, int prot)
+{
+	void *data = mmap(NULL, size, prot, MAP_SHARED, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		return NULL;
+	}
+
+	heatmap_t *heatmap = (heatmap_t *)malloc(sizeof(heatmap_t));
+	if (heatmap == NULL) {
+		munmap(data, size);
+		return NULL;
+	}
+	heatmap->header = data;
+	heatmap->counts = (uint32_t *)((heatmap_header_t *)data + 1);
+	heatmap->size = size;
+	return heatmap;
+}
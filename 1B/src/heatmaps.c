@@ -0,0 +1,187 @@
+/**
+ * @file heatmaps.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Builder of the heatmaps of OSUE exercise 1B `Battleship'.
+ * @details Counts the fleets of every game of the given game logs into a
+ * heatmap, creating it if necessary, and prints the share of games in which
+ * each square was covered by a ship. The heatmap is the prior of client -H.
+ */
+
+// IO, C standard library, POSIX API, data types:
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+#include "../include/common.h"
+#include "../include/ship.h"
+#include "../include/gamelog.h"
+#include "../include/heatmap.h"
+
+static char *program_name;
+
+static const char *path = NULL;
+static char *const *log_paths = NULL;
+static int log_cnt = 0;
+
+static int parse_args(int argc, char *argv[]);
+static void print_usage(void);
+
+static int count_log(const char *log_path);
+static int print_heatmap(void);
+
+int main(int argc, char *argv[])
+{
+	if (parse_args(argc, argv) < 0) {
+		print_usage();
+		return EXIT_FAILURE;
+	}
+
+	for (int i = 0; i < log_cnt; i++) {
+		if (count_log(log_paths[i]) < 0) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	return print_heatmap();
+}
+
+/**
+ * @brief Parses the program command line options
+ * @param argc the argument counter, length of argv
+ * @param argv an array of arguments
+ * @return 0 on success, -1 on failure
+ */
+static int parse_args(int argc, char *argv[])
+{
+	program_name = argv[0];
+
+	if (getopt(argc, argv, "") != EOF || argc - optind < 1) {
+		return -1;
+	}
+
+	path = argv[optind];
+	log_paths = argv + optind + 1;
+	log_cnt = argc - optind - 1;
+	return 0;
+}
+
+/**
+ * @brief Print the usage message to stdout
+ */
+static void print_usage(void)
+{
+	printf("\nUsage:\n");
+	printf("\theatmaps HEATMAP [LOG...]\n");
+	printf(
+		"\n\tHEATMAP\tthe heatmap to print, created on a map of the size of "
+		"the first log if it does not exist\n");
+	printf(
+		"\n\tLOG\ta game log recorded with server -l, the fleets of all of "
+		"its games are counted into the heatmap\n");
+	printf("\nexample:\n");
+	printf("\theatmaps opponent.heat games.log\n");
+	printf("\tclient -H opponent.heat\n");
+}
+
+/**
+ * @brief count the fleets of every game of a log into the heatmap
+ * @param log_path the path of the log
+ * @return 0 on success, -1 on failure
+ */
+static int count_log(const char *log_path)
+{
+	gamelog_t *log = open_gamelog(log_path);
+	if (log == NULL) {
+		fprintf(stderr, "%s: Could not open %s\n", program_name, log_path);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return -1;
+	}
+
+	heatmap_t *heatmap = create_heatmap(path, log->header.map_size);
+	if (heatmap == NULL) {
+		fprintf(stderr,
+				"%s: Could not open %s for a %ux%u map\n",
+				program_name,
+				path,
+				log->header.map_size,
+				log->header.map_size);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		close_gamelog(log);
+		return -1;
+	}
+
+	game_t game;
+	int res;
+	unsigned long skipped = 0;
+	while ((res = next_game(log, &game)) == 1) {
+		if (count_fleet(heatmap, &game.fleet) < 0) {
+			skipped++;
+		}
+	}
+	if (res < 0) {
+		fprintf(stderr,
+				"%s: Invalid or truncated record in %s\n",
+				program_name,
+				log_path);
+	}
+	if (skipped > 0) {
+		fprintf(stderr,
+				"%s: Skipped %lu fleets off the map in %s\n",
+				program_name,
+				skipped,
+				log_path);
+	}
+
+	close_heatmap(heatmap);
+	close_gamelog(log);
+	return 0;
+}
+
+/**
+ * @brief print the share of games in which each square was covered by a
+ * ship, in percent
+ * @return EXIT_SUCCESS on success, EXIT_FAILURE otherwise
+ */
+static int print_heatmap(void)
+{
+	heatmap_t *heatmap = open_heatmap(path);
+	if (heatmap == NULL) {
+		fprintf(stderr, "%s: Could not open %s\n", program_name, path);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return EXIT_FAILURE;
+	}
+
+	uint8_t map_size = heatmap->header->map_size;
+	uint32_t games = heatmap->header->games;
+	printf("map:   %ux%u\n", map_size, map_size);
+	printf("games: %u\n", games);
+
+	printf("    ");
+	for (int col = 0; col < map_size; col++) {
+		char name[COORDINATE_LEN + 1];
+		coordinate_t c = {.row = 0, .col = col};
+		int n = format_coordinate(c, name);
+		// only the column letters
+		name[n - 1] = '\0';
+		printf(" %3s", name);
+	}
+	printf("\n");
+
+	for (int row = 0; row < map_size; row++) {
+		printf("%3d ", row);
+		for (int col = 0; col < map_size; col++) {
+			uint32_t count = heatmap->counts[row * map_size + col];
+			printf(" %3.0f", games > 0 ? 100.0 * count / games : 0.0);
+		}
+		printf("\n");
+	}
+
+	close_heatmap(heatmap);
+	return EXIT_SUCCESS;
+}
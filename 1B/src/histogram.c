@@ -0,0 +1,89 @@
+/**
+ * @file histogram.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-24
+ *
+ * @brief A fixed size log-linear histogram for latency measurements.
+ */
+#include <string.h>
+
+#include "../include/histogram.h"
+
+// log2 of HISTOGRAM_SUB_BUCKETS
+#define SUB_BUCKET_BITS 4
+
+/**
+ * @brief get the bucket of a value
+ * @details values below HISTOGRAM_SUB_BUCKETS get a bucket each, larger ones
+ * are split by their most significant bit and the SUB_BUCKET_BITS bits below
+ * it.
+ */
+static inline int get_bucket(uint64_t value)
+{
+	if (value < HISTOGRAM_SUB_BUCKETS) {
+		return value;
+	}
+
+	int msb = 63 - __builtin_clzll(value);
+	int shift = msb - SUB_BUCKET_BITS;
+	return (shift + 1) * HISTOGRAM_SUB_BUCKETS
+		   + ((value >> shift) & (HISTOGRAM_SUB_BUCKETS - 1));
+}
+
+/**
+ * @brief get the largest value falling into a bucket
+ */
+static inline uint64_t get_upper_bound(int bucket)
+{
+	if (bucket < HISTOGRAM_SUB_BUCKETS) {
+		return bucket;
+	}
+
+	int shift = bucket / HISTOGRAM_SUB_BUCKETS - 1;
+	uint64_t sub = bucket % HISTOGRAM_SUB_BUCKETS + HISTOGRAM_SUB_BUCKETS;
+	return ((sub + 1) << shift) - 1;
+}
+
+void clear_histogram(histogram_t *histogram)
+{
+	memset(histogram, 0, sizeof(histogram_t));
+}
+
+void record_value(histogram_t *histogram, uint64_t value)
+{
+	histogram->buckets[get_bucket(value)]++;
+	histogram->count++;
+	histogram->sum += value;
+	if (value > histogram->max) {
+		histogram->max = value;
+	}
+}
+
+void merge_histogram(histogram_t *to, const histogram_t *from)
+{
+	for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		to->buckets[i] += from->buckets[i];
+	}
+	to->count += from->count;
+	to->sum += from->sum;
+	if (from->max > to->max) {
+		to->max = from->max;
+	}
+}
+
+uint64_t get_percentile_value(const histogram_t *histogram, double p)
+{
+	if (histogram->count == 0) {
+		return 0;
+	}
+
+	uint64_t count = 0;
+	for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		count += histogram->buckets[i];
+		if (count >= p * histogram->count && histogram->buckets[i] > 0) {
+			uint64_t bound = get_upper_bound(i);
+			return bound < histogram->max ? bound : histogram->max;
+		}
+	}
+	return histogram->max;
+}
@@ -0,0 +1,687 @@
+/**
+ * @file loadgen.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-24
+ *
+ * @brief Load generator for the server of OSUE exercise 1B `Battleship'.
+ * @details Every connection plays its games back to back, starting each but
+ * the first with a new game message, until the requested number of games was
+ * started. The number of concurrent games thus stays constant during the run.
+ * Connections proposing rules wait for the server's answer before their first
+ * shot. Over a shared memory channel a single connection is played
+ * synchronously.
+ *
+ * Connections are assigned to the servers round robin and multiplexed with
+ * epoll, so each event costs the same regardless of the number of games in
+ * flight. Every connection advances its own solver as its responses arrive.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+#include <netdb.h>
+#include <fcntl.h>
+
+#include "../include/common.h"
+#include "../include/msg.h"
+#include "../include/codec.h"
+#include "../include/sockbuf.h"
+#include "../include/solver.h"
+#include "../include/histogram.h"
+#include "../include/channel.h"
+#include "../include/loadgen.h"
+
+// maximum number of events handled per call of epoll_wait
+#define MAX_EVENTS 64
+
+/**
+ * @brief a server the load is spread over
+ */
+typedef struct
+{
+	const char *name;			   // the server as given on the command line
+	struct sockaddr_storage addr;  // the server's address
+	socklen_t addrlen;
+	unsigned long finished;  // games finished on this server
+} server_t;
+
+/**
+ * @brief the state of a single connection and the game played on it
+ */
+typedef struct
+{
+	int fd;				   // the socket, -1 if the connection is not in use
+	server_t *server;	  // the server the connection is opened to
+	channel_t *channel;	// the shared memory channel, used instead of fd
+	bool connecting;	   // true until the non-blocking connect completed
+	bool negotiating;	  // true until the server answered the proposal
+	solver_t *solver;	  // the solver playing on this connection
+	coordinate_t shot;	 // the last shot sent to the server
+	hit_report_t report;   // the last report received from the server
+	bool new_game;		   // the next shot starts a new game
+	uint16_t round;		   // number of shots sent in the current game
+	uint64_t game_start;   // start time of the game in ns
+	uint64_t round_start;  // time the last shot was sent in ns
+} connection_t;
+
+/**
+ * @brief the state of a whole load run
+ */
+typedef struct
+{
+	const load_config_t *config;
+	const char *program_name;
+	server_t *servers;
+	unsigned long server_cnt;
+	connection_t *connections;
+	int epoll_fd;
+	unsigned long started;   // games started so far
+	unsigned long finished;  // games finished so far
+	unsigned long lost;		 // games lost by the round limit
+	histogram_t rounds;		 // latency of single rounds in ns
+	histogram_t games;		 // latency of whole games in ns
+} load_t;
+
+static int get_servers(load_t *load);
+static int get_address(load_t *load,
+					   server_t *server,
+					   const char *host,
+					   const char *port,
+					   const char *unix_path);
+static int open_connection(load_t *load, connection_t *conn);
+static int watch_connection(load_t *load, connection_t *conn, int op);
+static void start_game(load_t *load, connection_t *conn);
+static int handle_event(load_t *load, connection_t *conn);
+static int begin_games(load_t *load, connection_t *conn);
+static int send_rules(load_t *load, connection_t *conn);
+static int send_shot(load_t *load, connection_t *conn);
+static int send_requests(load_t *load,
+						 connection_t *conn,
+						 const client_msg_t *requests,
+						 int n);
+static int recv_report(load_t *load, connection_t *conn);
+static void close_connection(connection_t *conn);
+
+static void print_results(const load_t *load, double elapsed);
+static void print_latency(const char *name, const histogram_t *histogram);
+
+int run_load(const load_config_t *config, const char *program_name)
+{
+	load_t load = {
+		.config = config, .program_name = program_name, .epoll_fd = -1};
+	clear_histogram(&load.rounds);
+	clear_histogram(&load.games);
+	int result = EXIT_FAILURE;
+
+	if (config->shm_name == NULL && get_servers(&load) < 0) {
+		goto cleanup;
+	}
+
+	unsigned long n = config->connections;
+	if (n > config->games) {
+		n = config->games;
+	}
+	if (config->shm_name != NULL && n > 1) {
+		fprintf(stderr,
+				"%s: A shared memory channel serves a single connection\n",
+				program_name);
+		goto cleanup;
+	}
+
+	load.connections = (connection_t *)calloc(n, sizeof(connection_t));
+	if (load.connections == NULL) {
+		fprintf(stderr, "%s: Could not allocate connections\n", program_name);
+		goto cleanup;
+	}
+
+	if (config->shm_name == NULL) {
+		load.epoll_fd = epoll_create1(0);
+		if (load.epoll_fd < 0) {
+			fprintf(stderr, "%s: Could not create epoll instance\n", program_name);
+			fprintf(stderr, "\t%s\n", strerror(errno));
+			goto cleanup;
+		}
+	}
+
+	for (unsigned long i = 0; i < n; i++) {
+		load.connections[i].fd = -1;
+		if (load.servers != NULL) {
+			load.connections[i].server = &load.servers[i % load.server_cnt];
+		}
+		load.connections[i].solver =
+			get_solver(config->rules != NULL ? config->rules : &classic_rules,
+					   config->seed + i);
+		if (load.connections[i].solver == NULL
+			|| set_prior(load.connections[i].solver, config->prior) < 0
+			|| (i == 0 ? set_budget(load.connections[i].solver,
+									config->budget,
+									config->samplers)
+					   : share_budget(load.connections[i].solver,
+									  load.connections[0].solver))
+				   < 0) {
+			fprintf(stderr, "%s: Could not create solver\n", program_name);
+			goto cleanup;
+		}
+	}
+
+	uint64_t start = get_time_ns();
+
+	for (unsigned long i = 0; i < n; i++) {
+		if (open_connection(&load, &load.connections[i]) < 0) {
+			goto cleanup;
+		}
+	}
+
+	struct epoll_event events[MAX_EVENTS];
+	while (load.finished < config->games) {
+		if (config->shm_name != NULL) {
+			if (recv_report(&load, &load.connections[0]) < 0) {
+				goto cleanup;
+			}
+			continue;
+		}
+
+		int ready = epoll_wait(load.epoll_fd, events, MAX_EVENTS, -1);
+		if (ready < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			fprintf(stderr, "%s: Could not wait for events\n", program_name);
+			fprintf(stderr, "\t%s\n", strerror(errno));
+			goto cleanup;
+		}
+
+		for (int i = 0; i < ready; i++) {
+			if (handle_event(&load, events[i].data.ptr) < 0) {
+				goto cleanup;
+			}
+		}
+	}
+
+	print_results(&load, (get_time_ns() - start) / 1e9);
+	result = EXIT_SUCCESS;
+
+cleanup:
+	if (load.connections != NULL) {
+		for (unsigned long i = 0; i < n; i++) {
+			close_connection(&load.connections[i]);
+			free_solver(load.connections[i].solver);
+		}
+	}
+	free(load.connections);
+	free(load.servers);
+	if (load.epoll_fd != -1) {
+		close(load.epoll_fd);
+	}
+	return result;
+}
+
+/**
+ * @brief resolve the addresses of the servers the load is spread over
+ * @details a server containing a slash is the path of a Unix domain socket,
+ * otherwise it is a host optionally followed by a colon and a port. Without
+ * servers in the configuration its host, port or Unix domain socket is used.
+ * @param load the load run, the servers are stored into it
+ * @return 0 on success, -1 on failure
+ */
+static int get_servers(load_t *load)
+{
+	const load_config_t *config = load->config;
+	load->server_cnt = config->server_cnt > 0 ? config->server_cnt : 1;
+	load->servers = (server_t *)calloc(load->server_cnt, sizeof(server_t));
+	if (load->servers == NULL) {
+		fprintf(stderr, "%s: Could not allocate servers\n", load->program_name);
+		return -1;
+	}
+
+	if (config->server_cnt == 0) {
+		load->servers[0].name =
+			config->unix_path != NULL ? config->unix_path : config->host;
+		return get_address(load,
+						   &load->servers[0],
+						   config->host,
+						   config->port,
+						   config->unix_path);
+	}
+
+	for (unsigned long i = 0; i < config->server_cnt; i++) {
+		const char *name = config->servers[i];
+		load->servers[i].name = name;
+		if (strchr(name, '/') != NULL) {
+			if (get_address(load, &load->servers[i], NULL, NULL, name) < 0) {
+				return -1;
+			}
+			continue;
+		}
+
+		char host[NI_MAXHOST];
+		const char *port = config->port;
+		const char *colon = strrchr(name, ':');
+		size_t len = colon != NULL ? (size_t)(colon - name) : strlen(name);
+		if (len >= sizeof(host)) {
+			fprintf(stderr, "%s: Host name too long\n", load->program_name);
+			return -1;
+		}
+		memcpy(host, name, len);
+		host[len] = '\0';
+		if (colon != NULL) {
+			port = colon + 1;
+		}
+
+		if (get_address(load, &load->servers[i], host, port, NULL) < 0) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief resolve the address of a server, either a Unix domain socket path or
+ * a host and port
+ * @param load the load run
+ * @param server the server, its address is stored into it
+ * @param host the server's host, unused for a Unix domain socket
+ * @param port the server's port, unused for a Unix domain socket
+ * @param unix_path the server's Unix domain socket, NULL for TCP
+ * @return 0 on success, -1 on failure
+ */
+static int get_address(load_t *load,
+					   server_t *server,
+					   const char *host,
+					   const char *port,
+					   const char *unix_path)
+{
+	memset(&server->addr, 0, sizeof(server->addr));
+
+	if (unix_path != NULL) {
+		struct sockaddr_un *addr = (struct sockaddr_un *)&server->addr;
+		if (strlen(unix_path) >= sizeof(addr->sun_path)) {
+			fprintf(stderr, "%s: Socket path too long\n", load->program_name);
+			return -1;
+		}
+		addr->sun_family = AF_UNIX;
+		strcpy(addr->sun_path, unix_path);
+		server->addrlen = sizeof(struct sockaddr_un);
+		return 0;
+	}
+
+	struct addrinfo hints;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = SOCK_STREAM;
+
+	struct addrinfo *ai;
+	int res = getaddrinfo(host, port, &hints, &ai);
+	if (res != 0) {  // no errno
+		fprintf(stderr,
+				"%s: Could not set parameters for socket:",
+				load->program_name);
+		fprintf(stderr, "\t%s\n", gai_strerror(res));
+		return -1;
+	}
+
+	memcpy(&server->addr, ai->ai_addr, ai->ai_addrlen);
+	server->addrlen = ai->ai_addrlen;
+	freeaddrinfo(ai);
+	return 0;
+}
+
+/**
+ * @brief open a new connection and start the first game on it
+ * @param load the load run
+ * @param conn an unused connection
+ * @return 0 on success, -1 on failure
+ */
+static int open_connection(load_t *load, connection_t *conn)
+{
+	start_game(load, conn);
+	// the server starts the first game of a connection by itself
+	conn->new_game = false;
+
+	if (load->config->shm_name != NULL) {
+		conn->channel = open_channel(load->config->shm_name);
+		if (conn->channel == NULL) {
+			fprintf(stderr,
+					"%s: Could not open shared memory channel\n",
+					load->program_name);
+			fprintf(stderr, "\t%s\n", strerror(errno));
+			return -1;
+		}
+		conn->connecting = false;
+		return begin_games(load, conn);
+	}
+
+	server_t *server = conn->server;
+	conn->fd = socket(server->addr.ss_family, SOCK_STREAM, 0);
+	if (conn->fd < 0) {
+		fprintf(stderr, "%s: Could not create socket\n", load->program_name);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return -1;
+	}
+
+	// every round is a single send, Nagle's algorithm only delays it
+	int flags = fcntl(conn->fd, F_GETFL);
+	if (flags < 0 || fcntl(conn->fd, F_SETFL, flags | O_NONBLOCK) < 0
+		|| set_nodelay(conn->fd, true) < 0) {
+		fprintf(stderr, "%s: Could not set socket flags\n", load->program_name);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return -1;
+	}
+
+	if (connect(conn->fd, (struct sockaddr *)&server->addr, server->addrlen)
+		< 0) {
+		if (errno != EINPROGRESS) {
+			fprintf(stderr,
+					"%s: Could not connect to %s\n",
+					load->program_name,
+					server->name);
+			fprintf(stderr, "\t%s\n", strerror(errno));
+			return -1;
+		}
+		conn->connecting = true;
+		return watch_connection(load, conn, EPOLL_CTL_ADD);
+	}
+
+	conn->connecting = false;
+	if (watch_connection(load, conn, EPOLL_CTL_ADD) < 0) {
+		return -1;
+	}
+	return begin_games(load, conn);
+}
+
+/**
+ * @brief register the socket of a connection with the epoll instance
+ * @details a connecting socket is watched for becoming writable, a connected
+ * one for responses.
+ * @param load the load run
+ * @param conn the connection
+ * @param op EPOLL_CTL_ADD or EPOLL_CTL_MOD
+ * @return 0 on success, -1 on failure
+ */
+static int watch_connection(load_t *load, connection_t *conn, int op)
+{
+	struct epoll_event event = {.events = conn->connecting ? EPOLLOUT : EPOLLIN,
+								.data.ptr = conn};
+	if (epoll_ctl(load->epoll_fd, op, conn->fd, &event) < 0) {
+		fprintf(stderr, "%s: Could not register socket\n", load->program_name);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * @brief prepare a connection for the next game
+ * @param load the load run
+ * @param conn the connection to play the game on
+ */
+static void start_game(load_t *load, connection_t *conn)
+{
+	load->started++;
+	reset_solver(conn->solver);
+	conn->shot = invalid_coordinate;
+	conn->report = report_no_hit;
+	conn->new_game = true;
+	conn->round = 0;
+	conn->game_start = get_time_ns();
+}
+
+/**
+ * @brief handle the events of a connection
+ * @param load the load run
+ * @param conn the connection the events occurred on
+ * @return 0 on success, -1 on failure
+ */
+static int handle_event(load_t *load, connection_t *conn)
+{
+	if (conn->connecting) {
+		int err = 0;
+		socklen_t len = sizeof(err);
+		if (getsockopt(conn->fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0) {
+			err = errno;
+		}
+		if (err != 0) {
+			fprintf(stderr,
+					"%s: Could not connect to %s\n",
+					load->program_name,
+					conn->server->name);
+			fprintf(stderr, "\t%s\n", strerror(err));
+			return -1;
+		}
+
+		conn->connecting = false;
+		if (watch_connection(load, conn, EPOLL_CTL_MOD) < 0) {
+			return -1;
+		}
+		return begin_games(load, conn);
+	}
+
+	return recv_report(load, conn);
+}
+
+/**
+ * @brief start playing on an established connection, proposing the rules
+ * first if configured
+ * @param load the load run
+ * @param conn the connected connection
+ * @return 0 on success, -1 on failure
+ */
+static int begin_games(load_t *load, connection_t *conn)
+{
+	if (load->config->rules != NULL) {
+		return send_rules(load, conn);
+	}
+	return send_shot(load, conn);
+}
+
+/**
+ * @brief send the messages proposing the configured rules
+ * @param load the load run
+ * @param conn the connection to send the proposal on
+ * @return 0 on success, -1 on failure
+ */
+static int send_rules(load_t *load, connection_t *conn)
+{
+	client_msg_t requests[MAX_RULES_MSGS];
+	int n = encode_rules(load->config->rules, requests);
+	conn->negotiating = true;
+	return send_requests(load, conn, requests, n);
+}
+
+/**
+ * @brief let the solver choose the next shot and send it to the server
+ * @details the first shot of a game is sent together with the new game
+ * message. Requests are tiny and the protocol allows a single outstanding
+ * shot, so the send never blocks.
+ * @param load the load run
+ * @param conn the connection to send the shot on
+ * @return 0 on success, -1 on failure
+ */
+static int send_shot(load_t *load, connection_t *conn)
+{
+	conn->shot = next_move(conn->solver, conn->shot, conn->report);
+	conn->round++;
+
+	client_msg_t requests[2];
+	int n = 0;
+	if (conn->new_game) {
+		requests[n++] = get_control_msg(op_new_game);
+		conn->new_game = false;
+	}
+	requests[n++] = get_shot_msg(conn->shot);
+
+	return send_requests(load, conn, requests, n);
+}
+
+/**
+ * @brief send requests to the server at once and start timing the round
+ * @param load the load run
+ * @param conn the connection to send the requests on
+ * @param requests the requests to send
+ * @param n the number of requests, at most MAX_RULES_MSGS
+ * @return 0 on success, -1 on failure
+ */
+static int send_requests(load_t *load,
+						 connection_t *conn,
+						 const client_msg_t *requests,
+						 int n)
+{
+	if (conn->channel != NULL) {
+		conn->round_start = get_time_ns();
+		for (int r = 0; r < n; r++) {
+			if (send_request(conn->channel, requests[r]) < 0) {
+				fprintf(stderr, "%s: Server detached\n", load->program_name);
+				return -1;
+			}
+		}
+		return 0;
+	}
+
+	uint8_t buf[MAX_RULES_MSGS * REQUEST_LEN];
+	size_t len = encode_requests(requests, n, buf);
+	conn->round_start = get_time_ns();
+	if (send(conn->fd, buf, len, MSG_NOSIGNAL) < (ssize_t)len) {
+		fprintf(stderr, "%s: Could not send message\n", load->program_name);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief receive the server's response to the last shot and continue the game
+ * @param load the load run
+ * @param conn the readable connection
+ * @return 0 on success, -1 on failure
+ */
+static int recv_report(load_t *load, connection_t *conn)
+{
+	server_msg_t response;
+	ssize_t n;
+	if (conn->channel != NULL) {
+		n = recv_response(conn->channel, &response) < 0
+				? 0
+				: (ssize_t)sizeof(server_msg_t);
+	} else {
+		n = recv(conn->fd, &response, sizeof(server_msg_t), 0);
+	}
+	if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+		return 0;
+	}
+	if (n <= 0) {
+		fprintf(stderr, "%s: Connection lost\n", load->program_name);
+		if (n < 0) {
+			fprintf(stderr, "\t%s\n", strerror(errno));
+		}
+		return -1;
+	}
+
+	uint64_t now = get_time_ns();
+	if (conn->negotiating) {
+		conn->negotiating = false;
+		if (get_status(response) != game_ongoing) {
+			fprintf(stderr, "%s: Rules rejected by server\n", load->program_name);
+			return -1;
+		}
+		conn->game_start = now;
+		return send_shot(load, conn);
+	}
+	record_value(&load->rounds, now - conn->round_start);
+
+	conn->report = get_hit_report(response);
+	switch (get_status(response)) {
+		case game_ongoing:
+			return send_shot(load, conn);
+		case game_over:
+			record_value(&load->games, now - conn->game_start);
+			if (conn->report != report_last_sunk) {
+				load->lost++;
+			}
+			load->finished++;
+			if (conn->server != NULL) {
+				conn->server->finished++;
+			}
+			if (load->started < load->config->games) {
+				start_game(load, conn);
+				return send_shot(load, conn);
+			}
+			close_connection(conn);
+			return 0;
+		case err_coordinate:
+			fprintf(stderr, "%s: Invalid coordinate\n", load->program_name);
+			return -1;
+		case err_parity:
+		default:
+			fprintf(stderr, "%s: Parity error\n", load->program_name);
+			return -1;
+	}
+}
+
+/**
+ * @brief close the socket or channel of a connection
+ * @param conn the connection to close
+ */
+static void close_connection(connection_t *conn)
+{
+	if (conn->fd != -1) {
+		close(conn->fd);
+		conn->fd = -1;
+	}
+	if (conn->channel != NULL) {
+		close_channel(conn->channel);
+		conn->channel = NULL;
+	}
+	conn->connecting = false;
+	conn->negotiating = false;
+}
+
+/**
+ * @brief print the results of a load run to stdout
+ * @param load the finished load run
+ * @param elapsed the duration of the run in seconds
+ */
+static void print_results(const load_t *load, double elapsed)
+{
+	printf("games:       %lu (%lu connections)\n",
+		   load->finished,
+		   load->config->connections);
+	printf("lost:        %lu\n", load->lost);
+	printf("rounds/game: %.2f\n",
+		   load->finished > 0 ? (double)load->rounds.count / load->finished
+							  : 0.0);
+	print_latency("round", &load->rounds);
+	print_latency("game", &load->games);
+	printf("elapsed:     %.3f s\n", elapsed);
+	printf("games/s:     %.0f\n", elapsed > 0 ? load->finished / elapsed : 0.0);
+	printf("rounds/s:    %.0f\n",
+		   elapsed > 0 ? load->rounds.count / elapsed : 0.0);
+	for (unsigned long i = 0; load->server_cnt > 1 && i < load->server_cnt;
+		 i++) {
+		printf("server:      %s, %lu games\n",
+			   load->servers[i].name,
+			   load->servers[i].finished);
+	}
+}
+
+/**
+ * @brief print the latency percentiles of a histogram in microseconds
+ * @param name the name of the measured latency
+ * @param histogram the histogram of latencies in ns
+ */
+static void print_latency(const char *name, const histogram_t *histogram)
+{
+	printf("%-6s p50: %9.1f us  p99: %9.1f us  p999: %9.1f us  max: %9.1f us\n",
+		   name,
+		   get_percentile_value(histogram, 0.5) / 1e3,
+		   get_percentile_value(histogram, 0.99) / 1e3,
+		   get_percentile_value(histogram, 0.999) / 1e3,
+		   histogram->max / 1e3);
+}
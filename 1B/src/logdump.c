@@ -0,0 +1,189 @@
+/**
+ * @file logdump.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-27
+ *
+ * @brief Reader of the binary game logs of OSUE exercise 1B `Battleship'.
+ * @details Prints every game of a log as a line of text, or only a summary of
+ * all games.
+ */
+
+// IO, C standard library, POSIX API, data types:
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+#include "../include/common.h"
+#include "../include/msg.h"
+#include "../include/fleet.h"
+#include "../include/gamelog.h"
+
+static char *program_name;
+
+static bool summary = false;
+static const char *path = NULL;
+
+static int parse_args(int argc, char *argv[]);
+static void print_usage(void);
+
+static void print_game(const game_t *game, uint8_t map_size);
+
+int main(int argc, char *argv[])
+{
+	if (parse_args(argc, argv) < 0) {
+		print_usage();
+		return EXIT_FAILURE;
+	}
+
+	gamelog_t *log = open_gamelog(path);
+	if (log == NULL) {
+		fprintf(stderr, "%s: Could not open %s\n", program_name, path);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return EXIT_FAILURE;
+	}
+
+	uint16_t max_rounds = log->header.max_rounds;
+	uint64_t games = 0;
+	uint64_t won = 0;
+	uint64_t shots = 0;
+	uint64_t *rounds = (uint64_t *)calloc(max_rounds + 1, sizeof(uint64_t));
+	if (rounds == NULL) {
+		fprintf(stderr, "%s: Could not allocate histogram\n", program_name);
+		close_gamelog(log);
+		return EXIT_FAILURE;
+	}
+	double start = get_time_ns() / 1e9;
+
+	game_t game;
+	int res;
+	while ((res = next_game(log, &game)) == 1) {
+		games++;
+		shots += game.shot_cnt;
+
+		if (game.shot_cnt > 0
+			&& get_hit_report(get_shot(&game, game.shot_cnt - 1).msg)
+				   == report_last_sunk) {
+			won++;
+			if (game.shot_cnt <= max_rounds) {
+				rounds[game.shot_cnt]++;
+			}
+		}
+
+		if (!summary) {
+			print_game(&game, log->header.map_size);
+		}
+	}
+
+	double elapsed = get_time_ns() / 1e9 - start;
+
+	if (res < 0) {
+		fprintf(stderr,
+				"%s: Invalid or truncated record in %s\n",
+				program_name,
+				path);
+	}
+
+	if (summary) {
+		uint64_t count = 0;
+		int median = 0;
+		for (int r = 0; r <= max_rounds && won > 0; r++) {
+			count += rounds[r];
+			if (2 * count >= won) {
+				median = r;
+				break;
+			}
+		}
+
+		printf("map:     %ux%u, %u ships\n",
+			   log->header.map_size,
+			   log->header.map_size,
+			   log->header.ship_cnt);
+		printf("games:   %llu\n", (unsigned long long)games);
+		printf("won:     %llu\n", (unsigned long long)won);
+		printf("shots:   %llu\n", (unsigned long long)shots);
+		if (games > 0) {
+			printf("mean:    %.2f shots\n", (double)shots / games);
+			printf("median:  %d shots of won games\n", median);
+			printf("bytes:   %.1f per game\n", (double)log->size / games);
+		}
+		printf("elapsed: %.3f s\n", elapsed);
+	}
+
+	free(rounds);
+	close_gamelog(log);
+	return res < 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/**
+ * @brief Parses the program command line options
+ * @param argc the argument counter, length of argv
+ * @param argv an array of arguments
+ * @return 0 on success, -1 on failure
+ */
+static int parse_args(int argc, char *argv[])
+{
+	program_name = argv[0];
+
+	int arg_c;
+	while ((arg_c = getopt(argc, argv, "s")) != EOF) {
+		switch (arg_c) {
+			case 's':
+				summary = true;
+				break;
+			default:
+				return -1;
+		}
+	}
+
+	if (argc - optind != 1) {
+		return -1;
+	}
+	path = argv[optind];
+
+	return 0;
+}
+
+/**
+ * @brief Print the usage message to stdout
+ */
+static void print_usage(void)
+{
+	printf("\nUsage:\n");
+	printf("\tlogdump [-s] FILE\n");
+	printf(
+		"\n\t-s\tonly print a summary instead of a line per game with its "
+		"fleet and shots\n");
+	printf("\nexample:\n");
+	printf("\tlogdump -s games.log\n");
+}
+
+/**
+ * @brief print a game as its fleet, a colon and its shots with their reports
+ * @param game the game to print
+ * @param map_size the length of each side of the map of the game
+ */
+static void print_game(const game_t *game, uint8_t map_size)
+{
+	static const char reports[] = {'.', 'x', 's', 'S'};
+
+	for (int i = 0; i < game->fleet.ship_cnt; i++) {
+		char ship[SHIP_STR_LEN + 1];
+		format_ship(&game->fleet.ships[i], ship);
+		printf(i == 0 ? "%s" : " %s", ship);
+	}
+	printf(":");
+
+	for (int i = 0; i < game->shot_cnt; i++) {
+		shot_t shot = get_shot(game, i);
+		coordinate_t c = {.row = shot.cell / map_size,
+						  .col = shot.cell % map_size};
+		char name[COORDINATE_LEN + 1];
+		format_coordinate(c, name);
+		printf(" %s%c", name, reports[get_hit_report(shot.msg)]);
+	}
+	printf("\n");
+}
@@ -10,33 +10,34 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "../include/map.h"
 
 
-static inline void put_ship(map_t* map, uint8_t value, coordinate_t coordinate)
+static inline void put_ship(map_t* map, int16_t value, coordinate_t coordinate)
 {
-	map->field[coordinate.row * MAP_SIZE + coordinate.col] = value;
+	map->field[coordinate.row * map->map_size + coordinate.col] = value;
 }
 
-static inline int8_t get_ship(const map_t* map, coordinate_t coordinate)
+static inline int16_t get_ship(const map_t* map, coordinate_t coordinate)
 {
-	return map->field[coordinate.row * MAP_SIZE + coordinate.col];
+	return map->field[coordinate.row * map->map_size + coordinate.col];
 }
 
 hit_t get_hit(const map_t* map, coordinate_t coordinate)
 {
-	return map->hits[coordinate.row * MAP_SIZE + coordinate.col];
+	return map->hits[coordinate.row * map->map_size + coordinate.col];
 }
 
 void put_hit(map_t* map, hit_t value, coordinate_t coordinate)
 {
-	map->hits[coordinate.row * MAP_SIZE + coordinate.col] = value;
+	map->hits[coordinate.row * map->map_size + coordinate.col] = value;
 }
 
 void add_ship(map_t* map, const ship_t* ship)
 {
-	uint8_t value = map->ship_count;
+	int16_t value = map->ship_total;
 
 
 	if (ship->alignment == horizontal) {
@@ -60,31 +61,29 @@ void add_ship(map_t* map, const ship_t* ship)
 	map->ships[value].ship = ship;
 	map->ships[value].ship_remainder = ship->length;
 	map->ship_count++;
+	map->ship_total++;
 }
 
-bool check_ship_count(const map_t* map)
+bool check_ship_count(const map_t* map, const rules_t* rules)
 {
-	int ship_cnt_2 = SHIP_CNT_LEN2;
-	int ship_cnt_3 = SHIP_CNT_LEN3;
-	int ship_cnt_4 = SHIP_CNT_LEN4;
+	int counts[MAX_MAP_SIZE + 1];
+	for (int length = 0; length <= MAX_MAP_SIZE; length++) {
+		counts[length] = rules->ship_counts[length];
+	}
 
 	for (int i = 0; i < map->ship_count; i++) {
-		switch (map->ships[i].ship->length) {
-			case 2:
-				ship_cnt_2--;
-				break;
-			case 3:
-				ship_cnt_3--;
-				break;
-			case 4:
-				ship_cnt_4--;
-				break;
-			default:
-				return false;
+		uint8_t length = map->ships[i].ship->length;
+		if (length > MAX_MAP_SIZE || --counts[length] < 0) {
+			return false;
 		}
 	}
 
-	return ship_cnt_2 == 0 && ship_cnt_3 == 0 && ship_cnt_4 == 0;
+	for (int length = 0; length <= MAX_MAP_SIZE; length++) {
+		if (counts[length] != 0) {
+			return false;
+		}
+	}
+	return true;
 }
 
 
@@ -94,7 +93,7 @@ bool check_ship_touch(const map_t* map)
 	for (int s = 0; s < map->ship_count; s++) {
 		const ship_t* ship = map->ships[s].ship;
 
-		int8_t neighbors[9];
+		int16_t neighbors[9];
 
 		coordinate_t c = ship->begin;
 		// for each coordinate
@@ -104,13 +103,13 @@ bool check_ship_touch(const map_t* map)
 				// for each column
 				for (int j = -1; j <= 1; j++) {
 
-					int8_t x = c.row + i;
-					int8_t y = c.col + j;
+					int x = c.row + i;
+					int y = c.col + j;
 
-					if (x < 0 || x > MAP_SIZE - 1) {
+					if (x < 0 || x > map->map_size - 1) {
 						x = c.row;
 					}
-					if (y < 0 || y > MAP_SIZE - 1) {
+					if (y < 0 || y > map->map_size - 1) {
 						y = c.col;
 					}
 
@@ -143,19 +142,23 @@ void print_map(const map_t* map)
 {
 	int x, y;
 
-	printf("  ");
-	for (x = 0; x < MAP_SIZE; x++) {
-		printf("%c ", 'A' + x);
+	printf("   ");
+	for (x = 0; x < map->map_size; x++) {
+		char name[COORDINATE_LEN + 1];
+		format_coordinate((coordinate_t){.row = 0, .col = x}, name);
+		// strip the row, leaving the column's letters
+		name[strlen(name) - 1] = '\0';
+		printf("%-2s ", name);
 	}
 
 	printf("\n");
 
-	for (y = 0; y < MAP_SIZE; y++) {
-		printf("%c ", '0' + y);
-		for (x = 0; x < MAP_SIZE; x++) {
+	for (y = 0; y < map->map_size; y++) {
+		printf("%2d ", y);
+		for (x = 0; x < map->map_size; x++) {
 			coordinate_t c = {.row = y, .col = x};
 			hit_t val = get_hit(map, c);
-			printf("%c ", val == unknown ? ' ' : ((val == hit) ? 'x' : 'o'));
+			printf("%c  ", val == unknown ? ' ' : ((val == hit) ? 'x' : 'o'));
 		}
 
 		printf("\n");
@@ -170,7 +173,7 @@ hit_report_t shoot(map_t* map, coordinate_t c)
 		return report_no_hit;
 	}
 
-	int8_t val = get_ship(map, c);
+	int16_t val = get_ship(map, c);
 	if (val == -1) {
 		// no ship at this position
 		debug_print("%s\n", "Miss");
@@ -197,17 +200,46 @@ hit_report_t shoot(map_t* map, coordinate_t c)
 	}
 }
 
-map_t* get_map(void)
+void clear_map(map_t* map)
 {
-	map_t* map = (map_t*)malloc(sizeof(map_t));
-	if (map == NULL) {
-		return NULL;
-	}
-
-	for (int i = 0; i < MAP_SIZE * MAP_SIZE; i++) {
+	for (int i = 0; i < map->map_size * map->map_size; i++) {
 		map->field[i] = -1;
 		map->hits[i] = unknown;
 	}
 	map->ship_count = 0;
+	map->ship_total = 0;
+}
+
+void reset_map(map_t* map)
+{
+	memset(map->hits, unknown, map->map_size * map->map_size);
+	for (int i = 0; i < map->ship_total; i++) {
+		map->ships[i].ship_remainder = map->ships[i].ship->length;
+	}
+	map->ship_count = map->ship_total;
+}
+
+map_t* get_map(const rules_t* rules)
+{
+	size_t squares = rules->map_size * rules->map_size;
+	// the ship entries hold pointers and go first to stay aligned
+	map_t* map = (map_t*)malloc(sizeof(map_t)
+								+ rules->ship_cnt * sizeof(ship_entry_t)
+								+ squares * sizeof(int16_t) + squares);
+	if (map == NULL) {
+		return NULL;
+	}
+
+	map->map_size = rules->map_size;
+	map->ships = (ship_entry_t*)(map + 1);
+	map->field = (int16_t*)(map->ships + rules->ship_cnt);
+	map->hits = (uint8_t*)(map->field + squares);
+
+	clear_map(map);
 	return map;
+}
+
+void free_map(map_t* map)
+{
+	free(map);
 }
\ No newline at end of file
@@ -0,0 +1,104 @@
+/**
+ * @file metrics.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Live metrics of the server of OSUE exercise 1B `Battleship'.
+ */
+#include <stdio.h>
+#include <limits.h>
+#include <errno.h>
+
+#include "../include/metrics.h"
+
+// suffix of the temporary file the metrics are written to first
+#define TMP_SUFFIX ".tmp"
+
+static void print_counter(FILE *file, const char *name, uint64_t value);
+static void print_latency(FILE *file,
+						  const char *name,
+						  const histogram_t *histogram);
+
+int write_metrics(const char *path,
+				  const metrics_t *metrics,
+				  uint64_t interval_shots,
+				  uint64_t interval_ns)
+{
+	char tmp_path[PATH_MAX];
+	if (snprintf(tmp_path, sizeof(tmp_path), "%s%s", path, TMP_SUFFIX)
+		>= (int)sizeof(tmp_path)) {
+		errno = ENAMETOOLONG;
+		return -1;
+	}
+
+	FILE *file = fopen(tmp_path, "w");
+	if (file == NULL) {
+		return -1;
+	}
+
+	print_counter(file, "connections", metrics->connections);
+	print_counter(file, "games_active", metrics->active_games);
+	print_counter(file, "games_started", metrics->games_started);
+	print_counter(file, "games_finished", metrics->games_finished);
+	print_counter(file, "shots", metrics->shots);
+	fprintf(file,
+			"shots_per_second %.1f\n",
+			interval_ns > 0 ? interval_shots * 1e9 / interval_ns : 0.0);
+	print_counter(file, "errors_parity", metrics->parity_errors);
+	print_counter(file, "errors_coordinate", metrics->coordinate_errors);
+	print_counter(file, "timeouts", metrics->timeouts);
+	print_latency(file, "round", &metrics->rounds);
+	print_latency(file, "service", &metrics->service);
+
+	if (fclose(file) != 0) {
+		remove(tmp_path);
+		return -1;
+	}
+	// readers see either the previous or the new metrics, never a mix
+	if (rename(tmp_path, path) < 0) {
+		remove(tmp_path);
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * @brief print a line holding a single number
+ * @param file the file to print to
+ * @param name the name of the metric
+ * @param value the value of the metric
+ */
+static void print_counter(FILE *file, const char *name, uint64_t value)
+{
+	fprintf(file, "%s %llu\n", name, (unsigned long long)value);
+}
+
+/**
+ * @brief print the number of values of a latency histogram and its
+ * percentiles in microseconds
+ * @param file the file to print to
+ * @param name the name of the measured latency
+ * @param histogram the histogram of latencies in ns
+ */
+static void print_latency(FILE *file,
+						  const char *name,
+						  const histogram_t *histogram)
+{
+	fprintf(file,
+			"%s_count %llu\n",
+			name,
+			(unsigned long long)histogram->count);
+	fprintf(file,
+			"%s_p50_us %.1f\n",
+			name,
+			get_percentile_value(histogram, 0.5) / 1e3);
+	fprintf(file,
+			"%s_p99_us %.1f\n",
+			name,
+			get_percentile_value(histogram, 0.99) / 1e3);
+	fprintf(file,
+			"%s_p999_us %.1f\n",
+			name,
+			get_percentile_value(histogram, 0.999) / 1e3);
+	fprintf(file, "%s_max_us %.1f\n", name, histogram->max / 1e3);
+}
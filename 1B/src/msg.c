@@ -1,24 +1,23 @@
 #include "../include/msg.h"
 #include <stdio.h>
 
+// parity of every 4 bit value, bit i holds the parity of i
+#define NIBBLE_PARITY 0x6996
+
 uint8_t calc_parity_bit(client_msg_t msg)
 {
-	uint8_t counter = 0;
-
 	msg &= ~PARITY_BIT;
 
-	while (msg) {
-		counter += msg % 2;
-		msg >>= 1;
-	}
-	return counter % 2;
+	msg ^= msg >> 8;
+	msg ^= msg >> 4;
+	return (NIBBLE_PARITY >> (msg & 0xf)) & 1;
 }
 
 
 uint8_t get_parity_bit(client_msg_t msg)
 {
 	debug_print("Get parity bit of %04x\n", msg);
-	return (uint8_t)msg >> PARITY_POS;
+	return (uint8_t)(msg >> PARITY_POS);
 }
 
 
@@ -29,9 +28,9 @@ bool check_parity(client_msg_t msg)
 
 client_msg_t set_parity_bit(client_msg_t msg, client_msg_t parity_bit)
 {
-	parity_bit <<= PARITY_POS;
+	parity_bit = (parity_bit & 1) << PARITY_POS;
 
-	msg &= ~parity_bit;
+	msg &= ~PARITY_BIT;
 	msg |= parity_bit;
 
 	return msg;
@@ -47,6 +46,38 @@ coordinate_t get_coordinates(client_msg_t msg)
 	return c;
 }
 
+opcode_t get_opcode(client_msg_t msg)
+{
+	return (opcode_t)((msg >> OPCODE_OFFSET) & OPCODE_BITS);
+}
+
+client_msg_t get_shot_msg(coordinate_t c)
+{
+	client_msg_t msg = (op_shot << OPCODE_OFFSET)
+					   | (c.col << X_COORDINATE_OFFSET) | c.row;
+	return set_parity_bit(msg, calc_parity_bit(msg));
+}
+
+client_msg_t get_control_msg(opcode_t opcode)
+{
+	client_msg_t msg = opcode << OPCODE_OFFSET;
+	return set_parity_bit(msg, calc_parity_bit(msg));
+}
+
+client_msg_t get_param_msg(opcode_t opcode, uint8_t first, uint8_t second)
+{
+	client_msg_t msg = (opcode << OPCODE_OFFSET)
+					   | (((second - 1) & COORDINATE_BITS) << X_COORDINATE_OFFSET)
+					   | ((first - 1) & COORDINATE_BITS);
+	return set_parity_bit(msg, calc_parity_bit(msg));
+}
+
+void get_params(client_msg_t msg, uint8_t *first, uint8_t *second)
+{
+	*first = (msg & COORDINATE_BITS) + 1;
+	*second = ((msg >> X_COORDINATE_OFFSET) & COORDINATE_BITS) + 1;
+}
+
 status_t get_status(server_msg_t msg)
 {
 	return (status_t)(msg & 0xc);
@@ -0,0 +1,828 @@
+/**
+ * @file replay.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-27
+ *
+ * @brief Replay benchmark of the server of OSUE exercise 1B `Battleship'.
+ * @details Replays the shots of a game log recorded by the server over many
+ * concurrent connections on localhost, as fast as the server answers. No
+ * solver runs, so the measured cost is that of the server's event loop,
+ * message codec and map alone. Only the games played on the fleet of the
+ * first game of the log are replayed, every response is compared to the
+ * recorded one.
+ *
+ * If a server binary is given, it is started on that fleet for the run; its
+ * CPU time and system calls are reported alongside the benchmark's own. The
+ * rules of the replayed games are derived from that fleet and proposed at
+ * connect unless they are the classic ones.
+ *
+ * As the responses are known in advance, the shots of a game may be
+ * pipelined: all of them are sent without waiting for a response.
+ */
+
+// IO, C standard library, POSIX API, data types:
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+
+// Sockets, processes, ... :
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <poll.h>
+
+#include "../include/common.h"
+#include "../include/msg.h"
+#include "../include/codec.h"
+#include "../include/sockbuf.h"
+#include "../include/fleet.h"
+#include "../include/gamelog.h"
+#include "../include/rules.h"
+
+// default number of concurrent connections
+#define DEFAULT_CONNECTIONS 16
+// attempts to connect while a started server is not listening yet
+#define CONNECT_RETRIES 200
+// pause between two attempts to connect in microseconds
+#define CONNECT_DELAY 10000
+
+// count a system call of the benchmark for the statistics
+#define COUNTED(call) (syscall_cnt++, (call))
+
+/**
+ * @brief the state of a single connection and the game replayed on it
+ */
+typedef struct
+{
+	int fd;			 // the socket, -1 if the connection is closed
+	sockbuf_t io;	 // buffers of the socket
+	game_t game;	 // the recorded game replayed on this connection
+	uint16_t sent;	 // number of shots sent in the current game
+	uint16_t round;  // number of responses received in the current game
+	bool new_game;	 // the next shot starts a new game
+	bool corked;	 // the socket is corked until the game is sent
+} connection_t;
+
+static char *program_name;
+
+static const char *port = DEFAULT_PORT;	// the port of the server
+static const char *server_path = NULL;	// the server to start, if not NULL
+static const char *log_path = NULL;		// the game log to replay
+static unsigned long connection_cnt = DEFAULT_CONNECTIONS;
+static unsigned long game_limit = 0;	// games to replay, 0 = every game once
+static bool pipeline = false;		// send shots without awaiting responses
+
+static gamelog_t *game_log = NULL;
+static fleet_t fleet;				   // the fleet of the replayed games
+static rules_t rules;				   // the rules of the replayed games
+static connection_t *connections = NULL;
+static struct pollfd *fds = NULL;
+static pid_t server_pid = -1;		   // the started server, -1 if none
+static FILE *server_out = NULL;		   // the standard output of the server
+
+static unsigned long started = 0;	   // games started so far
+static unsigned long finished = 0;	   // games finished so far
+static unsigned long long shot_cnt = 0;	  // shots sent so far
+static unsigned long long syscall_cnt = 0;  // system calls of the replay
+
+static int parse_args(int argc, char *argv[]);
+static void print_usage(void);
+
+static unsigned long count_games(void);
+static void next_recorded_game(game_t *game);
+static bool same_fleet(const fleet_t *a, const fleet_t *b);
+static int derive_rules(const game_t *game);
+static int propose_rules(int fd);
+static int start_server(void);
+static int stop_server(void);
+static unsigned long long get_server_syscalls(void);
+static int open_connection(connection_t *conn);
+static void start_recorded_game(connection_t *conn);
+static int send_shots(connection_t *conn);
+static int recv_responses(connection_t *conn);
+static void close_connection(connection_t *conn);
+
+static void print_results(double elapsed);
+static double get_cpu_time(int who);
+static void cleanup(void);
+
+int main(int argc, char *argv[])
+{
+	if (parse_args(argc, argv) < 0) {
+		print_usage();
+		return EXIT_FAILURE;
+	}
+
+	game_log = open_gamelog(log_path);
+	if (game_log == NULL) {
+		fprintf(stderr, "%s: Could not open %s\n", program_name, log_path);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return EXIT_FAILURE;
+	}
+
+	game_t first;
+	if (next_game(game_log, &first) != 1) {
+		fprintf(stderr, "%s: %s holds no games\n", program_name, log_path);
+		cleanup();
+		return EXIT_FAILURE;
+	}
+	if (derive_rules(&first) < 0) {
+		fprintf(stderr, "%s: %s holds no valid games\n", program_name, log_path);
+		cleanup();
+		return EXIT_FAILURE;
+	}
+
+	unsigned long recorded = count_games();
+	if (game_limit == 0) {
+		game_limit = recorded;
+	}
+	if (connection_cnt > game_limit) {
+		connection_cnt = game_limit;
+	}
+
+	connections =
+		(connection_t *)calloc(connection_cnt, sizeof(connection_t));
+	fds = (struct pollfd *)calloc(connection_cnt, sizeof(struct pollfd));
+	if (connections == NULL || fds == NULL) {
+		fprintf(stderr, "%s: Could not allocate connections\n", program_name);
+		cleanup();
+		return EXIT_FAILURE;
+	}
+	for (unsigned long i = 0; i < connection_cnt; i++) {
+		connections[i].fd = -1;
+	}
+
+	if (server_path != NULL && start_server() < 0) {
+		cleanup();
+		return EXIT_FAILURE;
+	}
+
+	for (unsigned long i = 0; i < connection_cnt; i++) {
+		if (open_connection(&connections[i]) < 0) {
+			cleanup();
+			return EXIT_FAILURE;
+		}
+	}
+
+	// connecting is not part of the measurement
+	syscall_cnt = 0;
+	double cpu_start = get_cpu_time(RUSAGE_SELF);
+	double start = get_time_ns() / 1e9;
+
+	for (unsigned long i = 0; i < connection_cnt; i++) {
+		if (send_shots(&connections[i]) < 0) {
+			cleanup();
+			return EXIT_FAILURE;
+		}
+	}
+
+	while (finished < game_limit) {
+		for (unsigned long i = 0; i < connection_cnt; i++) {
+			connection_t *conn = &connections[i];
+			fds[i].fd = conn->fd;
+			fds[i].events = POLLIN;
+			// a pipelined game may not fit into the socket at once
+			if (conn->io.wlen > 0
+				|| (pipeline && conn->sent < conn->game.shot_cnt)) {
+				fds[i].events |= POLLOUT;
+			}
+			fds[i].revents = 0;
+		}
+
+		if (COUNTED(poll(fds, connection_cnt, -1)) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			fprintf(stderr, "%s: Could not poll connections\n", program_name);
+			fprintf(stderr, "\t%s\n", strerror(errno));
+			cleanup();
+			return EXIT_FAILURE;
+		}
+
+		for (unsigned long i = 0; i < connection_cnt; i++) {
+			connection_t *conn = &connections[i];
+			if ((fds[i].revents & ~POLLOUT) != 0
+				&& recv_responses(conn) < 0) {
+				cleanup();
+				return EXIT_FAILURE;
+			}
+			if ((fds[i].revents & POLLOUT) != 0 && conn->fd != -1
+				&& send_shots(conn) < 0) {
+				cleanup();
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	double elapsed = get_time_ns() / 1e9 - start;
+	double cpu = get_cpu_time(RUSAGE_SELF) - cpu_start;
+	for (unsigned long i = 0; i < connection_cnt; i++) {
+		syscall_cnt += connections[i].io.syscalls;
+	}
+
+	printf("games:        %lu of %lu recorded (%lu connections)\n",
+		   finished,
+		   recorded,
+		   connection_cnt);
+	printf("shots:        %llu\n", shot_cnt);
+	print_results(elapsed);
+	printf("replay cpu:   %.2f us/game, %.2f syscalls/shot\n",
+		   cpu * 1e6 / finished,
+		   (double)syscall_cnt / shot_cnt);
+
+	int result = EXIT_SUCCESS;
+	if (server_pid != -1) {
+		if (stop_server() < 0) {
+			result = EXIT_FAILURE;
+		} else {
+			printf("server cpu:   %.2f us/game, %.2f syscalls/shot\n",
+				   get_cpu_time(RUSAGE_CHILDREN) * 1e6 / finished,
+				   (double)get_server_syscalls() / shot_cnt);
+		}
+	}
+
+	cleanup();
+	return result;
+}
+
+/**
+ * @brief Parses the program command line options
+ * @param argc the argument counter, length of argv
+ * @param argv an array of arguments
+ * @return 0 on success, -1 on failure
+ */
+static int parse_args(int argc, char *argv[])
+{
+	program_name = argv[0];
+
+	int arg_c;
+	char *end;
+	while ((arg_c = getopt(argc, argv, "p:c:g:s:P")) != EOF) {
+		switch (arg_c) {
+			case 'p':
+				port = optarg;
+				break;
+			case 'c':
+				errno = 0;
+				connection_cnt = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0' || connection_cnt == 0) {
+					return -1;
+				}
+				break;
+			case 'g':
+				errno = 0;
+				game_limit = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0') {
+					return -1;
+				}
+				break;
+			case 's':
+				server_path = optarg;
+				break;
+			case 'P':
+				pipeline = true;
+				break;
+			default:
+				return -1;
+		}
+	}
+
+	if (argc - optind != 1) {
+		return -1;
+	}
+	log_path = argv[optind];
+
+	return 0;
+}
+
+/**
+ * @brief Print the usage message to stdout
+ */
+static void print_usage(void)
+{
+	printf("\nUsage:\n");
+	printf(
+		"\treplay [-p PORT] [-c CONNECTIONS] [-g GAMES] [-s SERVER] [-P] "
+		"LOG\n");
+	printf("\n\t-p\tthe port of the server. Defaults to %s\n", DEFAULT_PORT);
+	printf(
+		"\n\t-c\tthe number of concurrent connections. Defaults to %d\n",
+		DEFAULT_CONNECTIONS);
+	printf(
+		"\n\t-g\tthe number of games to replay, the log is replayed again "
+		"from its start if necessary. Defaults to every game once\n");
+	printf(
+		"\n\t-s\tstart the server binary SERVER on the fleet of the log for "
+		"the run instead of connecting to a running server\n");
+	printf(
+		"\n\t-P\tpipeline the shots of a game, send all of them without "
+		"waiting for the responses\n");
+	printf(
+		"\n\tLOG\ta game log recorded with server -l, only the games played "
+		"on the fleet of its first game are replayed\n");
+	printf("\nexample:\n");
+	printf("\treplay -c 64 -g 100000 -s ./server games.log\n");
+	printf("\treplay -P -c 4 -s ./server games.log\n");
+}
+
+/**
+ * @brief count the recorded games played on the fleet of the first game
+ * @return the number of games
+ */
+static unsigned long count_games(void)
+{
+	unsigned long n = 0;
+	game_t game;
+
+	rewind_gamelog(game_log);
+	while (next_game(game_log, &game) == 1) {
+		if (same_fleet(&game.fleet, &fleet)) {
+			n++;
+		}
+	}
+	rewind_gamelog(game_log);
+	return n;
+}
+
+/**
+ * @brief get the next recorded game played on the fleet of the first game,
+ * starting over at the end of the log
+ * @param game the game is stored into this parameter
+ */
+static void next_recorded_game(game_t *game)
+{
+	while (true) {
+		if (next_game(game_log, game) != 1) {
+			rewind_gamelog(game_log);
+			continue;
+		}
+		if (same_fleet(&game->fleet, &fleet)) {
+			return;
+		}
+	}
+}
+
+/**
+ * @brief check whether two fleets are placed identically
+ * @return true if all ships are equal, false otherwise
+ */
+static bool same_fleet(const fleet_t *a, const fleet_t *b)
+{
+	for (int i = 0; i < a->ship_cnt; i++) {
+		const ship_t *x = &a->ships[i];
+		const ship_t *y = &b->ships[i];
+		if (x->begin.row != y->begin.row || x->begin.col != y->begin.col
+			|| x->length != y->length || x->alignment != y->alignment) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * @brief derive the rules from the fleet of a game and keep a copy of it
+ * @param game the first game of the log
+ * @return 0 on success, -1 if the fleet follows no playable rules
+ */
+static int derive_rules(const game_t *game)
+{
+	clear_rules(&rules, game_log->header.map_size);
+	for (int i = 0; i < game->fleet.ship_cnt; i++) {
+		if (add_ships(&rules, game->fleet.ships[i].length, 1) < 0) {
+			return -1;
+		}
+	}
+	if (finish_rules(&rules) < 0 || init_fleet(&fleet, &rules) < 0) {
+		return -1;
+	}
+
+	// the game's fleet only lives until the next game is read
+	copy_fleet(&fleet, &game->fleet);
+	return 0;
+}
+
+/**
+ * @brief propose the rules of the log on a blocking connection
+ * @param fd the connected socket
+ * @return 0 if the server plays by the rules, -1 otherwise
+ */
+static int propose_rules(int fd)
+{
+	client_msg_t msgs[MAX_RULES_MSGS];
+	uint8_t buf[MAX_RULES_MSGS * REQUEST_LEN];
+	size_t len = encode_requests(msgs, encode_rules(&rules, msgs), buf);
+
+	server_msg_t response;
+	if (send(fd, buf, len, MSG_NOSIGNAL) < (ssize_t)len
+		|| recv(fd, &response, sizeof(response), MSG_WAITALL)
+			   < (ssize_t)sizeof(response)) {
+		fprintf(stderr, "%s: Could not propose rules\n", program_name);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return -1;
+	}
+	if (get_status(response) != game_ongoing) {
+		fprintf(stderr, "%s: Rules rejected by server\n", program_name);
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * @brief start the server on the fleet of the log
+ * @details the server exits by itself after the replayed number of games.
+ * Its standard output is kept in a temporary file to read its statistics
+ * from.
+ * @return 0 on success, -1 on failure
+ */
+static int start_server(void)
+{
+	char games[32];
+	char pool[32];
+	char rules_str[RULES_LINE_LEN];
+	snprintf(games, sizeof(games), "%lu", game_limit);
+	snprintf(pool, sizeof(pool), "%lu", connection_cnt);
+	format_rules(&rules, rules_str);
+
+	// the ships are passed as one argument each
+	char **args = malloc((10 + fleet.ship_cnt + 1) * sizeof(char *));
+	char *ships = malloc(fleet.ship_cnt * (SHIP_STR_LEN + 1));
+	if (args == NULL || ships == NULL) {
+		fprintf(stderr, "%s: Could not allocate arguments\n", program_name);
+		free(args);
+		free(ships);
+		return -1;
+	}
+
+	int n = 0;
+	args[n++] = (char *)server_path;
+	args[n++] = "-s";
+	args[n++] = "-p";
+	args[n++] = (char *)port;
+	args[n++] = "-g";
+	args[n++] = games;
+	args[n++] = "-c";
+	args[n++] = pool;
+	args[n++] = "-R";
+	args[n++] = rules_str;
+	for (int i = 0; i < fleet.ship_cnt; i++) {
+		args[n] = &ships[i * (SHIP_STR_LEN + 1)];
+		format_ship(&fleet.ships[i], args[n++]);
+	}
+	args[n] = NULL;
+
+	server_out = tmpfile();
+	if (server_out == NULL) {
+		fprintf(stderr, "%s: Could not create temporary file\n", program_name);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		free(args);
+		free(ships);
+		return -1;
+	}
+	fflush(stdout);
+
+	server_pid = fork();
+	if (server_pid < 0) {
+		fprintf(stderr, "%s: Could not start server\n", program_name);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		free(args);
+		free(ships);
+		return -1;
+	}
+
+	if (server_pid == 0) {
+		if (dup2(fileno(server_out), STDOUT_FILENO) < 0) {
+			_exit(EXIT_FAILURE);
+		}
+		execv(server_path, args);
+		fprintf(stderr, "%s: Could not execute %s\n", program_name, server_path);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		_exit(EXIT_FAILURE);
+	}
+
+	free(args);
+	free(ships);
+	return 0;
+}
+
+/**
+ * @brief wait for the started server to exit after the last game
+ * @return 0 if the server exited successfully, -1 otherwise
+ */
+static int stop_server(void)
+{
+	int status;
+	while (waitpid(server_pid, &status, 0) < 0) {
+		if (errno != EINTR) {
+			fprintf(stderr, "%s: Could not wait for server\n", program_name);
+			fprintf(stderr, "\t%s\n", strerror(errno));
+			return -1;
+		}
+	}
+	server_pid = -1;
+
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+		fprintf(stderr, "%s: Server failed\n", program_name);
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * @brief read the number of system calls the started server reported
+ * @return the number of system calls, 0 if none were reported
+ */
+static unsigned long long get_server_syscalls(void)
+{
+	unsigned long long n = 0;
+	char line[256];
+
+	rewind(server_out);
+	while (fgets(line, sizeof(line), server_out) != NULL) {
+		char *value = strstr(line, "Syscalls: ");
+		if (value != NULL) {
+			n = strtoull(value + strlen("Syscalls: "), NULL, 10);
+		}
+	}
+	return n;
+}
+
+/**
+ * @brief connect to the server and assign the first game to the connection
+ * @details connecting blocks and is retried while a started server is not
+ * listening yet. The connection is non-blocking afterwards.
+ * @param conn an unused connection
+ * @return 0 on success, -1 on failure
+ */
+static int open_connection(connection_t *conn)
+{
+	struct addrinfo hints;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = SOCK_STREAM;
+
+	struct addrinfo *ai;
+	int res = getaddrinfo(DEFAULT_HOST, port, &hints, &ai);
+	if (res != 0) {  // no errno
+		fprintf(stderr, "%s: Could not set parameters for socket", program_name);
+		fprintf(stderr, "\t%s\n", gai_strerror(res));
+		return -1;
+	}
+
+	for (int attempt = 0; attempt < CONNECT_RETRIES; attempt++) {
+		conn->fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+		if (conn->fd < 0) {
+			break;
+		}
+		if (connect(conn->fd, ai->ai_addr, ai->ai_addrlen) == 0) {
+			break;
+		}
+
+		int err = errno;
+		close(conn->fd);
+		conn->fd = -1;
+		errno = err;
+		if (server_pid == -1 || err != ECONNREFUSED) {
+			break;
+		}
+		usleep(CONNECT_DELAY);
+	}
+	freeaddrinfo(ai);
+
+	if (conn->fd < 0) {
+		fprintf(stderr, "%s: Could not connect\n", program_name);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return -1;
+	}
+
+	if (!same_rules(&rules, &classic_rules) && propose_rules(conn->fd) < 0) {
+		return -1;
+	}
+
+	int flags = fcntl(conn->fd, F_GETFL);
+	if (flags < 0 || fcntl(conn->fd, F_SETFL, flags | O_NONBLOCK) < 0
+		|| set_nodelay(conn->fd, true) < 0) {
+		fprintf(stderr, "%s: Could not set socket flags\n", program_name);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return -1;
+	}
+	init_sockbuf(&conn->io, conn->fd);
+	conn->corked = false;
+
+	start_recorded_game(conn);
+	// the server starts the first game of a connection by itself
+	conn->new_game = false;
+	return 0;
+}
+
+/**
+ * @brief assign the next recorded game to a connection
+ * @param conn the connection to replay the game on
+ */
+static void start_recorded_game(connection_t *conn)
+{
+	next_recorded_game(&conn->game);
+	started++;
+	conn->sent = 0;
+	conn->round = 0;
+	conn->new_game = true;
+}
+
+/**
+ * @brief send the next recorded shots of the game of a connection
+ * @details sends the next shot once the response to the previous one was
+ * received, or with -P as many shots as the socket buffer holds. The first
+ * shot of a game is sent together with the new game message. A pipelined
+ * game that does not fit into a single flush is sent through a corked
+ * socket, so it leaves in full segments.
+ * @param conn the connection to send the shots on
+ * @return 0 on success, -1 on failure
+ */
+static int send_shots(connection_t *conn)
+{
+	uint16_t window = pipeline ? conn->game.shot_cnt : conn->round + 1;
+	if (pipeline && conn->sent == 0 && !conn->corked
+		&& (conn->game.shot_cnt + 1) * REQUEST_LEN > SOCKBUF_LEN) {
+		if (COUNTED(set_cork(conn->fd, true)) < 0) {
+			fprintf(stderr, "%s: Could not cork socket\n", program_name);
+			return -1;
+		}
+		conn->corked = true;
+	}
+
+	while (conn->sent < window
+		   && get_sockbuf_space(&conn->io) >= 2 * REQUEST_LEN) {
+		uint16_t cell = get_shot(&conn->game, conn->sent).cell;
+		coordinate_t c = {.row = cell / rules.map_size,
+						  .col = cell % rules.map_size};
+
+		client_msg_t requests[2];
+		int n = 0;
+		if (conn->new_game) {
+			requests[n++] = get_control_msg(op_new_game);
+			conn->new_game = false;
+		}
+		requests[n++] = get_shot_msg(c);
+
+		uint8_t buf[2 * REQUEST_LEN];
+		write_sockbuf(&conn->io, buf, encode_requests(requests, n, buf));
+		conn->sent++;
+		shot_cnt++;
+	}
+
+	if (flush_sockbuf(&conn->io) < 0) {
+		fprintf(stderr, "%s: Could not send message\n", program_name);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return -1;
+	}
+
+	if (conn->corked && conn->sent == conn->game.shot_cnt) {
+		if (COUNTED(set_cork(conn->fd, false)) < 0) {
+			fprintf(stderr, "%s: Could not uncork socket\n", program_name);
+			return -1;
+		}
+		conn->corked = false;
+	}
+	return 0;
+}
+
+/**
+ * @brief receive the responses read from a connection, check them against
+ * the recording and continue with the next shots or game
+ * @param conn the readable connection
+ * @return 0 on success, -1 on failure
+ */
+static int recv_responses(connection_t *conn)
+{
+	ssize_t n = fill_sockbuf(&conn->io);
+	if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+		return 0;
+	}
+	if (n <= 0) {
+		fprintf(stderr, "%s: Connection lost\n", program_name);
+		if (n < 0) {
+			fprintf(stderr, "\t%s\n", strerror(errno));
+		}
+		return -1;
+	}
+
+	size_t len;
+	const uint8_t *buf = peek_sockbuf(&conn->io, &len);
+	server_msg_t responses[SOCKBUF_LEN];
+	decode_responses(buf, len / RESPONSE_LEN, responses);
+	consume_sockbuf(&conn->io, len);
+
+	for (size_t i = 0; i < len / RESPONSE_LEN; i++) {
+		server_msg_t response = responses[i];
+		if (conn->round == conn->sent) {
+			fprintf(stderr, "%s: Response without a shot\n", program_name);
+			return -1;
+		}
+
+		uint8_t recorded = get_shot(&conn->game, conn->round).msg;
+		conn->round++;
+		if (response != recorded) {
+			fprintf(stderr,
+					"%s: Response 0x%02x to shot %u differs from the "
+					"recorded 0x%02x\n",
+					program_name,
+					response,
+					conn->round,
+					recorded);
+			return -1;
+		}
+
+		if (get_status(response) != game_over) {
+			if (conn->round == conn->game.shot_cnt) {
+				fprintf(stderr, "%s: Recorded game ended early\n", program_name);
+				return -1;
+			}
+			continue;
+		}
+
+		finished++;
+		if (started == game_limit) {
+			close_connection(conn);
+			return 0;
+		}
+		start_recorded_game(conn);
+	}
+
+	return send_shots(conn);
+}
+
+/**
+ * @brief close the socket of a connection
+ * @param conn the connection to close
+ */
+static void close_connection(connection_t *conn)
+{
+	if (conn->fd != -1) {
+		close(conn->fd);
+		conn->fd = -1;
+	}
+}
+
+/**
+ * @brief print the throughput of the replay to stdout
+ * @param elapsed the duration of the replay in seconds
+ */
+static void print_results(double elapsed)
+{
+	printf("elapsed:      %.3f s\n", elapsed);
+	printf("shots/s:      %.0f\n", elapsed > 0 ? shot_cnt / elapsed : 0.0);
+	printf("games/s:      %.0f\n", elapsed > 0 ? finished / elapsed : 0.0);
+}
+
+/**
+ * @brief get the CPU time used so far
+ * @param who RUSAGE_SELF or RUSAGE_CHILDREN
+ * @return user and system time in seconds
+ */
+static double get_cpu_time(int who)
+{
+	struct rusage usage;
+	if (getrusage(who, &usage) < 0) {
+		return 0;
+	}
+	return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6
+		   + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+}
+
+/**
+ * @brief close all connections, stop a started server and free the log
+ */
+static void cleanup(void)
+{
+	if (connections != NULL) {
+		for (unsigned long i = 0; i < connection_cnt; i++) {
+			close_connection(&connections[i]);
+		}
+	}
+	free(connections);
+	connections = NULL;
+	free(fds);
+	fds = NULL;
+
+	if (server_pid != -1) {
+		kill(server_pid, SIGTERM);
+		waitpid(server_pid, NULL, 0);
+		server_pid = -1;
+	}
+
+	if (server_out != NULL) {
+		fclose(server_out);
+		server_out = NULL;
+	}
+
+	close_gamelog(game_log);
+	game_log = NULL;
+	free_fleet(&fleet);
+}
@@ -0,0 +1,46 @@
+/**
+ * @file rng.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-21
+ *
+ * @brief A small seedable pseudo random number generator (xoshiro256**).
+ */
+#include "../include/rng.h"
+
+static inline uint64_t rotl(uint64_t x, int k)
+{
+	return (x << k) | (x >> (64 - k));
+}
+
+void seed_rng(rng_t *rng, uint64_t seed)
+{
+	for (int i = 0; i < 4; i++) {
+		// splitmix64
+		uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+		rng->s[i] = z ^ (z >> 31);
+	}
+}
+
+uint64_t next_random(rng_t *rng)
+{
+	uint64_t *s = rng->s;
+	uint64_t result = rotl(s[1] * 5, 7) * 9;
+	uint64_t t = s[1] << 17;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = rotl(s[3], 45);
+
+	return result;
+}
+
+uint32_t random_below(rng_t *rng, uint32_t bound)
+{
+	// multiply-shift range reduction, the bias is negligible for small bounds
+	return (uint32_t)(((next_random(rng) >> 32) * bound) >> 32);
+}
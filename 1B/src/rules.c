@@ -0,0 +1,177 @@
+/**
+ * @file rules.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Rule sets of OSUE exercise 1B `Battleship'.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include "../include/rules.h"
+
+const rules_t classic_rules = {.map_size = 10,
+							   .min_ship_len = 2,
+							   .max_ship_len = 4,
+							   .ship_cnt = 6,
+							   .max_rounds = 80,
+							   .ship_counts = {[2] = 2, [3] = 3, [4] = 1}};
+
+static int parse_number(const char **str, unsigned long max, unsigned long *n);
+static int get_class_cnt(const rules_t *rules);
+
+void clear_rules(rules_t *rules, uint8_t map_size)
+{
+	memset(rules, 0, sizeof(rules_t));
+	rules->map_size = map_size;
+}
+
+int add_ships(rules_t *rules, uint8_t length, uint16_t count)
+{
+	if (length < MIN_SHIP_LEN || length > rules->map_size
+		|| count > UINT16_MAX - rules->ship_counts[length]) {
+		return -1;
+	}
+	rules->ship_counts[length] += count;
+	return 0;
+}
+
+int finish_rules(rules_t *rules)
+{
+	unsigned long squares = 0;
+	unsigned long ships = 0;
+	rules->min_ship_len = 0;
+	rules->max_ship_len = 0;
+
+	for (int length = MIN_SHIP_LEN; length <= rules->map_size; length++) {
+		uint16_t count = rules->ship_counts[length];
+		if (count == 0) {
+			continue;
+		}
+		if (rules->min_ship_len == 0) {
+			rules->min_ship_len = length;
+		}
+		rules->max_ship_len = length;
+		ships += count;
+		squares += (unsigned long)count * length;
+	}
+
+	if (ships == 0 || squares > (unsigned long)rules->map_size * rules->map_size
+		|| get_class_cnt(rules) > MAX_SHIP_CLASSES) {
+		return -1;
+	}
+
+	rules->ship_cnt = ships;
+	rules->max_rounds = rules->map_size * rules->map_size * 4 / 5;
+	if (rules->max_rounds < squares) {
+		rules->max_rounds = rules->map_size * rules->map_size;
+	}
+	return 0;
+}
+
+int parse_rules(const char *str, rules_t *rules)
+{
+	unsigned long size;
+	if (parse_number(&str, MAX_MAP_SIZE, &size) < 0 || *str++ != ':') {
+		return -1;
+	}
+	clear_rules(rules, size);
+
+	while (true) {
+		unsigned long count;
+		unsigned long length;
+		if (parse_number(&str, UINT16_MAX, &count) < 0 || *str++ != 'x'
+			|| parse_number(&str, size, &length) < 0
+			|| add_ships(rules, length, count) < 0) {
+			return -1;
+		}
+
+		if (*str == '\0') {
+			break;
+		}
+		if (*str++ != ',') {
+			return -1;
+		}
+	}
+
+	return finish_rules(rules);
+}
+
+void format_rules(const rules_t *rules, char *buf)
+{
+	int n = sprintf(buf, "%u:", rules->map_size);
+	for (int length = rules->min_ship_len; length <= rules->max_ship_len;
+		 length++) {
+		if (rules->ship_counts[length] > 0) {
+			n += sprintf(buf + n,
+						 "%s%ux%d",
+						 buf[n - 1] == ':' ? "" : ",",
+						 rules->ship_counts[length],
+						 length);
+		}
+	}
+}
+
+bool same_rules(const rules_t *a, const rules_t *b)
+{
+	return a->map_size == b->map_size
+		   && memcmp(a->ship_counts, b->ship_counts, sizeof(a->ship_counts))
+				  == 0;
+}
+
+int encode_rules(const rules_t *rules, client_msg_t *msgs)
+{
+	int n = 1;
+	for (int length = rules->min_ship_len; length <= rules->max_ship_len;
+		 length++) {
+		uint16_t count = rules->ship_counts[length];
+		while (count > 0) {
+			uint16_t part = count < MAX_CLASS_SHIPS ? count : MAX_CLASS_SHIPS;
+			msgs[n++] = get_param_msg(op_ships, length, part);
+			count -= part;
+		}
+	}
+
+	msgs[0] = get_param_msg(op_rules, rules->map_size, n - 1);
+	return n;
+}
+
+/**
+ * @brief parse a positive decimal number and advance the string past it
+ * @param str the string to parse, advanced past the number on success
+ * @param max the largest accepted number
+ * @param n the parsed number is stored into this parameter
+ * @return 0 on success, -1 if there is no number or it is out of range
+ */
+static int parse_number(const char **str, unsigned long max, unsigned long *n)
+{
+	if (**str < '0' || **str > '9') {
+		return -1;
+	}
+
+	char *end;
+	errno = 0;
+	*n = strtoul(*str, &end, 10);
+	if (errno != 0 || *n == 0 || *n > max) {
+		return -1;
+	}
+	*str = end;
+	return 0;
+}
+
+/**
+ * @brief count the ships messages needed to propose a rule set
+ * @param rules the rule set
+ * @return the number of ships messages
+ */
+static int get_class_cnt(const rules_t *rules)
+{
+	int n = 0;
+	for (int length = MIN_SHIP_LEN; length <= rules->map_size; length++) {
+		n += (rules->ship_counts[length] + MAX_CLASS_SHIPS - 1)
+			 / MAX_CLASS_SHIPS;
+	}
+	return n;
+}
@@ -26,6 +26,12 @@
 // Sockets, TCP, ... :
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/epoll.h>
+#include <poll.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+#include <dirent.h>
 #include <netdb.h>
 #include <fcntl.h>
 
@@ -34,28 +40,172 @@
 #include "../include/ship.h"
 #include "../include/map.h"
 #include "../include/msg.h"
+#include "../include/codec.h"
+#include "../include/sockbuf.h"
+#include "../include/fleet.h"
+#include "../include/rng.h"
+#include "../include/channel.h"
+#include "../include/trace.h"
+#include "../include/gamelog.h"
+#include "../include/rules.h"
+#include "../include/timerwheel.h"
+#include "../include/metrics.h"
+#include "../include/session.h"
+#include "../include/server_uring.h"
+#include "../include/corpus.h"
+
+// maximum number of events handled per call of epoll_wait
+#define MAX_EVENTS 64
+// default number of preallocated sessions
+#define DEFAULT_SESSIONS 1024
+// maximum number of requests read from a connection at once
+#define READ_BATCH (SOCKBUF_LEN / REQUEST_LEN)
+// length of a tick of the timer wheel in milliseconds
+#define WHEEL_TICK_MS 64
+// default time in milliseconds to complete a started request
+#define DEFAULT_READ_DEADLINE 2000
+// default time in milliseconds a connection may wait between requests
+#define DEFAULT_IDLE_TIMEOUT 60000
+// time in milliseconds between two writes of the metrics file
+#define METRICS_INTERVAL 1000
+// restarts of random_fleet() for proposed rules before they are rejected
+#define NEGOTIATION_ATTEMPTS 4096
+// maximum time in milliseconds to send the last responses when exiting
+#define DRAIN_TIMEOUT 1000
+
+// count a system call of the event loop for the statistics
+#define COUNTED(call) (syscall_cnt++, (call))
 
 // Static variables for things you might want to access from several functions:
 static const char *port = DEFAULT_PORT;  // the port to bind to
+static const char *shm_name = NULL;		 // the shared memory channel to serve
+static const char *unix_path = NULL;	 // the Unix domain socket to bind to
+static const char *trace_path = NULL;	// the trace file to record into
+static const char *log_path = NULL;		 // the game log to append to
+static const char *metrics_path = NULL;  // the metrics file to rewrite
+static uint32_t session_cnt = 0;		 // number of sessions ever started
+static unsigned long session_limit = DEFAULT_SESSIONS;  // size of the pool
+static unsigned long game_limit = 1;	 // games to play before exiting, 0 = no
+										 // limit
+static unsigned long games_finished = 0;
+static unsigned long read_deadline = DEFAULT_READ_DEADLINE;  // in ms, 0 = no
+															  // deadline
+static unsigned long idle_timeout = DEFAULT_IDLE_TIMEOUT;  // in ms, 0 = no
+														   // timeout
+static bool print_stats = false;	 // print statistics when exiting
+static bool use_uring = false;		 // serve connections through io_uring
+static unsigned long long request_cnt = 0;  // requests handled
+static unsigned long long syscall_cnt = 0;  // system calls of the event loop
+static metrics_t metrics;			  // the live metrics, see metrics.h
+static uint64_t metrics_time = 0;	 // time the metrics were written in ns
+static uint64_t metrics_shots = 0;	// shots when the metrics were written
 
 // Static variables for resources that should be freed before exiting:
 static struct addrinfo *ai = NULL;  // stores address information
 static int sock_fd = -1;			// socket file descriptor
-static int conn_fd = -1;			// connection file descriptor
+static int epoll_fd = -1;			// epoll instance of the event loop
+static session_t *sessions = NULL;  // all open sessions
+static session_t *pool = NULL;		// all preallocated sessions
+static session_t *free_sessions = NULL;  // the unused sessions of the pool
+static bool accepting = true;  // the listening socket is watched by epoll
+static timerwheel_t wheel;	 // the timeouts of all open sessions
+static channel_t *channel = NULL;   // the shared memory channel
+static FILE *game_log = NULL;		// the log of finished games
+static bool unix_bound = false;		// the socket file at unix_path exists
 
 static char *program_name;
-static map_t *map = NULL;
+static rules_t rules;  // the rules of the games not negotiated otherwise
+static fleet_t fleet;  // the fleet every game by these rules is played on
+static bool random_fleets = false;  // every game gets a random fleet
+static placements_t rules_placements;  // placements of the server's rules,
+									   // if random_fleets is set
+static rng_t rng;					// generates the random fleets
+static placements_t placements;		// placements of the last accepted
+									// proposal, if any
+static rules_t placements_rules;	// the rules of these placements
+static const char *corpus_path = NULL;  // the file of fleets to play on
+static bool corpus_random = false;	 // pick the fleets of the file at random
+static corpus_t corpus;				 // the fleets of the file, if any
+static size_t corpus_next = 0;		 // the fleet to play on next
 
 static int parse_args(int argc, char *argv[]);
 static void print_usage(void);
 
-static int recv_msg(client_msg_t *msg);
-static int send_msg(server_msg_t msg);
+static int bind_inet_socket(void);
+static int bind_unix_socket(void);
+static int serve_channel(void);
+static int create_pool(void);
+static int fit_fd_limit(void);
+static long count_open_fds(void);
+static int set_session_rules(session_t *session, const rules_t *new_rules);
+static void free_session(session_t *session);
+static int init_session(session_t *session, int fd, channel_t *channel);
+static void start_game(session_t *session);
+static void assign_fleet(session_t *session);
+static int set_placements(const rules_t *new_rules);
+static int set_accepting(bool enable);
+static int accept_sessions(void);
+static session_t *open_session(int fd);
+static int handle_readable(session_t *session);
+static int handle_writable(session_t *session);
+static int watch_session(session_t *session, uint32_t events);
+static int handle_eof(session_t *session);
+static int handle_buffered(session_t *session);
+static void arm_session(session_t *session);
+static void expire_sessions(void);
+static int get_wait_time(void);
+static void publish_metrics(void);
+static void record_rounds(session_t *session,
+						  uint64_t read_time,
+						  uint64_t shots);
+static int handle_requests(session_t *session,
+						   const uint8_t *buf,
+						   size_t n);
+static int handle_request(session_t *session, client_msg_t request);
+static int handle_checked(session_t *session, client_msg_t request);
+static int handle_parity_error(session_t *session, client_msg_t request);
+static int handle_proposal(session_t *session, client_msg_t request);
+static bool can_open_session(void);
+static void close_session(session_t *session);
+static void release_session(session_t *session);
+static void start_serving(void);
+static void tick_server(void);
+static void finish_game(int status);
+static int respond(session_t *session, coordinate_t c, server_msg_t msg);
+
+static int send_msg(session_t *session, server_msg_t msg);
+static int flush_socket(session_t *session);
+static void close_socket(session_t *session);
+static void resume_accepting(void);
+static void drain_sockets(session_t *open_sessions, int timeout);
+static int set_nonblocking(int fd);
 
 static void print_err(char *msg);
+static void print_statistics(void);
 static void exit_cleanup();
 static void signal_cleanup(int signo);
 
+// the functions the io_uring loop reports to, the epoll loop calls them
+// directly
+static const session_callbacks_t callbacks = {
+	.open = open_session,
+	.can_open = can_open_session,
+	.handle_buffered = handle_buffered,
+	.handle_eof = handle_eof,
+	.close = close_session,
+	.release = release_session,
+	.tick = tick_server,
+	.get_wait_time = get_wait_time,
+	.finish_game = finish_game,
+	.print_err = print_err,
+	.syscalls = &syscall_cnt};
+
+// the sockets are served by epoll, unless io_uring was set up
+static const event_loop_t epoll_loop = {.flush = flush_socket,
+										.close = close_socket,
+										.resume = resume_accepting,
+										.drain = drain_sockets};
+static const event_loop_t *loop = &epoll_loop;
 
 int main(int argc, char *argv[])
 {
@@ -75,9 +225,6 @@ int main(int argc, char *argv[])
 		return EXIT_FAILURE;
 	}
 
-	debug_print("%s\n", "Creating map");
-	map = get_map();
-
 	debug_print("%s\n", "Parsing arguments");
 	if (parse_args(argc, argv) < 0) {
 		print_usage();
@@ -85,6 +232,117 @@ int main(int argc, char *argv[])
 	}
 
 
+	if (trace_path != NULL) {
+		debug_print("Opening trace file %s\n", trace_path);
+		if (open_trace(trace_path) < 0) {
+			print_err("Could not open trace file");
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (log_path != NULL) {
+		debug_print("Opening game log %s\n", log_path);
+		game_log = create_gamelog(log_path, &rules);
+		if (game_log == NULL) {
+			print_err("Could not open game log");
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (shm_name != NULL) {
+		return serve_channel();
+	}
+
+	if (unix_path != NULL) {
+		if (bind_unix_socket() < 0) {
+			return EXIT_FAILURE;
+		}
+	} else if (bind_inet_socket() < 0) {
+		return EXIT_FAILURE;
+	}
+
+	debug_print("%s\n", "Listening on socket");
+	if (listen(sock_fd, SOMAXCONN) < 0 || set_nonblocking(sock_fd) < 0) {
+		print_err("Could listen on socket");
+		return EXIT_FAILURE;
+	}
+
+	debug_print("%s\n", "Creating session pool");
+	if (create_pool() < 0) {
+		print_err("Could not create session pool");
+		return EXIT_FAILURE;
+	}
+
+	if (use_uring) {
+		debug_print("%s\n", "Setting up io_uring");
+		if (init_uring_loop(sock_fd, &callbacks) == 0) {
+			debug_print("%s\n", "Starting io_uring event loop");
+			loop = &uring_loop;
+			start_serving();
+			run_uring_loop();
+			return EXIT_FAILURE;
+		}
+		print_err("Could not set up io_uring, falling back to epoll");
+		free_uring_loop();
+	}
+
+	debug_print("%s\n", "Creating epoll instance");
+	epoll_fd = epoll_create1(0);
+	if (epoll_fd < 0) {
+		print_err("Could not create epoll instance");
+		return EXIT_FAILURE;
+	}
+
+	// the listening socket is the only one registered without a session
+	struct epoll_event event = {.events = EPOLLIN, .data.ptr = NULL};
+	if (COUNTED(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, sock_fd, &event)) < 0) {
+		print_err("Could not register socket");
+		return EXIT_FAILURE;
+	}
+
+	debug_print("%s\n", "Starting event loop");
+	start_serving();
+	struct epoll_event events[MAX_EVENTS];
+	while (true) {
+		int n = COUNTED(
+			epoll_wait(epoll_fd, events, MAX_EVENTS, get_wait_time()));
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			print_err("Could not wait for events");
+			return EXIT_FAILURE;
+		}
+
+		for (int i = 0; i < n; i++) {
+			session_t *session = events[i].data.ptr;
+
+			if (session == NULL) {
+				if (accept_sessions() < 0) {
+					print_err("Could accept connections");
+					return EXIT_FAILURE;
+				}
+				continue;
+			}
+
+			int res = events[i].events & EPOLLOUT ? handle_writable(session)
+												   : handle_readable(session);
+			if (res < 0) {
+				close_session(session);
+			}
+		}
+		tick_server();
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief create a TCP socket bound to the port on all interfaces
+ * @return 0 on success, -1 on failure
+ */
+static int bind_inet_socket(void)
+{
 	struct addrinfo hints;
 	memset(&hints, 0, sizeof(hints));
 	hints.ai_family = AF_INET;
@@ -97,258 +355,1509 @@ int main(int argc, char *argv[])
 		fprintf(
 			stderr, "%s: Could not set parameters for socket", program_name);
 		fprintf(stderr, "\t%s\n", gai_strerror(res));
-		return EXIT_FAILURE;
+		return -1;
 	}
 
 	debug_print("%s\n", "Creating socket");
 	sock_fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
 	if (sock_fd < 0) {
 		print_err("Could not create socket");
-		return EXIT_FAILURE;
+		return -1;
 	}
 
 	debug_print("%s\n", "Setting socket options");
 	int val = 1;
 	if (setsockopt(sock_fd, SOL_SOCKET, SO_REUSEADDR, &val, sizeof val) < 0) {
 		print_err("Could set options for socket");
-		return EXIT_FAILURE;
+		return -1;
 	}
 
 	debug_print("%s\n", "Binding socket");
 	if (bind(sock_fd, ai->ai_addr, ai->ai_addrlen) < 0) {
 		print_err("Could bind socket");
-		return EXIT_FAILURE;
+		return -1;
 	}
 
-	debug_print("%s\n", "Listening on socket");
-	if (listen(sock_fd, 1) < 0) {
-		print_err("Could listen on socket");
-		return EXIT_FAILURE;
+	return 0;
+}
+
+/**
+ * @brief create a Unix domain stream socket bound to the path
+ * @details a stale socket file left behind at the path is replaced.
+ * @return 0 on success, -1 on failure
+ */
+static int bind_unix_socket(void)
+{
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(unix_path) >= sizeof(addr.sun_path)) {
+		fprintf(stderr, "%s: Socket path too long\n", program_name);
+		return -1;
+	}
+	strcpy(addr.sun_path, unix_path);
+
+	debug_print("%s\n", "Creating socket");
+	sock_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (sock_fd < 0) {
+		print_err("Could not create socket");
+		return -1;
+	}
+
+	debug_print("%s\n", "Binding socket");
+	struct stat st;
+	if (stat(unix_path, &st) == 0 && S_ISSOCK(st.st_mode)) {
+		unlink(unix_path);
+	}
+	if (bind(sock_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		print_err("Could bind socket");
+		return -1;
 	}
+	unix_bound = true;
+
+	return 0;
+}
 
-	debug_print("%s\n", "Accepting connections");
-	conn_fd = accept(sock_fd, NULL, NULL);
-	if (conn_fd < 0) {
-		print_err("Could accept connections");
+/**
+ * @brief serve the clients of the shared memory channel one after another
+ * @details a client that sent no request within the idle timeout, or whose
+ * process died, is detached like one that closed its connection.
+ * @return the exit code of the program, if it does not exit by the game limit
+ */
+static int serve_channel(void)
+{
+	debug_print("Creating shared memory channel %s\n", shm_name);
+	channel = create_channel(shm_name);
+	if (channel == NULL) {
+		print_err("Could not create shared memory channel");
 		return EXIT_FAILURE;
 	}
 
-	debug_print("%s\n", "Starting event loop");
-	for (uint8_t round = 0; round < MAX_ROUNDS; round++) {
-		client_msg_t request = 0;
-		// receive
-		debug_print("%s\n", "Receiving message");
-		if (recv_msg(&request) < 0) {
-			print_err("Could receive message on socket");
+	// the wait for the first request of a client is not limited
+	int timeout = idle_timeout > 0 ? (int)idle_timeout : -1;
+	session_t session;
+	memset(&session, 0, sizeof(session));
+	while (true) {
+		if (init_session(&session, -1, channel) < 0) {
+			print_err("Could not allocate session");
 			return EXIT_FAILURE;
 		}
 
-		debug_print("%s\n", "Checking parity");
-		if (!check_parity(request)) {
-			if (send_msg(err_parity) < 0) {
-				print_err("Could send error message on socket");
+		client_msg_t request;
+		bool failed = false;
+		bool attached = false;
+		while (recv_request(channel, &request, attached ? timeout : -1) == 0) {
+			if (!attached) {
+				trace_record(trace_connect,
+							 session.id,
+							 0,
+							 invalid_coordinate,
+							 0);
+				attached = true;
 			}
-			fprintf(stderr, "%s: Parity error\n", program_name);
-			return EXIT_PARITY_ERR;
-		}
-
-		const coordinate_t coordinate = get_coordinates(request);
-
-
-		debug_print("%s\n", "Checking coordinates");
-		if (!check_coordinate(coordinate)) {
-			if (send_msg(err_coordinate) < 0) {
-				print_err("Could send error message on socket");
+			if (!failed && handle_request(&session, request) < 0) {
+				// ignore everything until the client detaches
+				failed = true;
 			}
-			fprintf(stderr, "%s: Invalid coordinate\n", program_name);
-			return EXIT_COORDINATE_ERR;
 		}
 
-		debug_print(
-			"coordinates: row=%d col=%d\n", coordinate.row, coordinate.col);
+		bool timed_out = errno == ETIMEDOUT;
+		if (timed_out) {
+			metrics.timeouts++;
+		}
+		if (!failed && session.playing) {
+			fprintf(stderr,
+					timed_out ? "%s: Connection timed out\n"
+							  : "%s: Connection closed by client\n",
+					program_name);
+			finish_game(EXIT_FAILURE);
+		}
 
-		debug_print("%s\n", "Shooting at coordinates");
-		hit_report_t report = shoot(map, coordinate);
+		debug_print("%s\n", "Client detached");
+		trace_record(
+			trace_close, session.id, session.round, invalid_coordinate, 0);
+		reset_channel(channel);
+	}
+}
 
-		if (DEBUG) {
-			print_map(map);
-		}
+/**
+ * @brief allocate all sessions at once and put them into the free list
+ * @details connections beyond the pool wait in the listen backlog, so no
+ * memory is allocated while serving games by the server's rules. Sessions
+ * negotiating other rules reallocate their storage.
+ * @return 0 on success, -1 on failure
+ */
+static int create_pool(void)
+{
+	if (fit_fd_limit() < 0) {
+		return -1;
+	}
 
-		switch (report) {
-			case report_no_hit:
-				// fallthrough
-			case report_hit:
-				// fallthrough
-			case report_sunk:
-				debug_print("%s\n", "Sending shot report");
-				if (send_msg(game_ongoing | report) < 0) {
-					print_err("Could send message on socket");
-					return EXIT_FAILURE;
-				}
-				break;
-			case report_last_sunk:
-				debug_print("%s\n", "Last ship sunk");
-				if (send_msg(game_over | report) < 0) {
-					print_err("Could send message on socket");
-					return EXIT_FAILURE;
-				}
+	pool = (session_t *)calloc(session_limit, sizeof(session_t));
+	if (pool == NULL) {
+		return -1;
+	}
 
-				printf("%s: Rounds: %d\n", program_name, round);
-				return EXIT_SUCCESS;
-				break;
+	for (unsigned long i = 0; i < session_limit; i++) {
+		if (set_session_rules(&pool[i], &rules) < 0) {
+			return -1;
 		}
+		init_timeout(&pool[i].timeout, &pool[i]);
+		pool[i].next = free_sessions;
+		free_sessions = &pool[i];
 	}
-	// loop exit
-	debug_print("%s\n", "Loop exited");
-	if (send_msg(game_over) < 0) {
-		print_err("Could send error message on socket");
-		return EXIT_FAILURE;
-	}
-	printf("%s: Game lost\n", program_name);
-	return EXIT_SUCCESS;
+	return 0;
 }
 
 /**
- * @brief Print the usage message to stdout
+ * @brief limit the pool to the file descriptors left for connections
+ * @details the descriptors open already and the one of the event loop are
+ * kept, every session needs one more. Called once the listening socket is
+ * open.
+ * @return 0 on success, -1 with errno set to EMFILE if no descriptor is left
+ * for a connection
  */
-static void print_usage(void)
+static int fit_fd_limit(void)
 {
+	struct rlimit limit;
+	long open_fds = count_open_fds();
+	if (getrlimit(RLIMIT_NOFILE, &limit) < 0 || limit.rlim_cur == RLIM_INFINITY
+		|| open_fds < 0) {
+		return 0;
+	}
 
-	printf("\nUsage:\n");
-	printf("\tserver [-p PORT] SHIPS...\n");
-	printf("\n\t-p\tthe port to listen on. Defaults to %s\n", DEFAULT_PORT);
-	printf(
-		"\n\tships\ta list of 6 coordinate pairs, each denoting the begin and "
-		"end of a ship. None of the ships are allowed to touch each other.\n");
-	printf("\nexample:\n");
-	printf("\tserver -p 1280 C2E2 F0H0 B6A6 E8E6 I2I5 H8I8\n");
+	// the epoll or io_uring instance of the event loop
+	rlim_t used = (rlim_t)open_fds + 1;
+	if (limit.rlim_cur <= used) {
+		errno = EMFILE;
+		return -1;
+	}
+	if (session_limit > limit.rlim_cur - used) {
+		session_limit = limit.rlim_cur - used;
+		fprintf(stderr,
+				"%s: Limiting connections to %lu by the file descriptor "
+				"limit\n",
+				program_name,
+				session_limit);
+	}
+	return 0;
 }
 
 /**
- * @brief Parses the program command line options
- * @details Returns 0 if all parameters were parsed correctly.
- * -1 is returned when one of the following conditions is violated:
- * 	- Any two ships touch each other
- * 	- Any coordinate is not within the map
- * 	- The amount of ships deviates from the expected number
- * 	- The amount for any ship type deviate from the expected number
- * 	- wrong/unknown/unexpected arguments are specified
- * @param argc the argument counter, length of argv
- * @param argv an array of arguments
- * @return 0 on success, -1 on failure
+ * @brief count the open file descriptors of the process
+ * @return the number of descriptors, -1 if they cannot be listed
  */
-static int parse_args(int argc, char *argv[])
+static long count_open_fds(void)
 {
-	program_name = argv[0];
-
-	int arg_c;
-	while ((arg_c = getopt(argc, argv, "p:")) != EOF) {
-		switch (arg_c) {
-			case 'p':
-				port = optarg;
-				break;
-			default:
-				return -1;
+	DIR *dir = opendir("/proc/self/fd");
+	if (dir == NULL) {
+		return -1;
+	}
+	long cnt = 0;
+	struct dirent *entry;
+	while ((entry = readdir(dir)) != NULL) {
+		if (entry->d_name[0] != '.') {
+			cnt++;
 		}
 	}
+	closedir(dir);
+	// the descriptor of the directory itself was listed too
+	return cnt - 1;
+}
 
-	// parse remaining arguments aka ships
-	if ((argc - optind) != SHIP_CNT_TOTAL) {
-		return -1;
+/**
+ * @brief size the fleet, map and shots of a session for a rule set
+ * @details does nothing if the session already plays by these rules, its
+ * storage stays untouched if allocating fails.
+ * @param session the session to update
+ * @param new_rules the rules of the session's next games
+ * @return 0 on success, -1 if allocating failed
+ */
+static int set_session_rules(session_t *session, const rules_t *new_rules)
+{
+	if (session->map != NULL && same_rules(&session->rules, new_rules)) {
+		return 0;
 	}
 
-	for (int i = optind; i < argc; i++) {
-
-		ship_t *new_ship = parse_coordinates(argv[i]);
-		if (new_ship == NULL) {
-			return -1;
-		}
-		add_ship(map, new_ship);
+	fleet_t new_fleet;
+	if (init_fleet(&new_fleet, new_rules) < 0) {
+		return -1;
 	}
-
-	if (!check_ship_count(map)) {
+	map_t *map = get_map(new_rules);
+	shot_t *shots = malloc(new_rules->max_rounds * sizeof(shot_t));
+	if (map == NULL || shots == NULL) {
+		free_fleet(&new_fleet);
+		free_map(map);
+		free(shots);
 		return -1;
 	}
 
-	if (!check_ship_touch(map)) {
+	free_session(session);
+	session->rules = *new_rules;
+	session->fleet = new_fleet;
+	session->map = map;
+	session->shots = shots;
+	return 0;
+}
+
+/**
+ * @brief free the fleet, map and shots of a session
+ * @param session the session to free, its storage may be unallocated
+ */
+static void free_session(session_t *session)
+{
+	free_fleet(&session->fleet);
+	free_map(session->map);
+	session->map = NULL;
+	free(session->shots);
+	session->shots = NULL;
+}
+
+/**
+ * @brief prepare a session for a new connection and its first game by the
+ * server's rules
+ * @param session the session to initialize
+ * @param fd the connection's socket, -1 for a channel
+ * @param channel the shared memory channel, NULL for a socket
+ * @return 0 on success, -1 if the session's storage could not be restored
+ * to the server's rules
+ */
+static int init_session(session_t *session, int fd, channel_t *channel)
+{
+	if (set_session_rules(session, &rules) < 0) {
 		return -1;
 	}
 
+	session->id = session_cnt++;
+	session->fd = fd;
+	session->channel = channel;
+	init_sockbuf(&session->io, fd);
+	session->writing = false;
+	session->classes_left = 0;
+	session->responded = 0;
+	session->sending = 0;
+	session->pending = 0;
+	session->receiving = false;
+	session->closing = false;
+	session->close_queued = false;
+
+	assign_fleet(session);
+	start_game(session);
 	return 0;
 }
 
 /**
- * @brief print to stderr, but prepand the program name
- * @param msg the text to print
+ * @brief place the session's fleet on its map and start a game
+ * @details the first game of a connection and the first game by newly
+ * negotiated rules start without a new game message.
+ * @param session the session to start the game on
  */
-static void print_err(char *msg)
+static void start_game(session_t *session)
 {
-	fprintf(stderr, "%s: %s\n", program_name, msg);
-	fprintf(stderr, "\t%s\n", strerror(errno));
+	// the map points into the session's own fleet
+	clear_map(session->map);
+	place_fleet(session->map, &session->fleet);
+	session->playing = true;
+	session->round = 0;
+	metrics.games_started++;
 }
 
 /**
- * @brief receive a message on the socket
- * @details reads a message in little endian byte order from the socket.
- * @param msg the message is stored into this parameter
- * @return 0 if the read succeeded, -1 otherwise
+ * @brief put the fleet of the next game by the server's rules into a session
+ * @details with a file of fleets every game gets the next fleet of the file,
+ * or a random one. With random fleets every game gets a new one, drawn with
+ * a bounded number of attempts and the fleet drawn at start as fallback.
+ * Otherwise every game is played on the fleet of the arguments.
+ * @param session the session playing by the server's rules
  */
-static int recv_msg(client_msg_t *msg)
+static void assign_fleet(session_t *session)
 {
-	*msg = 0;
-	uint8_t buf[sizeof(client_msg_t)];
-	if (recv(conn_fd, buf, sizeof(client_msg_t), MSG_WAITALL) < 0) {
-		return -1;
+	if (corpus.fleet_cnt == 0) {
+		if (!random_fleets
+			|| random_fleet(&session->fleet,
+							&rules,
+							&rules_placements,
+							NEGOTIATION_ATTEMPTS,
+							&rng)
+				   < 0) {
+			copy_fleet(&session->fleet, &fleet);
+		}
+		return;
+	}
+
+	size_t i;
+	if (corpus_random) {
+		i = random_below(&rng, corpus.fleet_cnt);
+	} else {
+		i = corpus_next;
+		corpus_next = (corpus_next + 1) % corpus.fleet_cnt;
 	}
+	get_corpus_fleet(&corpus, i, &session->fleet);
+}
 
-	for (int i = 0; i < sizeof(client_msg_t); i++) {
-		*msg |= (client_msg_t)buf[i] << 8 * i;
+/**
+ * @brief compute the placements random fleets by a rule set are drawn from
+ * @details does nothing if the placements already belong to these rules, so
+ * clients proposing the same rules share them.
+ * @param new_rules the rules to draw random fleets by
+ * @return 0 on success, -1 if allocating failed
+ */
+static int set_placements(const rules_t *new_rules)
+{
+	if (placements.placements != NULL
+		&& same_rules(&placements_rules, new_rules)) {
+		return 0;
 	}
 
-	debug_print("Received message %04x\n", *msg);
+	placements_t new_placements;
+	if (init_placements(&new_placements, new_rules) < 0) {
+		return -1;
+	}
+	free_placements(&placements);
+	placements = new_placements;
+	placements_rules = *new_rules;
 	return 0;
 }
 
 /**
- * @brief send a message on the socket
- * @details sends a message in little endian byte order over the socket.
- * @param msg the message to be send
- * @return 0 if sending succeeded, -1 otherwise
+ * @brief start or stop watching the listening socket for new connections
+ * @param enable true to accept connections, false to leave them in the backlog
+ * @return 0 on success, -1 on failure
  */
-static int send_msg(server_msg_t msg)
+static int set_accepting(bool enable)
 {
-	debug_print("Sending message %04x\n", msg);
-	uint8_t buf[sizeof(server_msg_t)];
-	for (int i = 0; i < sizeof(server_msg_t); i++) {
-		buf[i] = msg >> 8 * i;
-	}
-	if (send(conn_fd, buf, sizeof(server_msg_t), 0) < 0) {
+	struct epoll_event event = {.events = enable ? EPOLLIN : 0,
+								.data.ptr = NULL};
+	if (COUNTED(epoll_ctl(epoll_fd, EPOLL_CTL_MOD, sock_fd, &event)) < 0) {
 		return -1;
 	}
+	accepting = enable;
 	return 0;
 }
 
 /**
- * @brief free all dependencies and exit with the specified exit code
- * @param exit_code the exit code to exit with
+ * @brief accept all pending connections and start a game on each of them
+ * @details stops accepting when the session pool is exhausted or the
+ * server runs out of file descriptors, until a session is released. A
+ * connection that cannot be set up is closed, the others are served on.
+ * @return 0 on success, -1 on failure
  */
-static void exit_cleanup()
+static int accept_sessions(void)
 {
-	if (ai != NULL) {
-		freeaddrinfo(ai);
+	while (true) {
+		if (free_sessions == NULL) {
+			debug_print("%s\n", "Session pool exhausted");
+			return set_accepting(false);
+		}
+
+		int fd = COUNTED(accept(sock_fd, NULL, NULL));
+		if (fd < 0) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				return 0;
+			}
+			if (errno == EINTR || errno == ECONNABORTED) {
+				continue;
+			}
+			if (errno == EMFILE || errno == ENFILE) {
+				debug_print("%s\n", "Out of file descriptors");
+				return set_accepting(false);
+			}
+			return -1;
+		}
+
+		debug_print("Accepted connection %d\n", fd);
+		// responses are flushed in batches, Nagle's algorithm only delays
+		// them
+		struct epoll_event event = {.events = EPOLLIN,
+									.data.ptr = free_sessions};
+		if (set_nonblocking(fd) < 0 || COUNTED(set_nodelay(fd, true)) < 0
+			|| COUNTED(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event)) < 0
+			|| open_session(fd) == NULL) {
+			print_err("Could not set up connection");
+			COUNTED(close(fd));
+		}
 	}
+}
 
-	if (sock_fd != -1) {
-		close(sock_fd);
+/**
+ * @brief start a game on a new connection with the next free session
+ * @param fd the accepted connection, the pool must not be exhausted
+ * @return the session, NULL if its storage could not be restored
+ */
+static session_t *open_session(int fd)
+{
+	session_t *session = free_sessions;
+	if (init_session(session, fd, NULL) < 0) {
+		return NULL;
 	}
+	free_sessions = session->next;
 
-	if (conn_fd != -1) {
-		close(conn_fd);
+	trace_record(trace_connect, session->id, 0, invalid_coordinate, 0);
+	arm_session(session);
+
+	session->prev = NULL;
+	session->next = sessions;
+	if (sessions != NULL) {
+		sessions->prev = session;
+	}
+	sessions = session;
+	return session;
+}
+
+/**
+ * @brief read from a readable connection and handle all complete requests
+ * @details reads as much as the socket buffer holds. Requests may arrive in
+ * several parts, a trailing partial request is kept for the next read. The
+ * responses to all requests read at once are flushed together.
+ * @param session the session of the connection
+ * @return 0 if the connection stays open, -1 if it has to be closed
+ */
+static int handle_readable(session_t *session)
+{
+	ssize_t n = fill_sockbuf(&session->io);
+	syscall_cnt += session->io.syscalls;
+	session->io.syscalls = 0;
+	if (n < 0) {
+		if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+			return 0;
+		}
+		print_err("Could receive message on socket");
+		finish_game(EXIT_FAILURE);
+		return -1;
+	}
+	if (n == 0) {
+		return handle_eof(session);
+	}
+	return handle_buffered(session);
+}
+
+/**
+ * @brief send the rest of the responses of a session once its connection
+ * became writable
+ * @details the requests waiting in the read buffer are handled as soon as
+ * all responses were sent, and reading resumes.
+ * @param session the session of the connection
+ * @return 0 if the connection stays open, -1 if it has to be closed
+ */
+static int handle_writable(session_t *session)
+{
+	if (flush_socket(session) < 0) {
+		print_err("Could send message on socket");
+		finish_game(EXIT_FAILURE);
+		return -1;
+	}
+	if (session->writing) {
+		return 0;
 	}
+	return handle_buffered(session);
+}
+
+/**
+ * @brief change the events epoll watches a connection for
+ * @param session the session of the connection
+ * @param events EPOLLIN or EPOLLOUT
+ * @return 0 on success, -1 on failure
+ */
+static int watch_session(session_t *session, uint32_t events)
+{
+	struct epoll_event event = {.events = events, .data.ptr = session};
+	return COUNTED(epoll_ctl(epoll_fd, EPOLL_CTL_MOD, session->fd, &event));
+}
 
-	if (map != NULL) {
-		free(map);
+/**
+ * @brief handle the end of the stream of a connection
+ * @param session the session of the connection
+ * @return -1, as the connection has to be closed
+ */
+static int handle_eof(session_t *session)
+{
+	size_t len;
+	peek_sockbuf(&session->io, &len);
+	if (session->playing || len > 0) {
+		fprintf(stderr, "%s: Connection closed by client\n", program_name);
+		finish_game(EXIT_FAILURE);
 	}
+	return -1;
+}
+
+/**
+ * @brief handle the complete requests in the read buffer of a session
+ * @details only as many requests are handled as their responses fit into the
+ * write buffer next to the responses still being sent, the others wait for
+ * the send to complete.
+ * @param session the session of the connection
+ * @return 0 if the connection stays open, -1 if it has to be closed
+ */
+static int handle_buffered(session_t *session)
+{
+	// the clock is only read if the latencies are published
+	uint64_t read_time = metrics_path != NULL ? get_time_ns() : 0;
+	uint64_t shots = metrics.shots;
+
+	size_t len;
+	const uint8_t *buf = peek_sockbuf(&session->io, &len);
+	size_t cnt = len / REQUEST_LEN;
+	size_t room = get_sockbuf_space(&session->io) / RESPONSE_LEN;
+	if (cnt > room) {
+		cnt = room;
+	}
+	if (handle_requests(session, buf, cnt) < 0) {
+		return -1;
+	}
+	consume_sockbuf(&session->io, cnt * REQUEST_LEN);
+	if (loop->flush(session) < 0) {
+		print_err("Could send message on socket");
+		finish_game(EXIT_FAILURE);
+		return -1;
+	}
+	if (metrics_path != NULL) {
+		record_rounds(session, read_time, metrics.shots - shots);
+	}
+	arm_session(session);
+	return 0;
+}
+
+/**
+ * @brief arm the timeout of a session for the next request
+ * @details a client that started a request, or a rules proposal, has to
+ * complete it within the read deadline, otherwise it has to send its next
+ * request within the idle timeout. Either restarts after every read.
+ * @param session the session of an open connection
+ */
+static void arm_session(session_t *session)
+{
+	size_t len;
+	peek_sockbuf(&session->io, &len);
+	unsigned long ms =
+		len > 0 || session->classes_left > 0 ? read_deadline : idle_timeout;
+	if (ms == 0) {
+		disarm_timeout(&wheel, &session->timeout);
+		return;
+	}
+	// the current tick has already begun, so round up by a whole tick
+	uint64_t now = get_time_ns() / 1000000 / WHEEL_TICK_MS;
+	arm_timeout(&wheel, &session->timeout, now + ms / WHEEL_TICK_MS + 1);
+}
+
+/**
+ * @brief close the connections of all sessions whose timeout expired
+ * @details a stalled client only costs its own game, the other connections
+ * are served on in the meantime.
+ */
+static void expire_sessions(void)
+{
+	uint64_t now = get_time_ns() / 1000000 / WHEEL_TICK_MS;
+	timeout_t *timeout;
+	while ((timeout = pop_expired(&wheel, now)) != NULL) {
+		session_t *session = timeout->owner;
+		metrics.timeouts++;
+		debug_print("Connection %d timed out\n", session->fd);
+
+		size_t len;
+		peek_sockbuf(&session->io, &len);
+		if (session->playing || len > 0) {
+			fprintf(stderr, "%s: Connection timed out\n", program_name);
+			finish_game(EXIT_FAILURE);
+		}
+		close_session(session);
+	}
+}
+
+/**
+ * @brief get the time epoll may wait for events
+ * @return the milliseconds until the next tick of the timer wheel or the
+ * next write of the metrics, -1 to wait indefinitely if neither is due
+ */
+static int get_wait_time(void)
+{
+	int wait = -1;
+	uint64_t now = get_time_ns() / 1000000;
+	if (wheel.armed > 0) {
+		wait = WHEEL_TICK_MS - now % WHEEL_TICK_MS;
+	}
+	if (metrics_path != NULL) {
+		uint64_t due = metrics_time / 1000000 + METRICS_INTERVAL;
+		int left = due > now ? (int)(due - now) : 0;
+		if (wait < 0 || left < wait) {
+			wait = left;
+		}
+	}
+	return wait;
+}
+
+/**
+ * @brief write the metrics file and start a new interval
+ * @details the gauges are counted from the open sessions right before
+ * writing, so serving requests only increments counters.
+ */
+static void publish_metrics(void)
+{
+	metrics.connections = 0;
+	metrics.active_games = 0;
+	for (session_t *s = sessions; s != NULL; s = s->next) {
+		metrics.connections++;
+		metrics.active_games += s->playing;
+	}
+	metrics.games_finished = games_finished;
+
+	uint64_t now = get_time_ns();
+	if (write_metrics(metrics_path,
+					  &metrics,
+					  metrics.shots - metrics_shots,
+					  metrics_time != 0 ? now - metrics_time : 0)
+		< 0) {
+		print_err("Could not write metrics");
+	}
+	clear_histogram(&metrics.rounds);
+	clear_histogram(&metrics.service);
+	metrics_time = now;
+	metrics_shots = metrics.shots;
+}
+
+/**
+ * @brief record the latencies of the shots handled after a read
+ * @details shots read at once share their latencies. The first shot of a
+ * connection has no previous response to measure its round from.
+ * @param session the session the shots were read on
+ * @param read_time the time they were read in ns
+ * @param shots the number of shots, their responses were just sent
+ */
+static void record_rounds(session_t *session,
+						  uint64_t read_time,
+						  uint64_t shots)
+{
+	uint64_t now = get_time_ns();
+	for (uint64_t i = 0; i < shots; i++) {
+		if (session->responded != 0) {
+			record_value(&metrics.rounds, read_time - session->responded);
+		}
+		record_value(&metrics.service, now - read_time);
+	}
+	session->responded = now;
+}
+
+/**
+ * @brief handle complete requests read from a connection
+ * @details the parity of all of them is checked at once, the requests in
+ * front of the first one with a parity error are still handled.
+ * @param session the session the requests were received on
+ * @param buf the encoded requests
+ * @param n the number of requests, at most READ_BATCH
+ * @return 0 if the connection stays open, -1 if it has to be closed
+ */
+static int handle_requests(session_t *session,
+						   const uint8_t *buf,
+						   size_t n)
+{
+	client_msg_t requests[READ_BATCH];
+	size_t valid = check_requests(buf, n);
+	decode_requests(buf, n, requests);
+
+	for (size_t i = 0; i < valid; i++) {
+		if (handle_checked(session, requests[i]) < 0) {
+			return -1;
+		}
+	}
+	if (valid < n) {
+		return handle_parity_error(session, requests[valid]);
+	}
+	return 0;
+}
+
+/**
+ * @brief handle a single request of a session
+ * @param session the session the request was received on
+ * @param request the received request
+ * @return 0 if the connection stays open, -1 if it has to be closed
+ */
+static int handle_request(session_t *session, client_msg_t request)
+{
+	if (!check_parity(request)) {
+		return handle_parity_error(session, request);
+	}
+	return handle_checked(session, request);
+}
+
+/**
+ * @brief respond to a request with a wrong parity bit and end its game
+ * @param session the session the request was received on
+ * @param request the received request
+ * @return -1, as the connection has to be closed
+ */
+static int handle_parity_error(session_t *session, client_msg_t request)
+{
+	request_cnt++;
+	metrics.parity_errors++;
+	if (respond(session, get_coordinates(request), err_parity) < 0) {
+		print_err("Could send error message on socket");
+	}
+	fprintf(stderr, "%s: Parity error\n", program_name);
+	finish_game(EXIT_PARITY_ERR);
+	return -1;
+}
+
+/**
+ * @brief handle a single request of a session whose parity was checked
+ * @details a shot plays a round of the current game, a new game message
+ * resets the map of the session in place.
+ * @param session the session the request was received on
+ * @param request the received request
+ * @return 0 if the connection stays open, -1 if it has to be closed
+ */
+static int handle_checked(session_t *session, client_msg_t request)
+{
+	request_cnt++;
+	switch (get_opcode(request)) {
+		case op_shot:
+			break;
+		case op_new_game:
+			trace_record(trace_new_game,
+						 session->id,
+						 session->round,
+						 invalid_coordinate,
+						 0);
+			if ((corpus.fleet_cnt > 0 || random_fleets)
+				&& same_rules(&session->rules, &rules)) {
+				assign_fleet(session);
+				start_game(session);
+				return 0;
+			}
+			reset_map(session->map);
+			session->playing = true;
+			session->round = 0;
+			metrics.games_started++;
+			return 0;
+		case op_rules:
+		case op_ships:
+			return handle_proposal(session, request);
+		default:
+			fprintf(stderr, "%s: Unknown request\n", program_name);
+			finish_game(EXIT_FAILURE);
+			return -1;
+	}
+
+	if (!session->playing) {
+		fprintf(stderr, "%s: Shot without a game\n", program_name);
+		return -1;
+	}
+
+	const coordinate_t coordinate = get_coordinates(request);
+
+	if (!check_coordinate(coordinate, session->rules.map_size)) {
+		metrics.coordinate_errors++;
+		if (respond(session, coordinate, err_coordinate) < 0) {
+			print_err("Could send error message on socket");
+		}
+		fprintf(stderr, "%s: Invalid coordinate\n", program_name);
+		finish_game(EXIT_COORDINATE_ERR);
+		return -1;
+	}
+
+	metrics.shots++;
+	hit_report_t report = shoot(session->map, coordinate);
+	shot_t *shot = &session->shots[session->round];
+	session->round++;
+
+	shot->cell = coordinate.row * session->rules.map_size + coordinate.col;
+	if (report == report_last_sunk
+		|| session->round == session->rules.max_rounds) {
+		session->playing = false;
+		shot->msg = game_over | report;
+		if (respond(session, coordinate, shot->msg) < 0) {
+			print_err("Could send message on socket");
+			finish_game(EXIT_FAILURE);
+			return -1;
+		}
+
+		// the log only holds games by the server's rules
+		if (game_log != NULL && same_rules(&session->rules, &rules)
+			&& append_game(game_log,
+						   &rules,
+						   &session->fleet,
+						   session->shots,
+						   session->round)
+				   < 0) {
+			print_err("Could not write game log");
+		}
+
+		if (report == report_last_sunk) {
+			printf("%s: Rounds: %d\n", program_name, session->round);
+		} else {
+			printf("%s: Game lost\n", program_name);
+		}
+		finish_game(EXIT_SUCCESS);
+		return 0;
+	}
+
+	shot->msg = game_ongoing | report;
+	if (respond(session, coordinate, shot->msg) < 0) {
+		print_err("Could send message on socket");
+		finish_game(EXIT_FAILURE);
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * @brief handle a message proposing rules
+ * @details the rules message starts a proposal, the ships messages complete
+ * it. The proposal is accepted if it equals the server's rules, or with -r if
+ * a random fleet is placed by it within NEGOTIATION_ATTEMPTS attempts, which
+ * bounds the work a client can cause, and a new game by the accepted rules
+ * starts right away. A rejected proposal ends the current game.
+ * @param session the session the request was received on
+ * @param request a rules or ships message with a valid parity
+ * @return 0 if the connection stays open, -1 if it has to be closed
+ */
+static int handle_proposal(session_t *session, client_msg_t request)
+{
+	uint8_t first;
+	uint8_t second;
+	get_params(request, &first, &second);
+
+	if (get_opcode(request) == op_rules) {
+		clear_rules(&session->proposal, first);
+		session->proposal_ok = true;
+		session->classes_left = second;
+		return 0;
+	}
+
+	if (session->classes_left == 0) {
+		fprintf(stderr, "%s: Ships without a rules proposal\n", program_name);
+		finish_game(EXIT_FAILURE);
+		return -1;
+	}
+	if (session->proposal_ok
+		&& add_ships(&session->proposal, first, second) < 0) {
+		session->proposal_ok = false;
+	}
+	if (--session->classes_left > 0) {
+		return 0;
+	}
+
+	const rules_t *proposal = &session->proposal;
+	bool accepted = session->proposal_ok && finish_rules(&session->proposal) == 0;
+	if (accepted && same_rules(proposal, &rules)) {
+		accepted = set_session_rules(session, proposal) == 0;
+		if (accepted) {
+			assign_fleet(session);
+		}
+	} else if (accepted && random_fleets) {
+		// place the fleet first, so a rejection keeps the previous rules
+		fleet_t new_fleet;
+		accepted = init_fleet(&new_fleet, proposal) == 0
+				   && set_placements(proposal) == 0
+				   && random_fleet(&new_fleet,
+								   proposal,
+								   &placements,
+								   NEGOTIATION_ATTEMPTS,
+								   &rng)
+						  == 0
+				   && set_session_rules(session, proposal) == 0;
+		if (accepted) {
+			copy_fleet(&session->fleet, &new_fleet);
+		}
+		free_fleet(&new_fleet);
+	} else {
+		accepted = false;
+	}
+
+	char line[RULES_LINE_LEN];
+	format_rules(&session->rules, line);
+	if (!accepted) {
+		// the client has to start a game by the previous rules explicitly
+		session->playing = false;
+		debug_print("Rejected rules, keeping %s\n", line);
+	} else {
+		debug_print("Playing by rules %s\n", line);
+		start_game(session);
+	}
+
+	if (respond(session,
+				invalid_coordinate,
+				accepted ? game_ongoing : game_over)
+		< 0) {
+		print_err("Could send message on socket");
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * @brief check if the pool has a session for another connection
+ * @return true if a connection can be opened
+ */
+static bool can_open_session(void)
+{
+	return free_sessions != NULL;
+}
+
+/**
+ * @brief close the connection of a session and return it to the pool
+ * @details the event loop closes the connection, the io_uring loop sends the
+ * responses still buffered first and returns the session to the pool once
+ * all of its operations completed.
+ * @param session the session to close
+ */
+static void close_session(session_t *session)
+{
+	debug_print("Closing connection %d\n", session->fd);
+	trace_record(
+		trace_close, session->id, session->round, invalid_coordinate, 0);
+	disarm_timeout(&wheel, &session->timeout);
+
+	if (session->prev != NULL) {
+		session->prev->next = session->next;
+	} else {
+		sessions = session->next;
+	}
+	if (session->next != NULL) {
+		session->next->prev = session->prev;
+	}
+
+	loop->close(session);
+}
+
+/**
+ * @brief return a closed session to the pool and resume accepting
+ * connections if the pool was exhausted
+ * @param session the session to release
+ */
+static void release_session(session_t *session)
+{
+	session->next = free_sessions;
+	free_sessions = session;
+	loop->resume();
+}
+
+/**
+ * @brief start the timeouts of the sessions and the metrics, right before
+ * the event loop starts
+ */
+static void start_serving(void)
+{
+	init_wheel(&wheel, get_time_ns() / 1000000 / WHEEL_TICK_MS);
+	if (metrics_path != NULL) {
+		publish_metrics();
+	}
+}
+
+/**
+ * @brief do the work due after each iteration of the event loop
+ * @details closes the connections whose timeout expired and writes the
+ * metrics once their interval passed.
+ */
+static void tick_server(void)
+{
+	expire_sessions();
+	if (metrics_path != NULL
+		&& get_time_ns() - metrics_time >= METRICS_INTERVAL * 1000000ULL) {
+		publish_metrics();
+	}
+}
+
+/**
+ * @brief trace the response to a request and send it
+ * @param session the session to respond to
+ * @param c the coordinate of the request
+ * @param msg the response
+ * @return 0 if sending succeeded, -1 otherwise
+ */
+static int respond(session_t *session, coordinate_t c, server_msg_t msg)
+{
+	trace_record(trace_shot, session->id, session->round, c, msg);
+	return send_msg(session, msg);
+}
+
+/**
+ * @brief count a finished game and exit with its status once the game limit
+ * is reached
+ * @param status the exit status of the game
+ */
+static void finish_game(int status)
+{
+	games_finished++;
+	if (game_limit != 0 && games_finished >= game_limit) {
+		exit(status);
+	}
+}
+
+/**
+ * @brief Print the usage message to stdout
+ */
+static void print_usage(void)
+{
+
+	printf("\nUsage:\n");
+	printf("\tserver [-p PORT] [-g GAMES] SHIPS...\n");
+	printf("\tserver [-p PORT] [-g GAMES] -r\n");
+	printf("\tserver -u PATH [-g GAMES] SHIPS...|-r\n");
+	printf("\tserver -m NAME [-g GAMES] SHIPS...|-r\n");
+	printf("\tserver [-p PORT] [-g GAMES] [-r] -f FILE|-F FILE\n");
+	printf(
+		"\n\tall forms also accept [-R RULES] [-c CONNECTIONS] [-T FILE] "
+		"[-l FILE] [-i MILLISECONDS] [-s], TCP and Unix sockets also "
+		"[-t MILLISECONDS] [-M FILE] [-U]\n");
+	printf("\n\t-p\tthe port to listen on. Defaults to %s\n", DEFAULT_PORT);
+	printf(
+		"\n\t-g\tthe number of games to play before exiting, 0 for no "
+		"limit. Defaults to 1. Games on different connections are played "
+		"concurrently, a connection may play several games in a row and the "
+		"exit status is the one of the last game\n");
+	printf(
+		"\n\t-c\tthe maximum number of concurrent connections, further "
+		"ones wait until a connection closes. Defaults to %d, lowered to "
+		"the file descriptors left by their limit\n",
+		DEFAULT_SESSIONS);
+	printf(
+		"\n\t-t\tthe read deadline, the time a client has to complete a "
+		"started request or rules proposal before its connection is closed, "
+		"0 for no deadline. Defaults to %d ms\n",
+		DEFAULT_READ_DEADLINE);
+	printf(
+		"\n\t-i\tthe idle timeout, the time a client may wait between "
+		"requests before its connection is closed, 0 for no timeout. "
+		"Defaults to %d ms\n",
+		DEFAULT_IDLE_TIMEOUT);
+	printf(
+		"\n\t-u\tlisten on a Unix domain socket at PATH instead of TCP\n");
+	printf(
+		"\n\t-m\tserve a single client at a time over the shared memory "
+		"object NAME instead of TCP\n");
+	printf(
+		"\n\t-T\trecord a binary trace of every connection and shot into "
+		"FILE, decode it with tracedump\n");
+	printf(
+		"\n\t-l\tappend every finished game to the binary game log FILE\n");
+	printf(
+		"\n\t-U\tserve connections through io_uring with multishot "
+		"accepts and receives instead of epoll, falling back to epoll if the "
+		"kernel does not support it\n");
+	printf(
+		"\n\t-M\trewrite the metrics file FILE every %d ms: open "
+		"connections, active, started and finished games, shots and shots "
+		"per second, parity and coordinate errors, timeouts and the "
+		"percentiles of the round and service latencies\n",
+		METRICS_INTERVAL);
+	printf(
+		"\n\t-s\tprint the number of requests, system calls of the event "
+		"loop, connections timed out and the CPU time used when exiting\n");
+	printf(
+		"\n\t-R\tthe rules of the games, the map size followed by the "
+		"number of ships of each length, up to a %dx%d map. Defaults to %s. "
+		"Clients proposing other rules are only served with -r\n",
+		MAX_MAP_SIZE,
+		MAX_MAP_SIZE,
+		CLASSIC_RULES);
+	printf(
+		"\n\t-r\tplay every game by the rules on a new random fleet instead "
+		"of the given ships, and with a random fleet by any rules a client "
+		"proposes\n");
+	printf(
+		"\n\t-f\tplay every game by the rules on the next fleet of FILE, "
+		"in turn. FILE holds one fleet per line as written by fleets, or is "
+		"a game log whose fleets are played again. All fleets are checked "
+		"once when starting\n");
+	printf("\n\t-F\tlike -f, but play on a random fleet of FILE\n");
+	printf(
+		"\n\tships\ta list of coordinate pairs, one per ship of the rules, "
+		"each denoting the begin and end of a ship. Columns are letters, A to "
+		"Z followed by AA, AB and so on, rows are numbers from 0. None of the "
+		"ships are allowed to touch each other.\n");
+	printf("\nexample:\n");
+	printf("\tserver -p 1280 C2E2 F0H0 B6A6 E8E6 I2I5 H8I8\n");
+	printf("\tserver -R 16:4x2,3x3,2x4,1x5 -r\n");
+	printf("\tserver -g 0 -f fleets.txt\n");
+}
+
+/**
+ * @brief Parses the program command line options
+ * @details Returns 0 if all parameters were parsed correctly.
+ * -1 is returned when one of the following conditions is violated:
+ * 	- Any two ships touch each other
+ * 	- Any coordinate is not within the map
+ * 	- The amount of ships deviates from the expected number
+ * 	- The amount for any ship type deviate from the expected number
+ * 	- wrong/unknown/unexpected arguments are specified
+ * With -r a random fleet is generated and printed instead.
+ * @param argc the argument counter, length of argv
+ * @param argv an array of arguments
+ * @return 0 on success, -1 on failure
+ */
+static int parse_args(int argc, char *argv[])
+{
+	program_name = argv[0];
+
+	const char *rules_str = CLASSIC_RULES;
+	int arg_c;
+	char *end;
+	while ((arg_c = getopt(argc, argv, "p:g:c:t:i:m:u:T:l:M:R:f:F:sUr")) != EOF) {
+		switch (arg_c) {
+			case 'p':
+				port = optarg;
+				break;
+			case 'g':
+				errno = 0;
+				game_limit = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0') {
+					return -1;
+				}
+				break;
+			case 'c':
+				errno = 0;
+				session_limit = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0' || session_limit == 0) {
+					return -1;
+				}
+				break;
+			case 't':
+				errno = 0;
+				read_deadline = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0' || read_deadline > INT_MAX) {
+					return -1;
+				}
+				break;
+			case 'i':
+				errno = 0;
+				idle_timeout = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0' || idle_timeout > INT_MAX) {
+					return -1;
+				}
+				break;
+			case 'm':
+				shm_name = optarg;
+				break;
+			case 'u':
+				unix_path = optarg;
+				break;
+			case 'T':
+				trace_path = optarg;
+				break;
+			case 'l':
+				log_path = optarg;
+				break;
+			case 'M':
+				metrics_path = optarg;
+				break;
+			case 'R':
+				rules_str = optarg;
+				break;
+			case 's':
+				print_stats = true;
+				break;
+			case 'U':
+				use_uring = true;
+				break;
+			case 'r':
+				random_fleets = true;
+				break;
+			case 'f':
+			case 'F':
+				corpus_path = optarg;
+				corpus_random = arg_c == 'F';
+				break;
+			default:
+				return -1;
+		}
+	}
+
+	if (parse_rules(rules_str, &rules) < 0) {
+		fprintf(stderr, "%s: Invalid rules %s\n", program_name, rules_str);
+		return -1;
+	}
+	if (init_fleet(&fleet, &rules) < 0) {
+		print_err("Could not allocate fleet");
+		return -1;
+	}
+
+	if (corpus_path != NULL) {
+		if (argc - optind != 0) {
+			return -1;
+		}
+
+		seed_rng(&rng, time(NULL) ^ getpid());
+		unsigned long bad;
+		if (load_corpus(&corpus, corpus_path, &rules, &bad) < 0) {
+			if (bad > 0) {
+				fprintf(stderr,
+						"%s: Illegal fleet %lu in %s\n",
+						program_name,
+						bad,
+						corpus_path);
+			} else {
+				print_err("Could not load fleets");
+			}
+			return -1;
+		}
+		printf("%s: Fleets: %zu\n", program_name, corpus.fleet_cnt);
+		return 0;
+	}
+
+	if (random_fleets) {
+		if (argc - optind != 0) {
+			return -1;
+		}
+
+		seed_rng(&rng, time(NULL) ^ getpid());
+		if (init_placements(&rules_placements, &rules) < 0) {
+			print_err("Could not allocate placements");
+			return -1;
+		}
+		if (random_fleet(
+				&fleet, &rules, &rules_placements, FLEET_ATTEMPTS, &rng)
+			< 0) {
+			fprintf(stderr,
+					"%s: No fleet fits the rules %s\n",
+					program_name,
+					rules_str);
+			return -1;
+		}
+
+		char *line = malloc(FLEET_LINE_LEN(fleet.ship_cnt));
+		if (line == NULL) {
+			print_err("Could not allocate fleet");
+			return -1;
+		}
+		format_fleet(&fleet, line);
+		printf("%s: Fallback fleet: %s\n", program_name, line);
+		free(line);
+		return 0;
+	}
+
+	// parse remaining arguments aka ships
+	if ((argc - optind) != rules.ship_cnt) {
+		return -1;
+	}
+
+	for (int i = 0; i < rules.ship_cnt; i++) {
+		if (parse_ship(argv[optind + i], &fleet.ships[i], rules.map_size) < 0) {
+			return -1;
+		}
+	}
+
+	if (!check_fleet(&fleet, &rules)) {
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief print to stderr, but prepand the program name
+ * @param msg the text to print
+ */
+static void print_err(char *msg)
+{
+	fprintf(stderr, "%s: %s\n", program_name, msg);
+	fprintf(stderr, "\t%s\n", strerror(errno));
+}
+
+/**
+ * @brief send a message on the connection of a session
+ * @details buffers a message for the socket, it is sent with the responses
+ * to the other requests read at once. The response ending a game is sent
+ * right away. Each response answers a request, so the socket always has room
+ * for the buffered responses.
+ * @param session the session to send the message to
+ * @param msg the message to be send
+ * @return 0 if sending succeeded, -1 otherwise
+ */
+static int send_msg(session_t *session, server_msg_t msg)
+{
+	if (session->channel != NULL) {
+		return send_response(session->channel, msg);
+	}
+
+	uint8_t buf[RESPONSE_LEN];
+	size_t len = encode_responses(&msg, 1, buf);
+	if (write_sockbuf(&session->io, buf, len) < 0) {
+		return -1;
+	}
+	// the server may exit right after the end of a game
+	if (get_status(msg) != game_ongoing) {
+		return loop->flush(session);
+	}
+	return 0;
+}
+
+/**
+ * @brief send the buffered responses of a session served by epoll
+ * @details whatever the socket does not accept right now stays buffered,
+ * and the connection is watched for becoming writable instead of readable
+ * until all of it was sent.
+ * @param session the session of a socket
+ * @return 0 if the responses were sent or stay buffered, -1 if sending
+ * failed
+ */
+static int flush_socket(session_t *session)
+{
+	ssize_t left = flush_sockbuf(&session->io);
+	syscall_cnt += session->io.syscalls;
+	session->io.syscalls = 0;
+	if (left < 0) {
+		return -1;
+	}
+	bool writing = left > 0;
+	if (writing != session->writing) {
+		if (watch_session(session, writing ? EPOLLOUT : EPOLLIN) < 0) {
+			return -1;
+		}
+		session->writing = writing;
+	}
+	return 0;
+}
+
+/**
+ * @brief close the connection of a session served by epoll and return the
+ * session to the pool
+ * @param session the session to close
+ */
+static void close_socket(session_t *session)
+{
+	COUNTED(close(session->fd));
+	release_session(session);
+}
+
+/**
+ * @brief watch the listening socket again if the pool was exhausted
+ */
+static void resume_accepting(void)
+{
+	if (!accepting && sock_fd != -1 && set_accepting(true) < 0) {
+		print_err("Could not resume accepting connections");
+	}
+}
+
+/**
+ * @brief send the responses still buffered by epoll sessions before exiting
+ * @details the last response of the game ending the server may not have been
+ * accepted by the socket yet.
+ * @param open_sessions the open sessions
+ * @param timeout the time in ms the clients get in total to take all of them
+ */
+static void drain_sockets(session_t *open_sessions, int timeout)
+{
+	uint64_t deadline = get_time_ns() / 1000000 + timeout;
+	for (session_t *s = open_sessions; s != NULL; s = s->next) {
+		while (s->writing && s->io.wlen > 0) {
+			uint64_t now = get_time_ns() / 1000000;
+			struct pollfd pfd = {.fd = s->fd, .events = POLLOUT};
+			if (now >= deadline || poll(&pfd, 1, deadline - now) <= 0
+				|| flush_sockbuf(&s->io) < 0) {
+				break;
+			}
+		}
+	}
+}
+
+/**
+ * @brief put a file descriptor into non-blocking mode
+ * @param fd the file descriptor
+ * @return 0 on success, -1 on failure
+ */
+static int set_nonblocking(int fd)
+{
+	int flags = COUNTED(fcntl(fd, F_GETFL));
+	if (flags < 0 || COUNTED(fcntl(fd, F_SETFL, flags | O_NONBLOCK)) < 0) {
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * @brief free all dependencies and exit with the specified exit code
+ * @param exit_code the exit code to exit with
+ */
+static void exit_cleanup()
+{
+	// may run twice when exiting on a signal
+	if (print_stats) {
+		print_stats = false;
+		print_statistics();
+	}
+
+	// the last interval is published once, if serving started at all
+	if (metrics_path != NULL && metrics_time != 0) {
+		publish_metrics();
+		metrics_path = NULL;
+	}
+
+	// the responses ending the last games may not even be submitted yet
+	loop->drain(sessions, DRAIN_TIMEOUT);
+	free_uring_loop();
+	// without the ring the remaining connections are closed right away
+	loop = &epoll_loop;
+
+	if (ai != NULL) {
+		freeaddrinfo(ai);
+		ai = NULL;
+	}
+
+	if (sock_fd != -1) {
+		close(sock_fd);
+		sock_fd = -1;
+	}
+
+	if (unix_bound) {
+		unlink(unix_path);
+		unix_bound = false;
+	}
+
+	while (sessions != NULL) {
+		close_session(sessions);
+	}
+
+	if (epoll_fd != -1) {
+		close(epoll_fd);
+		epoll_fd = -1;
+	}
+
+	if (channel != NULL) {
+		close_channel(channel);
+		channel = NULL;
+	}
+
+	if (pool != NULL) {
+		for (unsigned long i = 0; i < session_limit; i++) {
+			free_session(&pool[i]);
+		}
+		free(pool);
+		pool = NULL;
+	}
+	free_fleet(&fleet);
+	free_corpus(&corpus);
+	free_placements(&placements);
+	free_placements(&rules_placements);
+
+	close_trace();
+
+	if (game_log != NULL) {
+		fclose(game_log);
+		game_log = NULL;
+	}
+}
+
+/**
+ * @brief print the statistics of the whole run to stdout
+ * @details system calls made inside the shared memory channel are not
+ * counted.
+ */
+static void print_statistics(void)
+{
+	struct rusage usage;
+	double cpu = 0;
+	if (getrusage(RUSAGE_SELF, &usage) == 0) {
+		cpu = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6
+			  + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+	}
+
+	printf("%s: Games: %lu\n", program_name, games_finished);
+	printf("%s: Requests: %llu\n", program_name, request_cnt);
+	printf("%s: Syscalls: %llu\n", program_name, syscall_cnt);
+	printf("%s: Timeouts: %llu\n",
+		   program_name,
+		   (unsigned long long)metrics.timeouts);
+	printf("%s: CPU: %.3f s\n", program_name, cpu);
 }
 
 /**
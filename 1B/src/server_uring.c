@@ -0,0 +1,552 @@
+/**
+ * @file server_uring.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief The io_uring event loop of the server of OSUE exercise 1B
+ * `Battleship'.
+ */
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "../include/server_uring.h"
+#include "../include/uring.h"
+#include "../include/codec.h"
+
+// submission queue entries of the ring
+#define URING_ENTRIES 1024
+// number of provided buffers of the ring
+#define URING_BUFFERS 1024
+// length of each provided buffer, a received buffer has to fit into the
+// read buffer of a session next to a partial request
+#define URING_BUF_LEN (SOCKBUF_LEN / 2)
+// connections accepted while the pool is exhausted that wait for a session,
+// they arrive until the cancel of the accept takes effect
+#define WAITING_FDS 256
+
+// kinds of operations, stored in the low bits of their user data next to
+// the session they belong to
+#define UOP_MASK 7
+typedef enum
+{
+	uop_accept = 1,  // the multishot accept of the listening socket
+	uop_recv = 2,	 // the multishot receive of a session
+	uop_send = 3,	 // a send of buffered responses
+	uop_close = 4,	 // closing the connection of a session
+	uop_cancel = 5	 // cancelling the accept or a receive
+} uring_op_t;
+
+// count a system call of the loop for the statistics of the server
+#define COUNTED(call) ((*callbacks->syscalls)++, (call))
+
+static uring_t ring = {.fd = -1};  // the ring, if set up
+static const session_callbacks_t *callbacks = NULL;  // the server's functions
+static int listen_fd = -1;		   // the listening socket
+static bool accept_armed = false;  // a multishot accept is in progress
+static bool out_of_fds = false;	// accepting failed for lack of file
+									// descriptors, retried on a release
+static unsigned long sends = 0;	// sends in progress on the ring
+static int waiting[WAITING_FDS];	// connections waiting for a session, in
+									// the order they were accepted
+static int waiting_first = 0;		// index of the oldest waiting connection
+static int waiting_cnt = 0;			// number of waiting connections
+
+static int handle_completion(const struct io_uring_cqe *cqe);
+static int handle_accepted(const struct io_uring_cqe *cqe);
+static void handle_received(session_t *session,
+							const struct io_uring_cqe *cqe);
+static void handle_sent(session_t *session, int res);
+static int complete_send(session_t *session, int res);
+static int submit_send(session_t *session);
+static int arm_accept(void);
+static int cancel_accept(void);
+static void start_session(int fd);
+static void open_waiting(void);
+static int arm_recv(session_t *session);
+static void shutdown_session(session_t *session);
+static void finish_close(session_t *session);
+static void resume_accepting(void);
+static void drain_uring(session_t *sessions, int timeout);
+static uint64_t get_user_data(session_t *session, uring_op_t op);
+
+const event_loop_t uring_loop = {.flush = submit_send,
+								 .close = shutdown_session,
+								 .resume = resume_accepting,
+								 .drain = drain_uring};
+
+int init_uring_loop(int sock_fd, const session_callbacks_t *session_callbacks)
+{
+	listen_fd = sock_fd;
+	callbacks = session_callbacks;
+	if (init_uring(&ring, URING_ENTRIES) < 0
+		|| add_buffers(&ring, URING_BUFFERS, URING_BUF_LEN) < 0) {
+		return -1;
+	}
+	return 0;
+}
+
+int run_uring_loop(void)
+{
+	if (arm_accept() < 0) {
+		callbacks->print_err("Could not accept connections");
+		return -1;
+	}
+
+	while (true) {
+		if (submit_uring(&ring, 1, callbacks->get_wait_time()) < 0
+			&& errno != ETIME && errno != EINTR) {
+			callbacks->print_err("Could not wait for completions");
+			return -1;
+		}
+		*callbacks->syscalls += ring.syscalls;
+		ring.syscalls = 0;
+
+		struct io_uring_cqe *cqe;
+		while ((cqe = peek_cqe(&ring)) != NULL) {
+			// handling may submit, which lets the kernel reuse the entry
+			struct io_uring_cqe completion = *cqe;
+			seen_cqe(&ring);
+			if (handle_completion(&completion) < 0) {
+				callbacks->print_err("Could accept connections");
+				return -1;
+			}
+		}
+
+		callbacks->tick();
+	}
+}
+
+void free_uring_loop(void)
+{
+	for (; waiting_cnt > 0; waiting_cnt--) {
+		close(waiting[waiting_first]);
+		waiting_first = (waiting_first + 1) % WAITING_FDS;
+	}
+	free_uring(&ring);
+}
+
+/**
+ * @brief handle a completion of the ring
+ * @details a session that is being closed returns to the pool with the last
+ * completion of its operations.
+ * @param cqe the completion
+ * @return 0 on success, -1 if accepting failed
+ */
+static int handle_completion(const struct io_uring_cqe *cqe)
+{
+	session_t *session = (session_t *)(uintptr_t)(cqe->user_data & ~UOP_MASK);
+	bool last = true;
+	switch ((uring_op_t)(cqe->user_data & UOP_MASK)) {
+		case uop_accept:
+			return handle_accepted(cqe);
+		case uop_recv:
+			last = !(cqe->flags & IORING_CQE_F_MORE);
+			if (last) {
+				session->receiving = false;
+			}
+			handle_received(session, cqe);
+			break;
+		case uop_send:
+			handle_sent(session, cqe->res);
+			break;
+		case uop_close:
+		case uop_cancel:
+			break;
+	}
+
+	// cancelling the accept belongs to no session
+	if (session != NULL && last && --session->pending == 0
+		&& session->closing) {
+		callbacks->release(session);
+	}
+	return 0;
+}
+
+/**
+ * @brief start a game on an accepted connection
+ * @details the accept is cancelled when the pool is exhausted, so further
+ * connections wait in the listen backlog. Connections accepted before the
+ * cancel took effect wait for a session as well, up to WAITING_FDS of them,
+ * any further ones are closed. Without file descriptors left the accept
+ * stops until a session is released.
+ * @param cqe the completion of the accept
+ * @return 0 on success, -1 on failure
+ */
+static int handle_accepted(const struct io_uring_cqe *cqe)
+{
+	int fd = cqe->res;
+	if (fd == -EMFILE || fd == -ENFILE) {
+		debug_print("%s\n", "Out of file descriptors");
+		out_of_fds = true;
+	}
+	if (!(cqe->flags & IORING_CQE_F_MORE)) {
+		accept_armed = false;
+		if (callbacks->can_open() && !out_of_fds && arm_accept() < 0) {
+			return -1;
+		}
+	} else if (out_of_fds) {
+		return cancel_accept();
+	}
+
+	if (fd < 0) {
+		if (fd == -EMFILE || fd == -ENFILE) {
+			return 0;
+		}
+		if (fd == -ECANCELED || fd == -EINTR || fd == -ECONNABORTED
+			|| fd == -EAGAIN) {
+			return 0;
+		}
+		errno = -fd;
+		return -1;
+	}
+
+	debug_print("Accepted connection %d\n", fd);
+	if (!callbacks->can_open()) {
+		if (waiting_cnt == WAITING_FDS) {
+			debug_print("%s\n", "Too many connections waiting");
+			COUNTED(close(fd));
+			return 0;
+		}
+		waiting[(waiting_first + waiting_cnt++) % WAITING_FDS] = fd;
+		return 0;
+	}
+	start_session(fd);
+
+	if (!callbacks->can_open() && accept_armed) {
+		debug_print("%s\n", "Session pool exhausted");
+		return cancel_accept();
+	}
+	return 0;
+}
+
+/**
+ * @brief open a session for an accepted connection and start receiving
+ * @details a connection that cannot be set up is closed, the others are
+ * served on.
+ * @param fd the connection, the pool has a session for it
+ */
+static void start_session(int fd)
+{
+	// responses are flushed in batches, Nagle's algorithm only delays them
+	session_t *session;
+	if (COUNTED(set_nodelay(fd, true)) < 0
+		|| (session = callbacks->open(fd)) == NULL) {
+		callbacks->print_err("Could not set up connection");
+		COUNTED(close(fd));
+		return;
+	}
+	if (arm_recv(session) < 0) {
+		callbacks->close(session);
+	}
+}
+
+/**
+ * @brief open sessions for the waiting connections while the pool has any
+ */
+static void open_waiting(void)
+{
+	while (waiting_cnt > 0 && callbacks->can_open()) {
+		int fd = waiting[waiting_first];
+		waiting_first = (waiting_first + 1) % WAITING_FDS;
+		waiting_cnt--;
+		start_session(fd);
+	}
+}
+
+/**
+ * @brief stop the multishot accept, it completes with its last completion
+ * @return 0 on success, -1 on failure
+ */
+static int cancel_accept(void)
+{
+	struct io_uring_sqe *sqe = get_sqe(&ring);
+	if (sqe == NULL) {
+		return -1;
+	}
+	prep_cancel(sqe, get_user_data(NULL, uop_accept), uop_cancel);
+	return 0;
+}
+
+/**
+ * @brief handle data received by the multishot receive of a session
+ * @details the data is copied into the read buffer of the session and the
+ * provided buffer handed back to the kernel right away. A receive that ran
+ * out of provided buffers is armed again.
+ * @param session the session of the connection
+ * @param cqe the completion of the receive
+ */
+static void handle_received(session_t *session,
+							const struct io_uring_cqe *cqe)
+{
+	int res = cqe->res;
+	int status = 0;
+	bool overflow = false;
+	if (cqe->flags & IORING_CQE_F_BUFFER) {
+		uint16_t bid = cqe->flags >> IORING_CQE_BUFFER_SHIFT;
+		if (!session->closing && res > 0
+			&& append_sockbuf(&session->io, get_buffer(&ring, bid), res) < 0) {
+			overflow = true;
+		}
+		return_buffer(&ring, bid);
+	}
+
+	if (session->closing) {
+		return;
+	} else if (overflow) {
+		// the client sends faster than it reads the responses
+		callbacks->print_err("Could receive message on socket");
+		callbacks->finish_game(EXIT_FAILURE);
+		status = -1;
+	} else if (res == -ENOBUFS) {
+		// all provided buffers are in use, receive again once some returned
+		if (!session->receiving) {
+			status = arm_recv(session);
+		}
+	} else if (res == 0) {
+		status = callbacks->handle_eof(session);
+	} else if (res < 0) {
+		errno = -res;
+		callbacks->print_err("Could receive message on socket");
+		callbacks->finish_game(EXIT_FAILURE);
+		status = -1;
+	} else {
+		status = callbacks->handle_buffered(session);
+		if (status == 0 && !session->receiving) {
+			status = arm_recv(session);
+		}
+	}
+
+	if (status < 0 && !session->closing) {
+		callbacks->close(session);
+	}
+}
+
+/**
+ * @brief handle a completed send of a session
+ * @details requests waiting for room in the write buffer are handled now.
+ * @param session the session of the connection
+ * @param res the result of the send
+ */
+static void handle_sent(session_t *session, int res)
+{
+	if (complete_send(session, res) < 0) {
+		if (!session->closing) {
+			callbacks->print_err("Could send message on socket");
+			callbacks->finish_game(EXIT_FAILURE);
+			callbacks->close(session);
+		}
+		return;
+	}
+
+	if (session->closing) {
+		if (!session->close_queued) {
+			finish_close(session);
+		}
+		return;
+	}
+
+	size_t len;
+	peek_sockbuf(&session->io, &len);
+	if (len >= REQUEST_LEN && callbacks->handle_buffered(session) < 0) {
+		callbacks->close(session);
+	}
+}
+
+/**
+ * @brief drop the sent responses from the write buffer and send the ones
+ * buffered in the meantime
+ * @param session the session of the connection
+ * @param res the result of the send
+ * @return 0 on success, -1 on failure with errno set
+ */
+static int complete_send(session_t *session, int res)
+{
+	sends--;
+	session->sending = 0;
+	if (res < 0) {
+		errno = -res;
+		return -1;
+	}
+	drop_sockbuf(&session->io, res);
+	return session->closing ? 0 : submit_send(session);
+}
+
+/**
+ * @brief send the buffered responses of a session, unless a send is in
+ * progress already
+ * @details the send is only prepared, it is submitted with the next wait
+ * for completions.
+ * @param session the session of the connection
+ * @return 0 on success, -1 on failure with errno set
+ */
+static int submit_send(session_t *session)
+{
+	if (session->sending > 0 || session->io.wlen == 0) {
+		return 0;
+	}
+	struct io_uring_sqe *sqe = get_sqe(&ring);
+	if (sqe == NULL) {
+		return -1;
+	}
+	prep_send(sqe,
+			  session->fd,
+			  session->io.wbuf,
+			  session->io.wlen,
+			  get_user_data(session, uop_send));
+	session->sending = session->io.wlen;
+	session->pending++;
+	sends++;
+	return 0;
+}
+
+/**
+ * @brief start accepting connections through the ring
+ * @return 0 on success, -1 on failure
+ */
+static int arm_accept(void)
+{
+	struct io_uring_sqe *sqe = get_sqe(&ring);
+	if (sqe == NULL) {
+		return -1;
+	}
+	prep_multishot_accept(sqe, listen_fd, get_user_data(NULL, uop_accept));
+	accept_armed = true;
+	return 0;
+}
+
+/**
+ * @brief start receiving on the connection of a session through the ring
+ * @param session the session of the connection
+ * @return 0 on success, -1 on failure
+ */
+static int arm_recv(session_t *session)
+{
+	struct io_uring_sqe *sqe = get_sqe(&ring);
+	if (sqe == NULL) {
+		callbacks->print_err("Could not receive on socket");
+		return -1;
+	}
+	prep_multishot_recv(sqe, session->fd, get_user_data(session, uop_recv));
+	session->receiving = true;
+	session->pending++;
+	return 0;
+}
+
+/**
+ * @brief close the connection of a session through the ring
+ * @details the receive is cancelled, the buffered responses are sent once a
+ * send in progress completed. The session returns to the pool once all of
+ * its operations completed.
+ * @param session the session to close
+ */
+static void shutdown_session(session_t *session)
+{
+	session->closing = true;
+	if (session->receiving) {
+		struct io_uring_sqe *sqe = get_sqe(&ring);
+		if (sqe != NULL) {
+			prep_cancel(sqe,
+						get_user_data(session, uop_recv),
+						get_user_data(session, uop_cancel));
+			session->pending++;
+		}
+	}
+	if (session->sending == 0) {
+		finish_close(session);
+	}
+}
+
+/**
+ * @brief send the last responses of a session and close its connection
+ * @details the send is hard linked to the close, so the close follows the
+ * send even if it fails.
+ * @param session the session to close, without a send in progress
+ */
+static void finish_close(session_t *session)
+{
+	session->close_queued = true;
+	struct io_uring_sqe *sqe;
+	if (session->io.wlen > 0 && (sqe = get_sqe(&ring)) != NULL) {
+		prep_send(sqe,
+				  session->fd,
+				  session->io.wbuf,
+				  session->io.wlen,
+				  get_user_data(session, uop_send));
+		sqe->flags |= IOSQE_IO_HARDLINK;
+		session->sending = session->io.wlen;
+		session->pending++;
+		sends++;
+	}
+
+	sqe = get_sqe(&ring);
+	if (sqe == NULL) {
+		// the session never returns to the pool, but the connection closes
+		callbacks->print_err("Could not close connection");
+		COUNTED(close(session->fd));
+		return;
+	}
+	prep_close(sqe, session->fd, get_user_data(session, uop_close));
+	session->pending++;
+}
+
+/**
+ * @brief serve the waiting connections first, then accept again unless the
+ * accept is still armed or the pool is exhausted once more
+ */
+static void resume_accepting(void)
+{
+	out_of_fds = false;
+	open_waiting();
+	if (!accept_armed && callbacks->can_open() && arm_accept() < 0) {
+		callbacks->print_err("Could not resume accepting connections");
+	}
+}
+
+/**
+ * @brief send the responses still buffered or in progress before exiting
+ * @details only sends are completed, no request is handled anymore.
+ * @param sessions the open sessions
+ * @param timeout the time in ms to wait for the sends to complete
+ */
+static void drain_uring(session_t *sessions, int timeout)
+{
+	for (session_t *s = sessions; s != NULL; s = s->next) {
+		if (submit_send(s) < 0) {
+			break;
+		}
+	}
+
+	uint64_t deadline = get_time_ns() / 1000000 + timeout;
+	uint64_t now;
+	while (sends > 0 && (now = get_time_ns() / 1000000) < deadline) {
+		if (submit_uring(&ring, 1, deadline - now) < 0 && errno != ETIME
+			&& errno != EINTR) {
+			return;
+		}
+		struct io_uring_cqe *cqe;
+		while ((cqe = peek_cqe(&ring)) != NULL) {
+			struct io_uring_cqe completion = *cqe;
+			seen_cqe(&ring);
+			if ((completion.user_data & UOP_MASK) == uop_send) {
+				session_t *session =
+					(session_t *)(uintptr_t)(completion.user_data & ~UOP_MASK);
+				complete_send(session, completion.res);
+			}
+		}
+	}
+}
+
+/**
+ * @brief get the user data identifying an operation of the ring
+ * @param session the session of the operation, NULL for the listening
+ * socket
+ * @param op the kind of operation
+ * @return the user data
+ */
+static uint64_t get_user_data(session_t *session, uring_op_t op)
+{
+	return (uintptr_t)session | op;
+}
@@ -21,48 +21,63 @@ static int max(int lh, int rh)
 	return lh > rh ? lh : rh;
 }
 
-static int char_to_int(char c)
+/**
+ * @brief parse a coordinate of the form `C2' and advance the string past it
+ * @param str the string to parse, advanced past the coordinate
+ * @param c the parsed coordinate is stored into this parameter
+ * @param map_size the length of each side of the map
+ * @return 0 on success, -1 if the string holds no coordinate on the map
+ */
+static int parse_coordinate(const char** str, coordinate_t* c, uint8_t map_size)
 {
-	if ('A' <= c && c <= 'z') {
-		return (int)(c - 'A');
-	} else if ('0' <= c && c <= '9') {
-		return (int)(c - '0');
-	} else {
+	int col = 0;
+	int row = 0;
+	int letters = 0;
+	int digits = 0;
+
+	for (; 'A' <= **str && **str <= 'Z' && letters < 2; (*str)++, letters++) {
+		col = col * 26 + (**str - 'A' + 1);
+	}
+	for (; '0' <= **str && **str <= '9' && digits < 2; (*str)++, digits++) {
+		row = row * 10 + (**str - '0');
+	}
+
+	// columns are counted from A = 1, like digits without a zero
+	col--;
+	if (letters == 0 || digits == 0 || col >= map_size || row >= map_size) {
 		return -1;
 	}
+
+	c->col = col;
+	c->row = row;
+	return 0;
 }
 
-ship_t* parse_coordinates(const char* coordinate_str)
+int parse_ship(const char* coordinate_str, ship_t* ship, uint8_t map_size)
 {
-	if (strlen(coordinate_str) != COORDINATE_LEN) {
-		return NULL;
-	}
-
 	// ensure that coordinates always go from small to large
-	int coordinates[COORDINATE_LEN];
-	for (int i = 0; i < COORDINATE_LEN; i++) {
-		coordinates[i] = char_to_int(coordinate_str[i]);
-
-		int x = coordinates[i];
-		if (x < 0 || x > MAP_SIZE - 1) {
-			return NULL;
-		}
+	coordinate_t first;
+	coordinate_t second;
+	if (parse_coordinate(&coordinate_str, &first, map_size) < 0
+		|| parse_coordinate(&coordinate_str, &second, map_size) < 0
+		|| *coordinate_str != '\0') {
+		return -1;
 	}
 
 	coordinate_t begin;
 
-	begin.col = min(coordinates[0], coordinates[2]);
-	begin.row = min(coordinates[1], coordinates[3]);
+	begin.col = min(first.col, second.col);
+	begin.row = min(first.row, second.row);
 
 	coordinate_t end;
 
-	end.col = max(coordinates[0], coordinates[2]);
-	end.row = max(coordinates[1], coordinates[3]);
+	end.col = max(first.col, second.col);
+	end.row = max(first.row, second.row);
 
 
 	if (begin.row != end.row && begin.col != end.col) {
 		// the ship is not contained within 1 row/column
-		return NULL;
+		return -1;
 	}
 
 	int length;
@@ -75,24 +90,38 @@ ship_t* parse_coordinates(const char* coordinate_str)
 		alignment = vertical;
 	} else {
 		// ship has no length
-		return NULL;
+		return -1;
 	}
 
-	if (length < MIN_SHIP_LEN || length > MAX_SHIP_LEN) {
+	if (length < MIN_SHIP_LEN) {
 		// ship's length is invalid
-		return NULL;
+		return -1;
 	}
 
+	ship->begin = begin;
+	ship->end = end;
+	ship->length = length;
+	ship->alignment = alignment;
+	return 0;
+}
 
-	ship_t init = {
-		.begin = begin, .end = end, .length = length, .alignment = alignment};
+int format_ship(const ship_t* ship, char* buf)
+{
+	int n = format_coordinate(ship->begin, buf);
+	return n + format_coordinate(ship->end, buf + n);
+}
 
-	ship_t* ship = (ship_t*)malloc(sizeof(ship_t));
-	if (ship == NULL) {
-		// allocation failed
-		return NULL;
+int format_coordinate(coordinate_t c, char* buf)
+{
+	int n = 0;
+	if (c.col >= 26) {
+		buf[n++] = 'A' + c.col / 26 - 1;
 	}
-
-	memcpy(ship, &init, sizeof(ship_t));
-	return ship;
+	buf[n++] = 'A' + c.col % 26;
+	if (c.row >= 10) {
+		buf[n++] = '0' + c.row / 10;
+	}
+	buf[n++] = '0' + c.row % 10;
+	buf[n] = '\0';
+	return n;
 }
@@ -0,0 +1,418 @@
+/**
+ * @file sim.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-20
+ *
+ * @brief In-process self-play simulator for OSUE exercise 1B `Battleship'.
+ * @details Plays the solver against random fleets without any sockets, spread
+ * over several threads, and reports how many rounds the solver needs.
+ * Optionally every shot is passed through a socketpair, encoded as on the
+ * wire, to measure the cost of the kernel's part of a round.
+ */
+
+// IO, C standard library, POSIX API, data types:
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+// Threads and time:
+#include <pthread.h>
+#include <time.h>
+
+// Sockets:
+#include <sys/types.h>
+#include <sys/socket.h>
+
+#include "../include/common.h"
+#include "../include/map.h"
+#include "../include/ship.h"
+#include "../include/solver.h"
+#include "../include/rng.h"
+#include "../include/fleet.h"
+#include "../include/msg.h"
+#include "../include/codec.h"
+#include "../include/rules.h"
+
+// the work and results of a single simulation thread
+typedef struct
+{
+	pthread_t thread;
+	uint64_t seed;
+	uint64_t games;
+	uint64_t losses;
+	uint64_t *rounds;  // number of games won after n rounds, up to the
+					   // round limit
+} worker_t;
+
+static char *program_name;
+
+static uint64_t game_cnt = 100000;
+static long thread_cnt = 0;
+static uint64_t seed = 0;
+static bool use_socketpair = false;
+static unsigned long budget = 0;  // time per move of the solvers in
+								  // microseconds
+static unsigned long sampler_cnt = 1;  // threads sampling fleets per move
+static rules_t rules;  // the rules of all games
+
+static int parse_args(int argc, char *argv[]);
+static void print_usage(void);
+
+static void *run_worker(void *arg);
+static int play_game(solver_t *solver, map_t *map, const int *fds);
+static int exchange(const int *fds, map_t *map, coordinate_t shot);
+
+static int get_percentile(const uint64_t *rounds, uint64_t won, double p);
+
+int main(int argc, char *argv[])
+{
+	seed = time(NULL) ^ getpid();
+
+	if (parse_args(argc, argv) < 0) {
+		print_usage();
+		return EXIT_FAILURE;
+	}
+
+	if (thread_cnt <= 0) {
+		thread_cnt = sysconf(_SC_NPROCESSORS_ONLN);
+		if (thread_cnt <= 0) {
+			thread_cnt = 1;
+		}
+	}
+
+	// one histogram per worker and the total
+	worker_t *workers = (worker_t *)calloc(thread_cnt, sizeof(worker_t));
+	uint64_t *histograms =
+		(uint64_t *)calloc((thread_cnt + 1) * (rules.max_rounds + 1),
+						   sizeof(uint64_t));
+	if (workers == NULL || histograms == NULL) {
+		fprintf(stderr, "%s: Could not allocate workers\n", program_name);
+		return EXIT_FAILURE;
+	}
+
+	double start = get_time_ns() / 1e9;
+
+	long started = 0;
+	for (long i = 0; i < thread_cnt; i++) {
+		workers[i].seed = seed + i;
+		workers[i].rounds = histograms + (i + 1) * (rules.max_rounds + 1);
+		workers[i].games =
+			game_cnt / thread_cnt + ((uint64_t)i < game_cnt % thread_cnt);
+
+		int res = pthread_create(
+			&workers[i].thread, NULL, run_worker, &workers[i]);
+		if (res != 0) {
+			fprintf(stderr, "%s: Could not start thread\n", program_name);
+			fprintf(stderr, "\t%s\n", strerror(res));
+			break;
+		}
+		started++;
+	}
+
+	uint64_t games = 0;
+	uint64_t losses = 0;
+	uint64_t *rounds = histograms;
+	for (long i = 0; i < started; i++) {
+		pthread_join(workers[i].thread, NULL);
+		games += workers[i].games;
+		losses += workers[i].losses;
+		for (int r = 0; r <= rules.max_rounds; r++) {
+			rounds[r] += workers[i].rounds[r];
+		}
+	}
+
+	double elapsed = get_time_ns() / 1e9 - start;
+	free(workers);
+
+	if (started < thread_cnt) {
+		free(histograms);
+		return EXIT_FAILURE;
+	}
+
+	uint64_t won = games - losses;
+	double sum = 0;
+	for (int r = 0; r <= rules.max_rounds; r++) {
+		sum += (double)r * rounds[r];
+	}
+
+	char line[RULES_LINE_LEN];
+	format_rules(&rules, line);
+	printf("games:   %llu (%ld threads, seed %llu, rules %s%s, budget %lu "
+		   "us x %lu)\n",
+		   (unsigned long long)games,
+		   thread_cnt,
+		   (unsigned long long)seed,
+		   line,
+		   use_socketpair ? ", socketpair" : "",
+		   budget,
+		   sampler_cnt);
+	if (won > 0) {
+		printf("mean:    %.2f rounds\n", sum / won);
+		printf("median:  %d rounds\n", get_percentile(rounds, won, 0.5));
+		printf("p99:     %d rounds\n", get_percentile(rounds, won, 0.99));
+	}
+	printf("lost:    %llu (%.4f%%)\n",
+		   (unsigned long long)losses,
+		   games > 0 ? 100.0 * losses / games : 0.0);
+	printf("elapsed: %.3f s\n", elapsed);
+	printf("games/s: %.0f\n", elapsed > 0 ? games / elapsed : 0.0);
+
+	free(histograms);
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Parses the program command line options
+ * @param argc the argument counter, length of argv
+ * @param argv an array of arguments
+ * @return 0 on success, -1 on failure
+ */
+static int parse_args(int argc, char *argv[])
+{
+	program_name = argv[0];
+
+	const char *rules_str = CLASSIC_RULES;
+	int arg_c;
+	char *end;
+	while ((arg_c = getopt(argc, argv, "n:t:s:R:Sb:j:")) != EOF) {
+		switch (arg_c) {
+			case 'n':
+				errno = 0;
+				game_cnt = strtoull(optarg, &end, 10);
+				if (errno != 0 || *end != '\0' || game_cnt == 0) {
+					return -1;
+				}
+				break;
+			case 't':
+				errno = 0;
+				thread_cnt = strtol(optarg, &end, 10);
+				if (errno != 0 || *end != '\0' || thread_cnt <= 0) {
+					return -1;
+				}
+				break;
+			case 's':
+				errno = 0;
+				seed = strtoull(optarg, &end, 10);
+				if (errno != 0 || *end != '\0') {
+					return -1;
+				}
+				break;
+			case 'R':
+				rules_str = optarg;
+				break;
+			case 'S':
+				use_socketpair = true;
+				break;
+			case 'b':
+				errno = 0;
+				budget = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0' || budget > UINT32_MAX) {
+					return -1;
+				}
+				break;
+			case 'j':
+				errno = 0;
+				sampler_cnt = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0' || sampler_cnt == 0
+					|| sampler_cnt > MAX_SAMPLERS) {
+					return -1;
+				}
+				break;
+			default:
+				return -1;
+		}
+	}
+
+	if (argc - optind >= 1) {
+		return -1;
+	}
+
+	if (parse_rules(rules_str, &rules) < 0) {
+		fprintf(stderr, "%s: Invalid rules %s\n", program_name, rules_str);
+		return -1;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Print the usage message to stdout
+ */
+static void print_usage(void)
+{
+	printf("\nUsage:\n");
+	printf(
+		"\tsim [-n GAMES] [-t THREADS] [-s SEED] [-R RULES] [-S] "
+		"[-b MICROSECONDS [-j THREADS]]\n");
+	printf("\n\t-n\tthe number of games to play. Defaults to 100000\n");
+	printf("\n\t-t\tthe number of threads. Defaults to the number of cores\n");
+	printf("\n\t-s\tthe seed for the random fleets and solvers\n");
+	printf(
+		"\n\t-R\tthe rules of the games, the map size followed by the "
+		"number of ships of each length. Defaults to %s\n",
+		CLASSIC_RULES);
+	printf(
+		"\n\t-S\tsend every shot and report through a socketpair like "
+		"client and server would\n");
+	printf(
+		"\n\t-b\tthe time budget of the solvers per move, see client -b. "
+		"Defaults to 0\n");
+	printf(
+		"\n\t-j\tthe threads sampling fleets for each move of a solver, see "
+		"client -j. Defaults to 1\n");
+	printf("\nexample:\n");
+	printf("\tsim -n 1000000 -t 4 -s 42\n");
+	printf("\tsim -R 32:8x2,6x3,4x4,2x5,1x6\n");
+	printf("\tsim -n 1000 -b 200\n");
+}
+
+/**
+ * @brief play the configured number of games of a worker
+ * @param arg the worker_t to run
+ * @return NULL
+ */
+static void *run_worker(void *arg)
+{
+	worker_t *worker = (worker_t *)arg;
+
+	// the fleets and the solver draw from independent generators
+	rng_t rng;
+	seed_rng(&rng, ~worker->seed);
+	solver_t *solver = get_solver(&rules, worker->seed);
+	map_t *map = get_map(&rules);
+	placements_t placements;
+	fleet_t fleet;
+	if (solver == NULL || set_budget(solver, budget, sampler_cnt) < 0
+		|| map == NULL || init_placements(&placements, &rules) < 0
+		|| init_fleet(&fleet, &rules) < 0) {
+		fprintf(stderr, "%s: Could not create game\n", program_name);
+		exit(EXIT_FAILURE);
+	}
+
+	int fds[2] = {-1, -1};
+	if (use_socketpair && socketpair(AF_UNIX, SOCK_STREAM, 0, fds) < 0) {
+		fprintf(stderr, "%s: Could not create socketpair\n", program_name);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		exit(EXIT_FAILURE);
+	}
+
+	for (uint64_t g = 0; g < worker->games; g++) {
+		clear_map(map);
+		if (random_fleet(&fleet, &rules, &placements, FLEET_ATTEMPTS, &rng)
+			< 0) {
+			fprintf(stderr, "%s: No fleet fits the rules\n", program_name);
+			exit(EXIT_FAILURE);
+		}
+		place_fleet(map, &fleet);
+		reset_solver(solver);
+
+		int rounds = play_game(solver, map, use_socketpair ? fds : NULL);
+		if (rounds < 0) {
+			worker->losses++;
+		} else {
+			worker->rounds[rounds]++;
+		}
+	}
+
+	if (use_socketpair) {
+		close(fds[0]);
+		close(fds[1]);
+	}
+	free_map(map);
+	free_fleet(&fleet);
+	free_placements(&placements);
+	free_solver(solver);
+	return NULL;
+}
+
+/**
+ * @brief let the solver play a single game on the given map
+ * @param solver a freshly reset solver
+ * @param map the map holding the fleet to sink
+ * @param fds a connected socketpair to pass the messages through, NULL to
+ * shoot directly
+ * @return the number of rounds needed to win, -1 if the game was lost
+ */
+static int play_game(solver_t *solver, map_t *map, const int *fds)
+{
+	coordinate_t shot = invalid_coordinate;
+	hit_report_t report = report_no_hit;
+
+	for (int round = 1; round <= rules.max_rounds; round++) {
+		shot = next_move(solver, shot, report);
+		if (fds != NULL) {
+			int res = exchange(fds, map, shot);
+			if (res < 0) {
+				fprintf(stderr, "%s: Could not exchange messages\n", program_name);
+				exit(EXIT_FAILURE);
+			}
+			report = res;
+		} else {
+			report = shoot(map, shot);
+		}
+		if (report == report_last_sunk) {
+			return round;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * @brief play a single round over a socketpair
+ * @details the client's end sends the encoded shot, the server's end decodes
+ * it, shoots and sends the encoded report back. Both messages fit into the
+ * socket buffers, so a single thread can play both ends.
+ * @param fds the client's and the server's end of the socketpair
+ * @param map the map holding the fleet
+ * @param shot the coordinate to shoot at
+ * @return the hit report received by the client, -1 on failure
+ */
+static int exchange(const int *fds, map_t *map, coordinate_t shot)
+{
+	client_msg_t request = get_shot_msg(shot);
+	uint8_t buf[REQUEST_LEN];
+	encode_requests(&request, 1, buf);
+	if (write(fds[0], buf, sizeof(buf)) != sizeof(buf)
+		|| read(fds[1], buf, sizeof(buf)) != sizeof(buf)) {
+		return -1;
+	}
+
+	if (check_requests(buf, 1) < 1) {
+		return -1;
+	}
+	decode_requests(buf, 1, &request);
+
+	server_msg_t response =
+		game_ongoing | shoot(map, get_coordinates(request));
+	if (write(fds[1], &response, sizeof(response)) != sizeof(response)
+		|| read(fds[0], &response, sizeof(response)) != sizeof(response)) {
+		return -1;
+	}
+
+	return get_hit_report(response);
+}
+
+/**
+ * @brief find the number of rounds below which the given share of won games
+ * lies
+ * @param rounds the histogram of won games per round count
+ * @param won the total number of won games
+ * @param p the share, between 0 and 1
+ * @return the number of rounds of the percentile
+ */
+static int get_percentile(const uint64_t *rounds, uint64_t won, double p)
+{
+	uint64_t count = 0;
+	for (int r = 0; r <= rules.max_rounds; r++) {
+		count += rounds[r];
+		if (count >= p * won) {
+			return r;
+		}
+	}
+	return rules.max_rounds;
+}
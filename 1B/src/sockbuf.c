@@ -0,0 +1,189 @@
+/**
+ * @file sockbuf.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief Buffered socket I/O for OSUE exercise 1B `Battleship'.
+ */
+#include <string.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include "../include/sockbuf.h"
+
+static int set_tcp_option(int fd, int option, bool enable);
+
+void init_sockbuf(sockbuf_t *sb, int fd)
+{
+	sb->fd = fd;
+	sb->rpos = 0;
+	sb->rlen = 0;
+	sb->wlen = 0;
+	sb->syscalls = 0;
+}
+
+int set_nodelay(int fd, bool enable)
+{
+	return set_tcp_option(fd, TCP_NODELAY, enable);
+}
+
+int set_cork(int fd, bool enable)
+{
+	return set_tcp_option(fd, TCP_CORK, enable);
+}
+
+ssize_t fill_sockbuf(sockbuf_t *sb)
+{
+	if (sb->rpos > 0) {
+		memmove(sb->rbuf, sb->rbuf + sb->rpos, sb->rlen - sb->rpos);
+		sb->rlen -= sb->rpos;
+		sb->rpos = 0;
+	}
+	if (sb->rlen == SOCKBUF_LEN) {
+		errno = ENOBUFS;
+		return -1;
+	}
+
+	sb->syscalls++;
+	ssize_t n = recv(sb->fd, sb->rbuf + sb->rlen, SOCKBUF_LEN - sb->rlen, 0);
+	if (n > 0) {
+		sb->rlen += n;
+	}
+	return n;
+}
+
+int read_sockbuf(sockbuf_t *sb, void *buf, size_t len)
+{
+	if (flush_sockbuf(sb) < 0) {
+		return -1;
+	}
+
+	while (sb->rlen - sb->rpos < len) {
+		ssize_t n = fill_sockbuf(sb);
+		if (n < 0 && errno == EINTR) {
+			continue;
+		}
+		if (n <= 0) {
+			return -1;
+		}
+	}
+
+	memcpy(buf, sb->rbuf + sb->rpos, len);
+	sb->rpos += len;
+	return 0;
+}
+
+int append_sockbuf(sockbuf_t *sb, const void *buf, size_t len)
+{
+	if (sb->rpos > 0) {
+		memmove(sb->rbuf, sb->rbuf + sb->rpos, sb->rlen - sb->rpos);
+		sb->rlen -= sb->rpos;
+		sb->rpos = 0;
+	}
+	if (len > (size_t)(SOCKBUF_LEN - sb->rlen)) {
+		errno = ENOBUFS;
+		return -1;
+	}
+
+	memcpy(sb->rbuf + sb->rlen, buf, len);
+	sb->rlen += len;
+	return 0;
+}
+
+const uint8_t *peek_sockbuf(const sockbuf_t *sb, size_t *len)
+{
+	*len = sb->rlen - sb->rpos;
+	return sb->rbuf + sb->rpos;
+}
+
+void consume_sockbuf(sockbuf_t *sb, size_t len)
+{
+	sb->rpos += len;
+	if (sb->rpos == sb->rlen) {
+		sb->rpos = 0;
+		sb->rlen = 0;
+	}
+}
+
+size_t get_sockbuf_space(const sockbuf_t *sb)
+{
+	return SOCKBUF_LEN - sb->wlen;
+}
+
+int write_sockbuf(sockbuf_t *sb, const void *buf, size_t len)
+{
+	const uint8_t *data = buf;
+
+	while (len > SOCKBUF_LEN - sb->wlen) {
+		// sendmsg() is writev() with flags, a closed peer must not raise
+		// SIGPIPE
+		struct iovec iov[2] = {{.iov_base = sb->wbuf, .iov_len = sb->wlen},
+							   {.iov_base = (void *)data, .iov_len = len}};
+		struct msghdr msg;
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = iov;
+		msg.msg_iovlen = 2;
+
+		sb->syscalls++;
+		ssize_t n = sendmsg(sb->fd, &msg, MSG_NOSIGNAL);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return -1;
+		}
+
+		size_t buffered = (size_t)n < sb->wlen ? (size_t)n : sb->wlen;
+		drop_sockbuf(sb, buffered);
+		data += n - buffered;
+		len -= n - buffered;
+	}
+
+	memcpy(sb->wbuf + sb->wlen, data, len);
+	sb->wlen += len;
+	return 0;
+}
+
+void drop_sockbuf(sockbuf_t *sb, size_t len)
+{
+	memmove(sb->wbuf, sb->wbuf + len, sb->wlen - len);
+	sb->wlen -= len;
+}
+
+ssize_t flush_sockbuf(sockbuf_t *sb)
+{
+	while (sb->wlen > 0) {
+		sb->syscalls++;
+		ssize_t n = send(sb->fd, sb->wbuf, sb->wlen, MSG_NOSIGNAL);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				break;
+			}
+			return -1;
+		}
+		drop_sockbuf(sb, n);
+	}
+	return sb->wlen;
+}
+
+/**
+ * @brief set a boolean option of a TCP socket
+ * @param fd the socket
+ * @param option the option, e.g. TCP_NODELAY
+ * @param enable the new value of the option
+ * @return 0 on success or if the socket does not use TCP, -1 on failure
+ */
+static int set_tcp_option(int fd, int option, bool enable)
+{
+	int value = enable;
+	if (setsockopt(fd, IPPROTO_TCP, option, &value, sizeof(value)) < 0) {
+		return errno == EOPNOTSUPP || errno == ENOPROTOOPT ? 0 : -1;
+	}
+	return 0;
+}
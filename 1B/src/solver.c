@@ -1,133 +1,282 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
-#include <time.h>
+#include <string.h>
 
 #include "../include/solver.h"
 #include "../include/map.h"
 #include "../include/deque.h"
+#include "../include/endgame.h"
 
 const direction_t up = {.d_row = -1, .d_col = 0};
 const direction_t down = {.d_row = 1, .d_col = 0};
 const direction_t left = {.d_row = 0, .d_col = -1};
 const direction_t right = {.d_row = 0, .d_col = 1};
 
-static map_t* map;
-static deque_t* target_queue;
-static deque_t* hit_queue;
-static uint8_t ship_counts[] = {0,
-								0,
-								SHIP_CNT_LEN2,
-								SHIP_CNT_LEN3,
-								SHIP_CNT_LEN4};
+static int8_t add_targets(solver_t* solver, coordinate_t coordinate);
 
-static bool scan_mode = true;
-
-static int8_t add_targets(coordinate_t coordinate);
-
-static coordinate_t get_random_coordinate(void);
+static coordinate_t get_random_coordinate(solver_t* solver);
+static coordinate_t get_likely_coordinate(solver_t* solver);
+static coordinate_t get_endgame_coordinate(solver_t* solver);
+static coordinate_t get_dense_coordinate(solver_t* solver,
+										 const candidate_set_t* set,
+										 uint8_t k);
 static coordinate_t get_sink_coordinate(
+	solver_t* solver,
 	coordinate_t coordinate,
 	hit_report_t hit_report);
 
-static void mark_surroundings(ship_t ship);
-static ship_t get_ship_at(coordinate_t coordinate);
+static void mark_surroundings(solver_t* solver, ship_t ship);
+static ship_t get_ship_at(const solver_t* solver, coordinate_t coordinate);
 
 static coordinate_t add_direction(coordinate_t c, direction_t d);
-static alignment_t get_alignment(coordinate_t c1, coordinate_t c2);
 
-static uint8_t get_max_size(void);
-static uint8_t get_min_size(void);
+static uint8_t get_max_size(const solver_t* solver);
+static uint8_t get_min_size(const solver_t* solver);
+
+static void set_hit(solver_t* solver, hit_t value, coordinate_t coordinate);
+static int init_budget(solver_t* solver,
+					   uint32_t budget,
+					   uint16_t threads,
+					   density_t* shared);
+static int init_candidates(solver_t* solver);
+static void fill_candidates(solver_t* solver);
+static void reset_candidates(solver_t* solver);
+
+solver_t* get_solver(const rules_t* rules, uint64_t seed)
+{
+	solver_t* solver = (solver_t*)calloc(1, sizeof(solver_t));
+	if (solver == NULL) {
+		return NULL;
+	}
+	solver->rules = *rules;
+
+	// a hit adds at most four targets and a ship takes at most its length in
+	// hits before it is sunk
+	size_t capacity = 4 * (rules->max_ship_len + 1);
+	solver->map = get_map(rules);
+	if (solver->map == NULL || init_candidates(solver) < 0
+		|| init_deque(&solver->target_queue, capacity) < 0
+		|| init_deque(&solver->hit_queue, capacity) < 0) {
+		free_solver(solver);
+		return NULL;
+	}
+
+	seed_rng(&solver->rng, seed);
+	reset_solver(solver);
+	return solver;
+}
 
-void init_solver(void)
+void reset_solver(solver_t* solver)
 {
-	srand(time(NULL));
-	map = get_map();
-	target_queue = get_deque();
-	hit_queue = get_deque();
+	reset_map(solver->map);
+
+	clear(&solver->target_queue);
+	clear(&solver->hit_queue);
+
+	memcpy(solver->ship_counts,
+		   solver->rules.ship_counts,
+		   sizeof(solver->ship_counts));
+	solver->endgame = is_endgame(solver->ship_counts);
+
+	solver->scan_mode = true;
+	memset(solver->sunk.rows, 0, sizeof(solver->sunk.rows));
+
+	reset_candidates(solver);
 }
 
-void free_solver(void)
+int set_prior(solver_t* solver, const heatmap_t* heatmap)
 {
-	if (map != NULL) {
-		free(map);
+	free(solver->prior);
+	solver->prior = NULL;
+	if (heatmap == NULL) {
+		return 0;
+	}
+
+	uint8_t map_size = solver->rules.map_size;
+	if (heatmap->header->map_size != map_size) {
+		return -1;
+	}
+
+	size_t squares = map_size * map_size;
+	uint32_t max = 0;
+	for (size_t i = 0; i < squares; i++) {
+		if (heatmap->counts[i] > max) {
+			max = heatmap->counts[i];
+		}
 	}
 
-	if (target_queue != NULL) {
-		free(target_queue);
+	solver->prior = malloc(squares);
+	if (solver->prior == NULL) {
+		return -1;
 	}
+	for (size_t i = 0; i < squares; i++) {
+		solver->prior[i] =
+			(uint64_t)heatmap->counts[i] * PRIOR_LEVELS / ((uint64_t)max + 1);
+	}
+	return 0;
+}
+
+int set_budget(solver_t* solver, uint32_t budget, uint16_t threads)
+{
+	return init_budget(solver, budget, threads, NULL);
+}
+
+int share_budget(solver_t* solver, solver_t* other)
+{
+	return init_budget(solver, other->budget, 0, other->density);
+}
 
-	if (hit_queue != NULL) {
-		free(hit_queue);
+/**
+ * @brief replace the workspace of the budgeted moves of a solver
+ * @param solver the solver to configure
+ * @param budget the time per move in microseconds, 0 for none
+ * @param threads the number of threads sampling fleets
+ * @param shared the workspace whose threads to sample on, NULL to start new
+ * ones
+ * @return 0 on success, -1 if allocating failed
+ */
+static int init_budget(solver_t* solver,
+					   uint32_t budget,
+					   uint16_t threads,
+					   density_t* shared)
+{
+	if (solver->density != NULL) {
+		free_density(solver->density);
+		free(solver->density);
+		solver->density = NULL;
+	}
+	solver->budget = 0;
+	if (budget == 0) {
+		return 0;
 	}
+
+	solver->density = malloc(sizeof(density_t));
+	if (solver->density == NULL
+		|| init_density(solver->density, &solver->rules, threads, shared) < 0) {
+		free(solver->density);
+		solver->density = NULL;
+		return -1;
+	}
+	solver->budget = budget;
+	return 0;
 }
 
-coordinate_t next_move(coordinate_t coordinate, hit_report_t hit_report)
+void free_solver(solver_t* solver)
 {
+	if (solver == NULL) {
+		return;
+	}
 
-	if (!check_coordinate(coordinate)) {
-		return get_random_coordinate();
+	free_map(solver->map);
+	free_deque(&solver->target_queue);
+	free_deque(&solver->hit_queue);
+	free(solver->candidates);
+	free(solver->storage);
+	free(solver->prior);
+	if (solver->density != NULL) {
+		free_density(solver->density);
+		free(solver->density);
+	}
+	free(solver);
+}
+
+coordinate_t next_move(
+	solver_t* solver,
+	coordinate_t coordinate,
+	hit_report_t hit_report)
+{
+	if (!check_coordinate(coordinate, solver->map->map_size)) {
+		return get_random_coordinate(solver);
 	}
 
 	switch (hit_report) {
 		case report_hit:
-			put_hit(map, hit, coordinate);
-			scan_mode = false;
-			if (add_targets(coordinate) < 0) {
+			set_hit(solver, hit, coordinate);
+			solver->scan_mode = false;
+			if (add_targets(solver, coordinate) < 0) {
 				debug_print("%s\n", "Could not add targets");
 				exit(EXIT_FAILURE);
 			}
-			if (push_front(hit_queue, coordinate) < 0) {
+			if (push_front(&solver->hit_queue, coordinate) < 0) {
 				debug_print("%s\n", "Could not add hit");
 				exit(EXIT_FAILURE);
 			}
 			break;
 		case report_no_hit:
-			put_hit(map, miss, coordinate);
+			set_hit(solver, miss, coordinate);
 			break;
 		case report_sunk:
 			// fallthrough
 		case report_last_sunk:
-			put_hit(map, hit, coordinate);
-			ship_t ship = get_ship_at(coordinate);
-			ship_counts[ship.length]--;
-			mark_surroundings(ship);
-			clear(target_queue);
-			clear(hit_queue);
-			scan_mode = true;
+			set_hit(solver, hit, coordinate);
+			ship_t ship = get_ship_at(solver, coordinate);
+			solver->ship_counts[ship.length]--;
+			solver->endgame = is_endgame(solver->ship_counts);
+			placement_t p;
+			make_placement(&ship, solver->map->map_size, &p);
+			for (int i = 0; i < p.rows; i++) {
+				solver->sunk.rows[ship.begin.row + i] |= p.mask;
+			}
+			mark_surroundings(solver, ship);
+			clear(&solver->target_queue);
+			clear(&solver->hit_queue);
+			solver->scan_mode = true;
 			break;
 	}
 
-	if (scan_mode) {
-		return get_random_coordinate();
+	// the hits are only looked at once the table covers the remaining ships
+	if (!solver->scan_mode && solver->endgame) {
+		coordinate_t c = get_endgame_coordinate(solver);
+		if (check_coordinate(c, solver->map->map_size)) {
+			// the table accounts for the targets around the hits
+			clear(&solver->target_queue);
+			return c;
+		}
+	}
+
+	if (solver->budget > 0) {
+		coordinate_t c = get_likely_coordinate(solver);
+		if (check_coordinate(c, solver->map->map_size)) {
+			// the density accounts for the targets around the hits
+			clear(&solver->target_queue);
+			return c;
+		}
+	}
+
+	if (solver->scan_mode) {
+		return get_random_coordinate(solver);
 	} else {
-		return get_sink_coordinate(coordinate, hit_report);
+		return get_sink_coordinate(solver, coordinate, hit_report);
 	}
 }
 
-static int8_t add_targets(coordinate_t coordinate)
+static int8_t add_targets(solver_t* solver, coordinate_t coordinate)
 {
+	const map_t* map = solver->map;
+	uint8_t size = map->map_size;
+	deque_t* target_queue = &solver->target_queue;
 	coordinate_t c;
 	c = add_direction(coordinate, up);
-	if (check_coordinate(c) && get_hit(map, c) == unknown) {
+	if (check_coordinate(c, size) && get_hit(map, c) == unknown) {
 		if (push_front(target_queue, c) < 0) {
 			return -1;
 		}
 	}
 	c = add_direction(coordinate, down);
-	if (check_coordinate(c) && get_hit(map, c) == unknown) {
+	if (check_coordinate(c, size) && get_hit(map, c) == unknown) {
 		if (push_front(target_queue, c) < 0) {
 			return -1;
 		}
 	}
 	c = add_direction(coordinate, left);
-	if (check_coordinate(c) && get_hit(map, c) == unknown) {
+	if (check_coordinate(c, size) && get_hit(map, c) == unknown) {
 		if (push_front(target_queue, c) < 0) {
 			return -1;
 		}
 	}
 	c = add_direction(coordinate, right);
-	if (check_coordinate(c) && get_hit(map, c) == unknown) {
+	if (check_coordinate(c, size) && get_hit(map, c) == unknown) {
 		if (push_front(target_queue, c) < 0) {
 			return -1;
 		}
@@ -135,105 +284,73 @@ static int8_t add_targets(coordinate_t coordinate)
 	return 0;
 }
 
-static ship_t get_ship_at(coordinate_t coordinate)
+static ship_t get_ship_at(const solver_t* solver, coordinate_t coordinate)
 {
+	const map_t* map = solver->map;
+	uint8_t size = map->map_size;
 
-	uint8_t size = 0;
-	alignment_t alignment;
-	coordinate_t begin = coordinate;
-	coordinate_t end = coordinate;
+	alignment_t alignment = horizontal;
+	const direction_t* back = &left;
+	const direction_t* forward = &right;
 
-	begin.row--;
-	end.row++;
-
-	if (!check_coordinate(begin)) {
-		begin = end;
-	} else if (!check_coordinate(end)) {
-		begin = end;
-	}
-
-	if (get_hit(map, begin) == hit || get_hit(map, end) == hit) {
+	coordinate_t c1 = add_direction(coordinate, up);
+	coordinate_t c2 = add_direction(coordinate, down);
+	if ((check_coordinate(c1, size) && get_hit(map, c1) == hit)
+		|| (check_coordinate(c2, size) && get_hit(map, c2) == hit)) {
 		alignment = vertical;
-	} else {
-		alignment = horizontal;
-	}
-
-	if (alignment == vertical) {
-		while (true) {
-			if (check_coordinate(begin)) {
-				if (get_hit(map, begin) == hit) {
-					begin.row--;
-				} else {
-					begin.row++;
-					break;
-				}
-			} else {
-				begin.row++;
-				break;
-			}
-		}
+		back = &up;
+		forward = &down;
+	}
 
-		end = begin;
+	coordinate_t begin = coordinate;
+	coordinate_t c = add_direction(begin, *back);
+	while (check_coordinate(c, size) && get_hit(map, c) == hit) {
+		begin = c;
+		c = add_direction(c, *back);
+	}
 
-		do {
-			size++;
-			end.row++;
-		} while (get_hit(map, end) == hit);
-		ship_t ship = {
-			.begin = begin, .end = end, .length = size, .alignment = alignment};
-		return ship;
-	} else {
-		while (true) {
-			if (check_coordinate(begin)) {
-				if (get_hit(map, begin) == hit) {
-					begin.col--;
-				} else {
-					begin.col++;
-					break;
-				}
-			} else {
-				begin.col++;
-				break;
-			}
-		}
+	coordinate_t end = coordinate;
+	c = add_direction(end, *forward);
+	while (check_coordinate(c, size) && get_hit(map, c) == hit) {
+		end = c;
+		c = add_direction(c, *forward);
+	}
 
-		end = begin;
+	uint8_t length = alignment == vertical ? end.row - begin.row + 1
+										   : end.col - begin.col + 1;
 
-		do {
-			size++;
-			end.col++;
-		} while (get_hit(map, end) == hit);
-		ship_t ship = {
-			.begin = begin, .end = end, .length = size, .alignment = alignment};
-		return ship;
-	}
+	ship_t ship = {
+		.begin = begin, .end = end, .length = length, .alignment = alignment};
+	return ship;
 }
 
-static void mark_surroundings(ship_t ship)
+static void mark_surroundings(solver_t* solver, ship_t ship)
 {
+	uint8_t size = solver->map->map_size;
 	if (ship.alignment == horizontal) {
 		coordinate_t left = ship.begin;
 		left.col--;
 		coordinate_t right = ship.end;
 		right.col++;
 
-		if (check_coordinate(left)) {
-			put_hit(map, miss, left);
+		if (check_coordinate(left, size)) {
+			set_hit(solver, miss, left);
 		}
-		if (check_coordinate(right)) {
-			put_hit(map, miss, right);
+		if (check_coordinate(right, size)) {
+			set_hit(solver, miss, right);
 		}
 
-		coordinate_t up = ship.begin;
+		// include the diagonal neighbors of both ends
+		coordinate_t up = left;
 		up.row--;
-		coordinate_t down = ship.begin;
+		coordinate_t down = left;
 		down.row++;
-		for (int i = 0; i < ship.length; i++) {
-			if (check_coordinate(up)) {
-				put_hit(map, miss, up);
+		for (int i = 0; i < ship.length + 2; i++) {
+			if (check_coordinate(up, size)) {
+				set_hit(solver, miss, up);
 			}
-			if (check_coordinate(down)) {
-				put_hit(map, miss, down);
+			if (check_coordinate(down, size)) {
+				set_hit(solver, miss, down);
 			}
 			up.col++;
 			down.col++;
@@ -244,23 +361,24 @@ static void mark_surroundings(ship_t ship)
 		coordinate_t down = ship.end;
 		down.row++;
 
-		if (check_coordinate(up)) {
-			put_hit(map, miss, up);
+		if (check_coordinate(up, size)) {
+			set_hit(solver, miss, up);
 		}
-		if (check_coordinate(down)) {
-			put_hit(map, miss, down);
+		if (check_coordinate(down, size)) {
+			set_hit(solver, miss, down);
 		}
 
-		coordinate_t left = ship.begin;
+		// include the diagonal neighbors of both ends
+		coordinate_t left = up;
 		left.col--;
-		coordinate_t right = ship.begin;
+		coordinate_t right = up;
 		right.col++;
-		for (int i = 0; i < ship.length; i++) {
-			if (check_coordinate(left)) {
-				put_hit(map, miss, left);
+		for (int i = 0; i < ship.length + 2; i++) {
+			if (check_coordinate(left, size)) {
+				set_hit(solver, miss, left);
 			}
-			if (check_coordinate(right)) {
-				put_hit(map, miss, right);
+			if (check_coordinate(right, size)) {
+				set_hit(solver, miss, right);
 			}
 			left.row++;
 			right.row++;
@@ -268,75 +386,218 @@ static void mark_surroundings(ship_t ship)
 	}
 }
 
-static coordinate_t get_random_coordinate(void)
+static coordinate_t get_random_coordinate(solver_t* solver)
 {
-	uint8_t parity = get_min_size();
-	coordinate_t c;
+	uint8_t parity = get_min_size(solver);
+	if (parity == 0) {
+		// all ships are sunk, any square will do
+		parity = solver->rules.min_ship_len;
+	}
 
-	do {
-		uint8_t limit = 10;
-		do {
-			c.row = rand() % 10;
-			c.col = rand() % 10;
-			limit--;
-		} while ((c.col + c.row) % parity == 0 && limit > 0);
+	// every ship of at least the parity's length covers a square of each
+	// class, so firing into the smallest remaining class finds them fastest
+	const candidate_set_t* set =
+		&solver->candidates[solver->set_index[parity]];
+	int best = -1;
+	for (int k = 0; k < parity; k++) {
+		if (set->size[k] > 0 && (best < 0 || set->size[k] < set->size[best])) {
+			best = k;
+		}
+	}
 
-	} while (get_hit(map, c) != unknown);
+	if (best < 0) {
+		debug_print("%s\n", "No unknown squares left");
+		return invalid_coordinate;
+	}
 
-	return c;
+	if (solver->prior != NULL) {
+		return get_dense_coordinate(solver, set, best);
+	}
+	return set->cells[set->start[best]
+					  + random_below(&solver->rng, set->size[best])];
+}
+
+/**
+ * @brief pick a random square among the densest ones of a class by the prior
+ * @param solver the solver, which has a prior
+ * @param set the candidate set
+ * @param k the class, which holds unknown squares
+ * @return the square to fire at
+ */
+static coordinate_t get_dense_coordinate(solver_t* solver,
+										 const candidate_set_t* set,
+										 uint8_t k)
+{
+	uint8_t map_size = solver->map->map_size;
+	coordinate_t pick = invalid_coordinate;
+	int level = -1;
+	uint32_t ties = 0;
+
+	for (uint16_t i = set->start[k]; i < set->start[k] + set->size[k]; i++) {
+		coordinate_t c = set->cells[i];
+		int l = solver->prior[c.row * map_size + c.col];
+		if (l > level) {
+			level = l;
+			pick = c;
+			ties = 1;
+		} else if (l == level && random_below(&solver->rng, ++ties) == 0) {
+			// every square of the level is kept with the same probability
+			pick = c;
+		}
+	}
+	return pick;
+}
+
+/**
+ * @brief pick the unknown square covered by the most consistent fleets found
+ * within the solver's budget, ties are broken at random
+ * @param solver the solver, which has a budget
+ * @return the square to fire at, invalid_coordinate if no fleet was found
+ */
+static coordinate_t get_likely_coordinate(solver_t* solver)
+{
+	const map_t* map = solver->map;
+	uint8_t map_size = map->map_size;
+	bitboard_t blocked = solver->sunk;
+	bitboard_t hits;
+	memset(hits.rows, 0, sizeof(hits.rows));
+
+	for (int row = 0; row < map_size; row++) {
+		for (int col = 0; col < map_size; col++) {
+			coordinate_t c = {.row = row, .col = col};
+			hit_t h = get_hit(map, c);
+			if (h == miss) {
+				blocked.rows[row] |= UINT64_C(1) << col;
+			} else if (h == hit) {
+				hits.rows[row] |= UINT64_C(1) << col;
+			}
+		}
+		hits.rows[row] &= ~solver->sunk.rows[row];
+	}
+
+	density_t* density = solver->density;
+	estimate_density(density,
+					 &blocked,
+					 &hits,
+					 solver->ship_counts,
+					 &solver->rng,
+					 solver->budget);
+
+	coordinate_t pick = invalid_coordinate;
+	uint32_t best = 0;
+	uint32_t ties = 0;
+	for (int row = 0; row < map_size; row++) {
+		for (int col = 0; col < map_size; col++) {
+			coordinate_t c = {.row = row, .col = col};
+			uint32_t count = density->counts[row * map_size + col];
+			if (count == 0 || get_hit(map, c) != unknown || count < best) {
+				continue;
+			}
+			if (count > best) {
+				best = count;
+				pick = c;
+				ties = 1;
+			} else if (random_below(&solver->rng, ++ties) == 0) {
+				pick = c;
+			}
+		}
+	}
+	return pick;
+}
+
+/**
+ * @brief look up the next shot at the ship being sunk in the endgame table
+ * @param solver the solver, which is sinking a ship in an endgame
+ * @return the square to fire at, invalid_coordinate if the game is not in an
+ * endgame state
+ */
+static coordinate_t get_endgame_coordinate(solver_t* solver)
+{
+	const map_t* map = solver->map;
+	uint8_t size = map->map_size;
+	if (solver->hit_queue.size == 0) {
+		return invalid_coordinate;
+	}
+
+	// a single hit may continue in any direction, a line only at its ends
+	ship_t cluster = get_ship_at(solver, peek_front(&solver->hit_queue));
+	const direction_t* dirs[ENDGAME_DIRS] = {&up, &down, &left, &right};
+	coordinate_t from[ENDGAME_DIRS] = {
+		cluster.begin, cluster.end, cluster.begin, cluster.end};
+	if (cluster.length > 1 && cluster.alignment == horizontal) {
+		dirs[0] = &left;
+		dirs[1] = &right;
+	}
+
+	uint8_t runs[ENDGAME_DIRS] = {0};
+	int dir_cnt = cluster.length == 1 ? ENDGAME_DIRS : 2;
+	for (int d = 0; d < dir_cnt; d++) {
+		coordinate_t c = add_direction(from[d], *dirs[d]);
+		while (runs[d] < ENDGAME_MAX_LEN && check_coordinate(c, size)
+			   && get_hit(map, c) == unknown) {
+			runs[d]++;
+			c = add_direction(c, *dirs[d]);
+		}
+	}
+
+	uint32_t key =
+		get_endgame_key(solver->ship_counts, cluster.length, runs);
+	if (key == 0) {
+		return invalid_coordinate;
+	}
+	int move = lookup_endgame(endgame_table, endgame_bits, key);
+	if (move < 0) {
+		return invalid_coordinate;
+	}
+	return add_direction(from[move], *dirs[move]);
 }
 
 static coordinate_t get_sink_coordinate(
+	solver_t* solver,
 	coordinate_t coordinate,
 	hit_report_t hit_report)
 {
+	const map_t* map = solver->map;
+	uint8_t size = map->map_size;
+	deque_t* target_queue = &solver->target_queue;
+	deque_t* hit_queue = &solver->hit_queue;
 
-	if (hit_queue->size == get_max_size()) {
+	if (hit_queue->size == get_max_size(solver)) {
 		debug_print("%s\n", "Max hit count reached");
-		scan_mode = true;
+		solver->scan_mode = true;
 		clear(target_queue);
 		clear(hit_queue);
-		return get_random_coordinate();
+		return get_random_coordinate(solver);
 	}
 
 
-	coordinate_t c, c1, c2;
-	alignment_t alignment;
-
-	if (hit_queue->size == 2) {
-		c1 = peek_front(hit_queue);
-		c2 = peek_back(hit_queue);
-
+	coordinate_t c;
 
-		alignment = get_alignment(c1, c2);
-		debug_print("Alignment is %d\n", alignment);
-		if (alignment == vertical) {
-			debug_print("%s\n", "Alignment is vertical");
-			push_front(target_queue, add_direction(c1, up));
-			push_front(target_queue, add_direction(c1, down));
-			push_front(target_queue, add_direction(c2, up));
-			push_front(target_queue, add_direction(c2, down));
+	if (hit_queue->size >= 2) {
+		// the alignment is known, only the squares beyond both ends are left
+		ship_t cluster = get_ship_at(solver, peek_front(hit_queue));
+		debug_print("Alignment is %d\n", cluster.alignment);
+		clear(target_queue);
+		if (cluster.alignment == vertical) {
+			push_front(target_queue, add_direction(cluster.begin, up));
+			push_front(target_queue, add_direction(cluster.end, down));
 		} else {
-			debug_print("%s\n", "Alignment is horizontal");
-			push_front(target_queue, add_direction(c1, left));
-			push_front(target_queue, add_direction(c1, right));
-			push_front(target_queue, add_direction(c2, left));
-			push_front(target_queue, add_direction(c2, right));
+			push_front(target_queue, add_direction(cluster.begin, left));
+			push_front(target_queue, add_direction(cluster.end, right));
 		}
 	}
 
 
-	do {
+	// skip targets that are off the map or were already shot at
+	while (target_queue->size > 0) {
 		c = pop_front(target_queue);
 		debug_print("c={col=%d,=row%d}\n", c.col, c.row);
-	} while (check_coordinate(c) && get_hit(map, c) != unknown);
-
-
-	if (check_coordinate(c) && get_hit(map, c) == unknown) {
-		return c;
+		if (check_coordinate(c, size) && get_hit(map, c) == unknown) {
+			return c;
+		}
 	}
 
-	return get_random_coordinate();
+	return get_random_coordinate(solver);
 }
 
 static coordinate_t add_direction(coordinate_t c, direction_t d)
@@ -346,33 +607,156 @@ static coordinate_t add_direction(coordinate_t c, direction_t d)
 	return c;
 }
 
-static alignment_t get_alignment(coordinate_t c1, coordinate_t c2)
+static uint8_t get_max_size(const solver_t* solver)
 {
-
-	if (c1.col != c2.col) {
-		return horizontal;
-	} else {
-		return vertical;
+	for (int i = solver->rules.max_ship_len; i >= solver->rules.min_ship_len;
+		 i--) {
+		if (solver->ship_counts[i] != 0) {
+			return i;
+		}
 	}
+	return 0;
 }
 
-static uint8_t get_max_size(void)
+
+static uint8_t get_min_size(const solver_t* solver)
 {
-	for (int i = MAX_SHIP_LEN; i >= MIN_SHIP_LEN; i--) {
-		if (ship_counts[i] != 0) {
+	for (int i = solver->rules.min_ship_len; i <= solver->rules.max_ship_len;
+		 i++) {
+		if (solver->ship_counts[i] != 0) {
 			return i;
 		}
 	}
 	return 0;
 }
 
+/**
+ * @brief record the hit status of a square, removing it from the candidate
+ * sets if it was not targeted before
+ * @param solver the solver to update
+ * @param value the new hit status
+ * @param coordinate the square to update, has to be valid
+ */
+static void set_hit(solver_t* solver, hit_t value, coordinate_t coordinate)
+{
+	if (get_hit(solver->map, coordinate) == unknown && value != unknown) {
+		uint8_t map_size = solver->map->map_size;
+		uint16_t idx = coordinate.row * map_size + coordinate.col;
+
+		for (int s = 0; s < solver->set_cnt; s++) {
+			candidate_set_t* set = &solver->candidates[s];
+			uint8_t k = (coordinate.row + coordinate.col) % set->modulus;
+			uint16_t last = set->start[k] + set->size[k] - 1;
+			uint16_t pos = set->pos[idx];
+			coordinate_t moved = set->cells[last];
+
+			// swap the square with the last one of its class
+			set->cells[pos] = moved;
+			set->pos[moved.row * map_size + moved.col] = pos;
+			set->cells[last] = coordinate;
+			set->pos[idx] = last;
+			set->size[k]--;
+		}
+	}
+
+	put_hit(solver->map, value, coordinate);
+}
 
-static uint8_t get_min_size(void)
+/**
+ * @brief allocate a candidate set for each ship length of the rules
+ * @param solver the solver to initialize, its map has to be created
+ * @return 0 on success, -1 if allocating failed
+ */
+static int init_candidates(solver_t* solver)
 {
-	for (int i = MIN_SHIP_LEN; i < MAX_SHIP_LEN; i++) {
-		if (ship_counts[i] != 0) {
-			return i;
+	const rules_t* rules = &solver->rules;
+	size_t squares = rules->map_size * rules->map_size;
+	size_t words = 0;
+
+	// a coordinate takes the room of one word
+	solver->set_cnt = 0;
+	for (int m = rules->min_ship_len; m <= rules->max_ship_len; m++) {
+		if (rules->ship_counts[m] > 0) {
+			solver->set_index[m] = solver->set_cnt++;
+			words += 2 * squares + 2 * m;
 		}
 	}
+
+	// the second half holds the filled sets to reset from
+	solver->storage_words = words;
+	solver->candidates = malloc(solver->set_cnt * sizeof(candidate_set_t));
+	solver->storage = malloc(2 * words * sizeof(uint16_t));
+	if (solver->candidates == NULL || solver->storage == NULL) {
+		return -1;
+	}
+
+	uint16_t* next = solver->storage;
+	for (int m = rules->min_ship_len; m <= rules->max_ship_len; m++) {
+		if (rules->ship_counts[m] == 0) {
+			continue;
+		}
+		candidate_set_t* set = &solver->candidates[solver->set_index[m]];
+		set->modulus = m;
+		set->cells = (coordinate_t*)next;
+		set->pos = next + squares;
+		set->start = set->pos + squares;
+		set->size = set->start + m;
+		next = set->size + m;
+	}
+
+	fill_candidates(solver);
+	memcpy(solver->storage + words, solver->storage, words * sizeof(uint16_t));
 	return 0;
 }
+
+/**
+ * @brief restore the candidate sets to all squares of the map
+ * @param solver the solver to reset
+ */
+static void reset_candidates(solver_t* solver)
+{
+	memcpy(solver->storage,
+		   solver->storage + solver->storage_words,
+		   solver->storage_words * sizeof(uint16_t));
+}
+
+/**
+ * @brief fill the candidate sets with all squares of the map
+ * @param solver the solver to fill
+ */
+static void fill_candidates(solver_t* solver)
+{
+	uint8_t map_size = solver->map->map_size;
+
+	for (int s = 0; s < solver->set_cnt; s++) {
+		candidate_set_t* set = &solver->candidates[s];
+		uint8_t m = set->modulus;
+
+		for (int k = 0; k < m; k++) {
+			set->size[k] = 0;
+		}
+		for (int row = 0; row < map_size; row++) {
+			for (int col = 0; col < map_size; col++) {
+				set->size[(row + col) % m]++;
+			}
+		}
+
+		uint16_t next[MAX_MAP_SIZE];
+		uint16_t start = 0;
+		for (int k = 0; k < m; k++) {
+			set->start[k] = start;
+			next[k] = start;
+			start += set->size[k];
+		}
+
+		for (int row = 0; row < map_size; row++) {
+			for (int col = 0; col < map_size; col++) {
+				uint8_t k = (row + col) % m;
+				coordinate_t c = {.row = row, .col = col};
+				set->cells[next[k]] = c;
+				set->pos[row * map_size + col] = next[k];
+				next[k]++;
+			}
+		}
+	}
+}
@@ -0,0 +1,83 @@
+/**
+ * @file timerwheel.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief A hashed timer wheel for the timeouts of many connections of OSUE
+ * exercise 1B `Battleship'.
+ */
+#include "../include/timerwheel.h"
+
+void init_wheel(timerwheel_t *wheel, uint64_t now)
+{
+	wheel->tick = now;
+	wheel->armed = 0;
+	for (int i = 0; i < WHEEL_SLOTS; i++) {
+		wheel->slots[i].prev = &wheel->slots[i];
+		wheel->slots[i].next = &wheel->slots[i];
+	}
+}
+
+void init_timeout(timeout_t *timeout, void *owner)
+{
+	timeout->expiry = 0;
+	timeout->owner = owner;
+	timeout->prev = NULL;
+	timeout->next = NULL;
+}
+
+bool is_armed(const timeout_t *timeout)
+{
+	return timeout->next != NULL;
+}
+
+void arm_timeout(timerwheel_t *wheel, timeout_t *timeout, uint64_t expiry)
+{
+	disarm_timeout(wheel, timeout);
+
+	// the slot of the current tick is visited again before the wheel moves on
+	if (expiry < wheel->tick) {
+		expiry = wheel->tick;
+	}
+	timeout_t *head = &wheel->slots[expiry & (WHEEL_SLOTS - 1)];
+	timeout->expiry = expiry;
+	timeout->prev = head;
+	timeout->next = head->next;
+	head->next->prev = timeout;
+	head->next = timeout;
+	wheel->armed++;
+}
+
+void disarm_timeout(timerwheel_t *wheel, timeout_t *timeout)
+{
+	if (!is_armed(timeout)) {
+		return;
+	}
+	timeout->prev->next = timeout->next;
+	timeout->next->prev = timeout->prev;
+	timeout->prev = NULL;
+	timeout->next = NULL;
+	wheel->armed--;
+}
+
+timeout_t *pop_expired(timerwheel_t *wheel, uint64_t now)
+{
+	// the last revolution before now visits every slot anyway
+	if (now >= wheel->tick + WHEEL_SLOTS) {
+		wheel->tick = now - WHEEL_SLOTS + 1;
+	}
+
+	while (true) {
+		timeout_t *head = &wheel->slots[wheel->tick & (WHEEL_SLOTS - 1)];
+		for (timeout_t *t = head->next; t != head; t = t->next) {
+			if (t->expiry <= now) {
+				disarm_timeout(wheel, t);
+				return t;
+			}
+		}
+		if (wheel->tick >= now) {
+			return NULL;
+		}
+		wheel->tick++;
+	}
+}
@@ -0,0 +1,117 @@
+/**
+ * @file trace.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-26
+ *
+ * @brief Binary event tracing for OSUE exercise 1B `Battleship'.
+ * @details Every ring has a single writer, so an event is published by
+ * storing it into the next slot and advancing head with release semantics.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#include "../include/trace.h"
+
+// size of the whole trace file
+#define TRACE_FILE_SIZE \
+	(sizeof(trace_header_t) + TRACE_MAX_RINGS * sizeof(trace_ring_t))
+
+static void *trace_map = NULL;		  // the mapped trace file
+static uint32_t claimed_rings = 0;	// number of rings handed out
+
+static __thread trace_ring_t *ring = NULL;  // the ring of this thread
+static __thread uint64_t ring_map_id = 0;   // the trace the ring belongs to
+static uint64_t map_id = 0;				  // changes with every open_trace()
+
+static trace_ring_t *get_ring(void);
+
+int open_trace(const char *path)
+{
+	int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) {
+		return -1;
+	}
+
+	// the file stays sparse until the rings are written
+	if (ftruncate(fd, TRACE_FILE_SIZE) < 0) {
+		int err = errno;
+		close(fd);
+		errno = err;
+		return -1;
+	}
+
+	void *map =
+		mmap(NULL, TRACE_FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) {
+		return -1;
+	}
+
+	trace_header_t *header = (trace_header_t *)map;
+	memcpy(header->magic, TRACE_MAGIC, sizeof(header->magic));
+	header->ring_cnt = TRACE_MAX_RINGS;
+	header->ring_events = TRACE_RING_EVENTS;
+	header->event_size = sizeof(trace_event_t);
+
+	claimed_rings = 0;
+	map_id++;
+	__atomic_store_n(&trace_map, map, __ATOMIC_RELEASE);
+	return 0;
+}
+
+void close_trace(void)
+{
+	void *map = __atomic_exchange_n(&trace_map, NULL, __ATOMIC_ACQ_REL);
+	if (map != NULL) {
+		munmap(map, TRACE_FILE_SIZE);
+	}
+}
+
+void trace_record(
+	trace_type_t type, uint32_t conn, uint16_t round, coordinate_t c, uint8_t msg)
+{
+	trace_ring_t *r = get_ring();
+	if (r == NULL) {
+		return;
+	}
+
+	uint64_t head = r->head;
+	trace_event_t *event = &r->events[head & (TRACE_RING_EVENTS - 1)];
+	event->time = get_time_ns();
+	event->conn = conn;
+	event->round = round;
+	event->type = type;
+	event->msg = msg;
+	event->row = c.row;
+	event->col = c.col;
+
+	__atomic_store_n(&r->head, head + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief get the ring of the calling thread, claiming one if necessary
+ * @return the ring, NULL if tracing is disabled or no ring is left
+ */
+static trace_ring_t *get_ring(void)
+{
+	void *map = __atomic_load_n(&trace_map, __ATOMIC_ACQUIRE);
+	if (map == NULL) {
+		return NULL;
+	}
+	if (ring_map_id == map_id) {
+		return ring;
+	}
+
+	uint32_t i = __atomic_fetch_add(&claimed_rings, 1, __ATOMIC_RELAXED);
+	ring_map_id = map_id;
+	if (i >= TRACE_MAX_RINGS) {
+		ring = NULL;
+	} else {
+		ring = (trace_ring_t *)((char *)map + sizeof(trace_header_t)) + i;
+	}
+	return ring;
+}
@@ -0,0 +1,209 @@
+/**
+ * @file tracedump.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-26
+ *
+ * @brief Offline decoder of the trace files of OSUE exercise 1B `Battleship'.
+ * @details Merges the events of all rings of a trace file by time and prints
+ * one line per event. Only the last TRACE_RING_EVENTS events of each ring are
+ * available.
+ */
+
+// IO, C standard library, POSIX API, data types:
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+
+// Memory mapping:
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../include/common.h"
+#include "../include/msg.h"
+#include "../include/trace.h"
+
+static char *program_name;
+
+static int parse_args(int argc, char *argv[]);
+static void print_usage(void);
+
+static int compare_events(const void *a, const void *b);
+static void print_event(const trace_event_t *event, uint64_t start);
+
+static const char *path = NULL;
+static uint32_t conn_filter = 0;
+static bool filter_conn = false;
+
+int main(int argc, char *argv[])
+{
+	if (parse_args(argc, argv) < 0) {
+		print_usage();
+		return EXIT_FAILURE;
+	}
+
+	int fd = open(path, O_RDONLY);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) < 0) {
+		fprintf(stderr, "%s: Could not open %s\n", program_name, path);
+		fprintf(stderr, "\t%s\n", strerror(errno));
+		return EXIT_FAILURE;
+	}
+
+	const trace_header_t *header = NULL;
+	if (st.st_size >= sizeof(trace_header_t)) {
+		header = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	close(fd);
+
+	if (header == NULL || header == MAP_FAILED
+		|| memcmp(header->magic, TRACE_MAGIC, sizeof(header->magic)) != 0
+		|| header->ring_events != TRACE_RING_EVENTS
+		|| header->event_size != sizeof(trace_event_t)
+		|| st.st_size < sizeof(trace_header_t)
+							+ (size_t)header->ring_cnt * sizeof(trace_ring_t)) {
+		fprintf(stderr, "%s: %s is no trace file\n", program_name, path);
+		return EXIT_FAILURE;
+	}
+
+	const trace_ring_t *rings = (const trace_ring_t *)(header + 1);
+
+	size_t total = 0;
+	for (uint32_t i = 0; i < header->ring_cnt; i++) {
+		uint64_t head = rings[i].head;
+		total += head < TRACE_RING_EVENTS ? head : TRACE_RING_EVENTS;
+	}
+
+	trace_event_t *events =
+		(trace_event_t *)malloc((total + 1) * sizeof(trace_event_t));
+	if (events == NULL) {
+		fprintf(stderr, "%s: Could not allocate events\n", program_name);
+		return EXIT_FAILURE;
+	}
+
+	// copy the events of each ring oldest first
+	size_t n = 0;
+	for (uint32_t i = 0; i < header->ring_cnt; i++) {
+		uint64_t head = rings[i].head;
+		uint64_t first = head > TRACE_RING_EVENTS ? head - TRACE_RING_EVENTS : 0;
+		for (uint64_t e = first; e < head; e++) {
+			const trace_event_t *event =
+				&rings[i].events[e & (TRACE_RING_EVENTS - 1)];
+			if (!filter_conn || event->conn == conn_filter) {
+				events[n++] = *event;
+			}
+		}
+	}
+
+	qsort(events, n, sizeof(trace_event_t), compare_events);
+
+	for (size_t i = 0; i < n; i++) {
+		print_event(&events[i], events[0].time);
+	}
+
+	free(events);
+	munmap((void *)header, st.st_size);
+	return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Parses the program command line options
+ * @param argc the argument counter, length of argv
+ * @param argv an array of arguments
+ * @return 0 on success, -1 on failure
+ */
+static int parse_args(int argc, char *argv[])
+{
+	program_name = argv[0];
+
+	int arg_c;
+	char *end;
+	while ((arg_c = getopt(argc, argv, "c:")) != EOF) {
+		switch (arg_c) {
+			case 'c':
+				errno = 0;
+				conn_filter = strtoul(optarg, &end, 10);
+				if (errno != 0 || *end != '\0') {
+					return -1;
+				}
+				filter_conn = true;
+				break;
+			default:
+				return -1;
+		}
+	}
+
+	if (argc - optind != 1) {
+		return -1;
+	}
+	path = argv[optind];
+
+	return 0;
+}
+
+/**
+ * @brief Print the usage message to stdout
+ */
+static void print_usage(void)
+{
+	printf("\nUsage:\n");
+	printf("\ttracedump [-c CONNECTION] FILE\n");
+	printf("\n\t-c\tonly print the events of the given connection\n");
+	printf("\nexample:\n");
+	printf("\ttracedump -c 3 server.trace\n");
+}
+
+/**
+ * @brief order events by time
+ */
+static int compare_events(const void *a, const void *b)
+{
+	const trace_event_t *x = (const trace_event_t *)a;
+	const trace_event_t *y = (const trace_event_t *)b;
+	return (x->time > y->time) - (x->time < y->time);
+}
+
+/**
+ * @brief print a single event as a line of text
+ * @param event the event to print
+ * @param start the time of the first event, times are printed relative to it
+ */
+static void print_event(const trace_event_t *event, uint64_t start)
+{
+	static const char *reports[] = {"miss", "hit", "sunk", "last_sunk"};
+	static const char *statuses[] = {
+		"ongoing", "game_over", "err_parity", "err_coordinate"};
+
+	uint64_t t = event->time - start;
+	printf("%6llu.%09llu conn=%-6u round=%-3u ",
+		   (unsigned long long)(t / 1000000000),
+		   (unsigned long long)(t % 1000000000),
+		   event->conn,
+		   event->round);
+
+	switch (event->type) {
+		case trace_connect:
+			printf("connect\n");
+			break;
+		case trace_new_game:
+			printf("new_game\n");
+			break;
+		case trace_shot:
+			printf("shot row=%u col=%u %s %s\n",
+				   event->row,
+				   event->col,
+				   reports[get_hit_report(event->msg)],
+				   statuses[get_status(event->msg) >> 2]);
+			break;
+		case trace_close:
+			printf("close\n");
+			break;
+		default:
+			printf("unknown event %u\n", event->type);
+			break;
+	}
+}
@@ -0,0 +1,367 @@
+/**
+ * @file uring.c
+ * @author Matthias Pichler, 01634256
+ * @date 2018-04-28
+ *
+ * @brief A minimal io_uring instance for the server of OSUE exercise 1B
+ * `Battleship'.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/socket.h>
+
+#include "../include/uring.h"
+
+// flags of a ring for the lowest overhead: completions are only posted while
+// waiting for them, by the only thread using the ring
+#define FAST_SETUP_FLAGS                                                       \
+	(IORING_SETUP_SUBMIT_ALL | IORING_SETUP_SINGLE_ISSUER                      \
+	 | IORING_SETUP_DEFER_TASKRUN)
+// features of the kernel the server relies on
+#define REQUIRED_FEATURES                                                      \
+	(IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG)
+
+static int setup_ring(unsigned entries, struct io_uring_params *params);
+static int check_support(uring_t *ring);
+static void add_buffer(uring_t *ring, uint16_t bid);
+
+int init_uring(uring_t *ring, unsigned entries)
+{
+	memset(ring, 0, sizeof(*ring));
+	struct io_uring_params params;
+	ring->fd = setup_ring(entries, &params);
+	if (ring->fd < 0) {
+		return -1;
+	}
+	if ((params.features & REQUIRED_FEATURES) != REQUIRED_FEATURES) {
+		free_uring(ring);
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	// with a single mapping the completion queue follows the submission one
+	ring->sq_ring_size =
+		params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	ring->cq_ring_size =
+		params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	if (ring->cq_ring_size > ring->sq_ring_size) {
+		ring->sq_ring_size = ring->cq_ring_size;
+	}
+	ring->sq_ring = mmap(NULL,
+						 ring->sq_ring_size,
+						 PROT_READ | PROT_WRITE,
+						 MAP_SHARED | MAP_POPULATE,
+						 ring->fd,
+						 IORING_OFF_SQ_RING);
+	if (ring->sq_ring == MAP_FAILED) {
+		ring->sq_ring = NULL;
+		free_uring(ring);
+		return -1;
+	}
+	ring->cq_ring = ring->sq_ring;
+
+	ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+	ring->sqes = mmap(NULL,
+					  ring->sqes_size,
+					  PROT_READ | PROT_WRITE,
+					  MAP_SHARED | MAP_POPULATE,
+					  ring->fd,
+					  IORING_OFF_SQES);
+	if (ring->sqes == MAP_FAILED) {
+		ring->sqes = NULL;
+		free_uring(ring);
+		return -1;
+	}
+
+	uint8_t *sq = ring->sq_ring;
+	ring->sq_head = (unsigned *)(sq + params.sq_off.head);
+	ring->sq_tail = (unsigned *)(sq + params.sq_off.tail);
+	ring->sq_array = (unsigned *)(sq + params.sq_off.array);
+	ring->sq_mask = *(unsigned *)(sq + params.sq_off.ring_mask);
+	ring->sq_entries = params.sq_entries;
+	ring->sqe_tail = *ring->sq_tail;
+	ring->sqe_submitted = ring->sqe_tail;
+
+	uint8_t *cq = ring->cq_ring;
+	ring->cq_head = (unsigned *)(cq + params.cq_off.head);
+	ring->cq_tail = (unsigned *)(cq + params.cq_off.tail);
+	ring->cq_mask = *(unsigned *)(cq + params.cq_off.ring_mask);
+	ring->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+
+	if (check_support(ring) < 0) {
+		free_uring(ring);
+		return -1;
+	}
+	return 0;
+}
+
+int add_buffers(uring_t *ring, unsigned cnt, unsigned len)
+{
+	long page = sysconf(_SC_PAGESIZE);
+	size_t size = cnt * sizeof(struct io_uring_buf);
+	size = (size + page - 1) / page * page;
+	void *buf_ring = mmap(NULL,
+						  size,
+						  PROT_READ | PROT_WRITE,
+						  MAP_PRIVATE | MAP_ANONYMOUS,
+						  -1,
+						  0);
+	if (buf_ring == MAP_FAILED) {
+		return -1;
+	}
+	uint8_t *bufs = malloc((size_t)cnt * len);
+	if (bufs == NULL) {
+		munmap(buf_ring, size);
+		return -1;
+	}
+
+	struct io_uring_buf_reg reg;
+	memset(&reg, 0, sizeof(reg));
+	reg.ring_addr = (uintptr_t)buf_ring;
+	reg.ring_entries = cnt;
+	reg.bgid = URING_BUF_GROUP;
+	ring->syscalls++;
+	if (syscall(SYS_io_uring_register,
+				ring->fd,
+				IORING_REGISTER_PBUF_RING,
+				&reg,
+				1)
+		< 0) {
+		free(bufs);
+		munmap(buf_ring, size);
+		return -1;
+	}
+
+	ring->buf_ring = buf_ring;
+	ring->buf_ring_size = size;
+	ring->bufs = bufs;
+	ring->buf_cnt = cnt;
+	ring->buf_len = len;
+	ring->buf_tail = 0;
+	for (unsigned i = 0; i < cnt; i++) {
+		add_buffer(ring, i);
+	}
+	__atomic_store_n(&ring->buf_ring->tail, ring->buf_tail, __ATOMIC_RELEASE);
+	return 0;
+}
+
+void free_uring(uring_t *ring)
+{
+	// closing the ring cancels everything still in progress
+	if (ring->fd >= 0) {
+		close(ring->fd);
+		ring->fd = -1;
+	}
+	if (ring->buf_ring != NULL) {
+		munmap(ring->buf_ring, ring->buf_ring_size);
+		ring->buf_ring = NULL;
+	}
+	free(ring->bufs);
+	ring->bufs = NULL;
+	if (ring->sqes != NULL) {
+		munmap(ring->sqes, ring->sqes_size);
+		ring->sqes = NULL;
+	}
+	if (ring->sq_ring != NULL) {
+		munmap(ring->sq_ring, ring->sq_ring_size);
+		ring->sq_ring = NULL;
+		ring->cq_ring = NULL;
+	}
+}
+
+struct io_uring_sqe *get_sqe(uring_t *ring)
+{
+	unsigned head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+	if (ring->sqe_tail - head == ring->sq_entries) {
+		if (submit_uring(ring, 0, -1) < 0 && errno != EINTR) {
+			return NULL;
+		}
+		head = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE);
+		if (ring->sqe_tail - head == ring->sq_entries) {
+			errno = EBUSY;
+			return NULL;
+		}
+	}
+
+	unsigned index = ring->sqe_tail & ring->sq_mask;
+	struct io_uring_sqe *sqe = &ring->sqes[index];
+	memset(sqe, 0, sizeof(*sqe));
+	ring->sq_array[index] = index;
+	ring->sqe_tail++;
+	return sqe;
+}
+
+int submit_uring(uring_t *ring, unsigned wait, int timeout)
+{
+	__atomic_store_n(ring->sq_tail, ring->sqe_tail, __ATOMIC_RELEASE);
+
+	struct __kernel_timespec ts;
+	struct io_uring_getevents_arg arg;
+	memset(&arg, 0, sizeof(arg));
+	if (timeout >= 0) {
+		ts.tv_sec = timeout / 1000;
+		ts.tv_nsec = (timeout % 1000) * 1000000L;
+		arg.ts = (uintptr_t)&ts;
+	}
+
+	ring->syscalls++;
+	long n = syscall(SYS_io_uring_enter,
+					 ring->fd,
+					 ring->sqe_tail - ring->sqe_submitted,
+					 wait,
+					 IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+					 &arg,
+					 sizeof(arg));
+	if (n < 0) {
+		return -1;
+	}
+	ring->sqe_submitted += n;
+	return 0;
+}
+
+struct io_uring_cqe *peek_cqe(uring_t *ring)
+{
+	unsigned head = *ring->cq_head;
+	if (head == __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+		return NULL;
+	}
+	return &ring->cqes[head & ring->cq_mask];
+}
+
+void seen_cqe(uring_t *ring)
+{
+	__atomic_store_n(ring->cq_head, *ring->cq_head + 1, __ATOMIC_RELEASE);
+}
+
+const uint8_t *get_buffer(const uring_t *ring, uint16_t bid)
+{
+	return ring->bufs + (size_t)bid * ring->buf_len;
+}
+
+void return_buffer(uring_t *ring, uint16_t bid)
+{
+	add_buffer(ring, bid);
+	__atomic_store_n(&ring->buf_ring->tail, ring->buf_tail, __ATOMIC_RELEASE);
+}
+
+void prep_multishot_accept(struct io_uring_sqe *sqe, int fd, uint64_t user_data)
+{
+	sqe->opcode = IORING_OP_ACCEPT;
+	sqe->fd = fd;
+	sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+	sqe->user_data = user_data;
+}
+
+void prep_multishot_recv(struct io_uring_sqe *sqe, int fd, uint64_t user_data)
+{
+	sqe->opcode = IORING_OP_RECV;
+	sqe->fd = fd;
+	sqe->ioprio = IORING_RECV_MULTISHOT;
+	sqe->flags = IOSQE_BUFFER_SELECT;
+	sqe->buf_group = URING_BUF_GROUP;
+	sqe->user_data = user_data;
+}
+
+void prep_send(struct io_uring_sqe *sqe,
+			   int fd,
+			   const void *buf,
+			   size_t len,
+			   uint64_t user_data)
+{
+	sqe->opcode = IORING_OP_SEND;
+	sqe->fd = fd;
+	sqe->addr = (uintptr_t)buf;
+	sqe->len = len;
+	// a closed peer must not raise SIGPIPE
+	sqe->msg_flags = MSG_NOSIGNAL;
+	sqe->user_data = user_data;
+}
+
+void prep_close(struct io_uring_sqe *sqe, int fd, uint64_t user_data)
+{
+	sqe->opcode = IORING_OP_CLOSE;
+	sqe->fd = fd;
+	sqe->user_data = user_data;
+}
+
+void prep_cancel(struct io_uring_sqe *sqe, uint64_t target, uint64_t user_data)
+{
+	sqe->opcode = IORING_OP_ASYNC_CANCEL;
+	sqe->fd = -1;
+	sqe->addr = target;
+	sqe->user_data = user_data;
+}
+
+/**
+ * @brief create a ring, with the fastest flags the kernel supports
+ * @param entries the number of submission queue entries
+ * @param params the parameters of the ring are stored into it
+ * @return the file descriptor of the ring, -1 on failure with errno set
+ */
+static int setup_ring(unsigned entries, struct io_uring_params *params)
+{
+	unsigned flags[] = {FAST_SETUP_FLAGS, IORING_SETUP_SUBMIT_ALL, 0};
+	int fd = -1;
+	for (size_t i = 0; fd < 0 && i < sizeof(flags) / sizeof(flags[0]); i++) {
+		memset(params, 0, sizeof(*params));
+		params->flags = flags[i] | IORING_SETUP_CQSIZE;
+		params->cq_entries = 4 * entries;
+		fd = syscall(SYS_io_uring_setup, entries, params);
+		if (fd < 0 && errno != EINVAL) {
+			return -1;
+		}
+	}
+	return fd;
+}
+
+/**
+ * @brief check that the kernel supports multishot receives
+ * @details they came with zero copy sends in Linux 6.0, the probe only
+ * reports operations, not their flags.
+ * @param ring a ring that was just set up
+ * @return 0 if supported, -1 with errno set otherwise
+ */
+static int check_support(uring_t *ring)
+{
+	size_t size = sizeof(struct io_uring_probe)
+				  + IORING_OP_LAST * sizeof(struct io_uring_probe_op);
+	struct io_uring_probe *probe = calloc(1, size);
+	if (probe == NULL) {
+		return -1;
+	}
+
+	ring->syscalls++;
+	int res = syscall(SYS_io_uring_register,
+					  ring->fd,
+					  IORING_REGISTER_PROBE,
+					  probe,
+					  IORING_OP_LAST);
+	if (res == 0
+		&& (probe->last_op < IORING_OP_SEND_ZC
+			|| !(probe->ops[IORING_OP_SEND_ZC].flags & IO_URING_OP_SUPPORTED))) {
+		errno = EOPNOTSUPP;
+		res = -1;
+	}
+	free(probe);
+	return res < 0 ? -1 : 0;
+}
+
+/**
+ * @brief put a buffer at the end of the provided buffers, without
+ * publishing the new tail
+ * @param ring the ring
+ * @param bid the id of the buffer
+ */
+static void add_buffer(uring_t *ring, uint16_t bid)
+{
+	struct io_uring_buf *buf =
+		&ring->buf_ring->bufs[ring->buf_tail & (ring->buf_cnt - 1)];
+	buf->addr = (uintptr_t)get_buffer(ring, bid);
+	buf->len = ring->buf_len;
+	buf->bid = bid;
+	ring->buf_tail++;
+}